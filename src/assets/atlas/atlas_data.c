@@ -32,3 +32,106 @@ const SpriteMeta ASSET_SPRITES[SPRITE_COUNT] = {
 const AnimDef ASSET_ANIMS[ANIM_COUNT] = {
     /* [ 0] ANIM_CHARACTER_ZOMBIE_RUN      */ {   1,  3, 0.10f, 1 }
 };
+
+// ---------------------------------------------------------------------------
+// Font Glyph Array
+// Format: { x, y, w, h }
+// ---------------------------------------------------------------------------
+
+const GlyphMeta ASSET_GLYPHS[FONT_GLYPH_COUNT] = {
+    /* [  0] ' '  */ {  801,    3,  3, 10 },
+    /* [  1] '!'  */ {  808,    3,  1, 10 },
+    /* [  2] '"'  */ {  813,    3,  4, 10 },
+    /* [  3] '#'  */ {  821,    3,  6, 10 },
+    /* [  4] '$'  */ {  831,    3,  5, 10 },
+    /* [  5] '%'  */ {  840,    3,  7, 10 },
+    /* [  6] '&'  */ {  851,    3,  6, 10 },
+    /* [  7] '''  */ {  861,    3,  2, 10 },
+    /* [  8] '('  */ {  867,    3,  3, 10 },
+    /* [  9] ')'  */ {  874,    3,  3, 10 },
+    /* [ 10] 0x2A */ {  881,    3,  5, 10 },
+    /* [ 11] '+'  */ {  890,    3,  5, 10 },
+    /* [ 12] ','  */ {  899,    3,  2, 10 },
+    /* [ 13] '-'  */ {  905,    3,  4, 10 },
+    /* [ 14] '.'  */ {  913,    3,  1, 10 },
+    /* [ 15] 0x2F */ {  918,    3,  7, 10 },
+    /* [ 16] '0'  */ {  929,    3,  5, 10 },
+    /* [ 17] '1'  */ {  938,    3,  2, 10 },
+    /* [ 18] '2'  */ {  944,    3,  5, 10 },
+    /* [ 19] '3'  */ {  953,    3,  5, 10 },
+    /* [ 20] '4'  */ {  962,    3,  5, 10 },
+    /* [ 21] '5'  */ {  971,    3,  5, 10 },
+    /* [ 22] '6'  */ {  980,    3,  5, 10 },
+    /* [ 23] '7'  */ {  989,    3,  5, 10 },
+    /* [ 24] '8'  */ {  998,    3,  5, 10 },
+    /* [ 25] '9'  */ { 1007,    3,  5, 10 },
+    /* [ 26] ':'  */ { 1016,    3,  1, 10 },
+    /* [ 27] ';'  */ { 1021,    3,  1, 10 },
+    /* [ 28] '<'  */ { 1026,    3,  3, 10 },
+    /* [ 29] '='  */ { 1033,    3,  4, 10 },
+    /* [ 30] '>'  */ { 1041,    3,  3, 10 },
+    /* [ 31] '?'  */ { 1048,    3,  6, 10 },
+    /* [ 32] '@'  */ { 1058,    3,  7, 10 },
+    /* [ 33] 'A'  */ { 1069,    3,  6, 10 },
+    /* [ 34] 'B'  */ { 1079,    3,  6, 10 },
+    /* [ 35] 'C'  */ { 1089,    3,  6, 10 },
+    /* [ 36] 'D'  */ { 1099,    3,  6, 10 },
+    /* [ 37] 'E'  */ { 1109,    3,  6, 10 },
+    /* [ 38] 'F'  */ { 1119,    3,  6, 10 },
+    /* [ 39] 'G'  */ { 1129,    3,  6, 10 },
+    /* [ 40] 'H'  */ { 1139,    3,  6, 10 },
+    /* [ 41] 'I'  */ { 1149,    3,  3, 10 },
+    /* [ 42] 'J'  */ { 1156,    3,  5, 10 },
+    /* [ 43] 'K'  */ { 1165,    3,  6, 10 },
+    /* [ 44] 'L'  */ { 1175,    3,  5, 10 },
+    /* [ 45] 'M'  */ { 1184,    3,  7, 10 },
+    /* [ 46] 'N'  */ { 1195,    3,  6, 10 },
+    /* [ 47] 'O'  */ { 1205,    3,  6, 10 },
+    /* [ 48] 'P'  */ { 1215,    3,  6, 10 },
+    /* [ 49] 'Q'  */ { 1225,    3,  6, 10 },
+    /* [ 50] 'R'  */ { 1235,    3,  6, 10 },
+    /* [ 51] 'S'  */ { 1245,    3,  6, 10 },
+    /* [ 52] 'T'  */ { 1255,    3,  7, 10 },
+    /* [ 53] 'U'  */ { 1266,    3,  6, 10 },
+    /* [ 54] 'V'  */ { 1276,    3,  7, 10 },
+    /* [ 55] 'W'  */ { 1287,    3,  7, 10 },
+    /* [ 56] 'X'  */ { 1298,    3,  6, 10 },
+    /* [ 57] 'Y'  */ { 1308,    3,  6, 10 },
+    /* [ 58] 'Z'  */ { 1318,    3,  6, 10 },
+    /* [ 59] '['  */ { 1328,    3,  2, 10 },
+    /* [ 60] 0x5C */ { 1334,    3,  7, 10 },
+    /* [ 61] ']'  */ { 1345,    3,  2, 10 },
+    /* [ 62] '^'  */ { 1351,    3,  3, 10 },
+    /* [ 63] '_'  */ { 1358,    3,  5, 10 },
+    /* [ 64] '`'  */ { 1367,    3,  2, 10 },
+    /* [ 65] 'a'  */ { 1373,    3,  5, 10 },
+    /* [ 66] 'b'  */ { 1382,    3,  5, 10 },
+    /* [ 67] 'c'  */ { 1391,    3,  5, 10 },
+    /* [ 68] 'd'  */ { 1400,    3,  5, 10 },
+    /* [ 69] 'e'  */ { 1409,    3,  5, 10 },
+    /* [ 70] 'f'  */ { 1418,    3,  4, 10 },
+    /* [ 71] 'g'  */ { 1426,    3,  5, 10 },
+    /* [ 72] 'h'  */ { 1435,    3,  5, 10 },
+    /* [ 73] 'i'  */ { 1444,    3,  1, 10 },
+    /* [ 74] 'j'  */ { 1449,    3,  2, 10 },
+    /* [ 75] 'k'  */ { 1455,    3,  5, 10 },
+    /* [ 76] 'l'  */ { 1464,    3,  2, 10 },
+    /* [ 77] 'm'  */ { 1470,    3,  5, 10 },
+    /* [ 78] 'n'  */ { 1479,    3,  5, 10 },
+    /* [ 79] 'o'  */ { 1488,    3,  5, 10 },
+    /* [ 80] 'p'  */ { 1497,    3,  5, 10 },
+    /* [ 81] 'q'  */ { 1506,    3,  5, 10 },
+    /* [ 82] 'r'  */ { 1515,    3,  5, 10 },
+    /* [ 83] 's'  */ { 1524,    3,  5, 10 },
+    /* [ 84] 't'  */ { 1533,    3,  4, 10 },
+    /* [ 85] 'u'  */ { 1541,    3,  5, 10 },
+    /* [ 86] 'v'  */ { 1550,    3,  5, 10 },
+    /* [ 87] 'w'  */ { 1559,    3,  5, 10 },
+    /* [ 88] 'x'  */ { 1568,    3,  5, 10 },
+    /* [ 89] 'y'  */ { 1577,    3,  5, 10 },
+    /* [ 90] 'z'  */ { 1586,    3,  5, 10 },
+    /* [ 91] '{'  */ { 1595,    3,  3, 10 },
+    /* [ 92] '|'  */ { 1602,    3,  1, 10 },
+    /* [ 93] '}'  */ { 1607,    3,  3, 10 },
+    /* [ 94] '~'  */ { 1614,    3,  4, 10 }
+};
@@ -30,6 +30,15 @@ typedef struct {
     uint8_t loop;            // Whether animation loops (1=yes, 0=no)
 } AnimDef;
 
+// ---------------------------------------------------------------------------
+// Font Glyph Structure (raylib default font, advance = w * scale + spacing)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint16_t x, y;         // Position in the atlas (clean pixels, inside extrusion)
+    uint16_t w, h;         // Glyph cell (h = FONT_BASE_SIZE)
+} GlyphMeta;
+
 // ---------------------------------------------------------------------------
 // Sprite ID Enumeration
 // ---------------------------------------------------------------------------
@@ -57,11 +66,28 @@ typedef enum {
     ANIM_CHARACTER_ZOMBIE_RUN = 0
 } AnimID;
 
+// ---------------------------------------------------------------------------
+// Font Glyphs (codepoints FONT_FIRST_CHAR .. FONT_FIRST_CHAR + FONT_GLYPH_COUNT - 1)
+// ---------------------------------------------------------------------------
+
+#define FONT_FIRST_CHAR 32
+#define FONT_GLYPH_COUNT 95
+#define FONT_BASE_SIZE 10
+
+// ---------------------------------------------------------------------------
+// Solid White Texels (untextured quads sample inside this block)
+// ---------------------------------------------------------------------------
+
+#define ATLAS_WHITE_X 1622
+#define ATLAS_WHITE_Y 3
+#define ATLAS_WHITE_SIZE 2
+
 // ---------------------------------------------------------------------------
 // External Data Arrays (defined in atlas_data.c)
 // ---------------------------------------------------------------------------
 
 extern const SpriteMeta ASSET_SPRITES[SPRITE_COUNT];
 extern const AnimDef ASSET_ANIMS[ANIM_COUNT];
+extern const GlyphMeta ASSET_GLYPHS[FONT_GLYPH_COUNT];
 
 #endif // ATLAS_DATA_H
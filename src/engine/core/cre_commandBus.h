@@ -46,6 +46,7 @@ struct Command {
 
     CommandPayloadAnim anim;
     CommandPayloadPhysDef physDef;
+    CommandPayloadPhysJoint physJoint;
     CommandPayloadEntityClone entityClone;
     CommandPayloadCamFollow camFollow;
     CommandPayloadColor color;
@@ -57,6 +58,8 @@ struct Command {
     CommandPayloadAudioB8 audiob8;
     CommandPayloadAudioVec2 audiovec2;
     CommandPayloadAudioOneShot audioshot;
+    CommandPayloadAITarget aiTarget;
+    CommandPayloadXformAttach xformAttach;
     alignas(4) uint8_t raw[48];
   };
 };
@@ -173,6 +176,24 @@ static inline CommandIterator CommandBus_GetIterator(CommandBus &bus) {
   return iter;
 }
 
+/**
+ * Snapshot iterator over the commands pushed since `begin`, a head value
+ * read earlier in the frame (a second drain of the same phase).
+ *
+ * @param bus Pointer to the CommandBus
+ * @param begin Head position the drain starts from
+ * @return CommandIterator positioned at begin, ending at current head
+ */
+static inline CommandIterator CommandBus_GetIteratorFrom(CommandBus &bus,
+                                                         uint32_t begin) {
+  assert((begin - bus.tail) <= (bus.head - bus.tail) &&
+         "CommandBus_GetIteratorFrom: begin outside [tail..head]");
+  CommandIterator iter = CommandIterator{.current = begin, .end = bus.head};
+
+  bus.consumed_end = iter.end;
+  return iter;
+}
+
 /**
  * Advance the iterator and get a direct const pointer to the next command.
  * HOT PATH - inlined for zero function call overhead.
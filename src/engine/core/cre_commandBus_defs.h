@@ -20,6 +20,8 @@ constexpr uint32_t CMD_DOMAIN_ANIM = 0x0300U;
 constexpr uint32_t CMD_DOMAIN_RENDER = 0x0400U;
 constexpr uint32_t CMD_DOMAIN_CAMERA = 0x0500U;
 constexpr uint32_t CMD_DOMAIN_AUDIO = 0x0600U;
+constexpr uint32_t CMD_DOMAIN_AI = 0x0700U;
+constexpr uint32_t CMD_DOMAIN_TRANSFORM = 0x0800U;
 
 // ============================================================================
 // Command Types
@@ -38,6 +40,8 @@ typedef enum CommandType : uint16_t {
   CMD_PHYS_SET_GRAVITY_SCALE,
   CMD_PHYS_SET_MATERIAL,
   CMD_PHYS_SET_GRAVITY,
+  CMD_PHYS_JOINT_CREATE,
+  CMD_PHYS_JOINT_DESTROY,
 
   // Entity commands
   CMD_ENTITY_SPAWN = CMD_DOMAIN_ENTITY,
@@ -97,7 +101,18 @@ typedef enum CommandType : uint16_t {
   CMD_AUDIO_SOUND_SET_LOOPING,
   CMD_AUDIO_SOUND_SET_SPATIALIZATION,
   CMD_AUDIO_SOUND_SET_POSITION,
-  CMD_AUDIO_SOUND_SET_ATTENUATION
+  CMD_AUDIO_SOUND_SET_ATTENUATION,
+
+  // AI commands
+  CMD_AI_SET_STATE = CMD_DOMAIN_AI,
+  CMD_AI_SET_TARGET,
+
+  // Transform hierarchy commands
+  CMD_XFORM_ATTACH = CMD_DOMAIN_TRANSFORM,
+  CMD_XFORM_DETACH,
+  CMD_XFORM_SET_OFFSET,
+  CMD_XFORM_SET_ROTATION,
+  CMD_XFORM_SET_SCALE
 } CommandType;
 
 // ============================================================================
@@ -145,6 +160,14 @@ typedef struct {
   float drag;
 } CommandPayloadPhysDef;
 
+typedef struct {
+  PhysJointID joint; // Handle allocated by physicsAPI_CreateJoint
+  Entity other;      // Second body, ENTITY_INVALID = world anchor
+  creVec2 anchor;    // World anchor when other is invalid
+  float length;      // Rest/max length, <= 0 = current distance
+  uint8_t type;      // PhysJointType
+} CommandPayloadPhysJoint;
+
 typedef struct {
   Entity prototype;
   creVec2 position;
@@ -208,4 +231,14 @@ typedef struct {
   // removed 1 byte of _padding
 } CommandPayloadAudioOneShot;
 
+typedef struct {
+  Entity target;
+} CommandPayloadAITarget;
+
+typedef struct {
+  Entity parent;
+  creVec2 offset; // Local position in parent space
+  float rotation; // Local rotation, degrees
+} CommandPayloadXformAttach;
+
 #endif
@@ -3,6 +3,17 @@
 
 #include <stdint.h>
 
+// ============================================================================
+// Determinism
+// ============================================================================
+// Set by the CRE_DETERMINISTIC CMake option. Enables strict FP for the
+// simulation sources and id-ordered contact generation.
+#ifndef CRE_DETERMINISTIC
+#define CRE_DETERMINISTIC 0
+#endif
+
+constexpr int64_t FIXED_STEP_US = 16667; // 60 Hz fixed timestep (microseconds)
+
 constexpr float GAME_VIRTUAL_HEIGHT = 1080.0f;
 constexpr int TARGET_FRAMERATE = 60;
 constexpr float MIN_ZOOM = 0.2f;
@@ -22,15 +33,98 @@ constexpr float PHYS_GRAVITY_DEF_X =
     0.0f; // Default gravity X (typically 0 for side-scrollers)
 constexpr float PHYS_GRAVITY_DEF_Y =
     0.0f; // Default gravity Y (positive = down in screen coords)
-constexpr int PHYS_SUB_STEPS = 4; // Number of physics sub-steps per frame
+constexpr int PHYS_MIN_SUB_STEPS = 1; // Sub-steps when nothing moves fast
+constexpr int PHYS_MAX_SUB_STEPS = 8; // Upper bound of adaptive sub-stepping
+constexpr float PHYS_SUB_STEP_TRAVEL =
+    0.5f; // Max travel per sub-step, fraction of the smallest collider
+constexpr int PHYS_MIN_SOLVER_ITERATIONS =
+    2; // Iterations always run before the convergence early-out
 constexpr int PHYS_SOLVER_ITERATIONS =
-    16; // Collision solver iterations per sub-step
+    16; // Collision solver iterations per sub-step (upper bound)
+constexpr float PHYS_SOLVER_TOLERANCE =
+    0.01f; // Stop iterating once no row corrects more than this (pixels)
+// Wall-clock budget of one physics update, 0 = unlimited. Over budget, the
+// remaining sub-steps merge into one at minimum iterations. Timing based,
+// so deterministic builds default to unlimited.
+#if CRE_DETERMINISTIC
+constexpr float PHYS_TIME_BUDGET_MS = 0.0f;
+#else
+constexpr float PHYS_TIME_BUDGET_MS = 12.0f;
+#endif
 constexpr float PHYS_SLEEP_EPSILON =
     2.0f; // Velocity threshold for sleep (squared internally)
 constexpr float PHYS_SLOP = 0.1f; // Penetration allowance before correction
 constexpr float PHYS_CORRECTION_PERCENT =
     0.5f; // Position correction strength (0.0-1.0)
 constexpr int PHYS_MAX_NEIGHBOURS = 128; // Max collision candidates per entity
+constexpr uint32_t PHYS_MAX_JOINTS = 4096; // Joint handles (all types)
+constexpr float PHYS_JOINT_CORRECTION_PERCENT =
+    0.5f; // Joint position correction per solver iteration (0.0-1.0)
+
+// ============================================================================
+// AI Configuration
+// ============================================================================
+constexpr uint32_t AI_MAX_STATES = 32; // State table size (state 0 is NONE)
+constexpr uint32_t AI_DECISIONS_PER_FRAME =
+    2048; // Decision budget before time-slicing kicks in
+constexpr uint32_t AI_MAX_TIME_SLICES =
+    8; // Upper bound of frames a full decision round is spread across
+
+// ============================================================================
+// Transform Hierarchy Configuration
+// ============================================================================
+constexpr uint32_t TRANSFORM_MAX_DEPTH =
+    16; // Levels below a root; deeper attaches are rejected
+
+// ============================================================================
+// Tween Configuration
+// ============================================================================
+constexpr uint32_t TWEEN_POOL_CAPACITY = 8192; // Running tweens per easing
+constexpr uint32_t TWEEN_MAX_EVENTS = 4096; // Completion events per frame
+constexpr float TWEEN_SHAKE_CYCLES = 8.0f;  // Oscillations of a shake tween
+
+// ============================================================================
+// Timer Configuration
+// ============================================================================
+constexpr uint32_t TIMER_CAPACITY = 4096; // Pending deferred commands
+
+// ============================================================================
+// Text Configuration
+// ============================================================================
+constexpr uint32_t TEXT_MAX_RUNS = 64;    // Live text handles
+constexpr uint32_t TEXT_MAX_LENGTH = 128; // Bytes per run, terminator included
+
+// ============================================================================
+// UI Configuration
+// ============================================================================
+constexpr uint32_t UI_MAX_WIDGETS = 1024; // Root included
+constexpr uint32_t UI_TEXT_LENGTH = 32;   // Bytes per label, terminator included
+
+// ============================================================================
+// Lighting Configuration
+// ============================================================================
+constexpr uint32_t LIGHT_GRID_WIDTH = 512;  // Cells, grid origin at world 0,0
+constexpr uint32_t LIGHT_GRID_HEIGHT = 512;
+constexpr float LIGHT_CELL_SIZE = 32.0f;    // Pixels per cell
+constexpr uint32_t LIGHT_MAX_LIGHTS = 1024; // Live light handles
+constexpr uint32_t LIGHT_MAX_RADIUS = 31;   // Cells, flood fill reach
+
+// ============================================================================
+// Visibility Configuration
+// ============================================================================
+constexpr uint32_t VISION_GRID_WIDTH = 512; // Cells (multiple of 64)
+constexpr uint32_t VISION_GRID_HEIGHT = 512;
+constexpr float VISION_CELL_SIZE = 32.0f;    // Pixels per cell, origin 0,0
+constexpr uint32_t VISION_MAX_VIEWERS = 512; // Live viewer handles
+constexpr uint32_t VISION_MAX_TEAMS = 8;
+constexpr uint32_t VISION_MAX_RADIUS = 31; // Cells, a sight row fits 64 bits
+
+// ============================================================================
+// Frame Pacing
+// ============================================================================
+constexpr uint32_t FRAME_PACER_HISTORY = 32; // Frames the cost estimate spans
+constexpr double FRAME_PACER_MARGIN = 0.001; // Seconds added to the estimate
+constexpr double FRAME_PACER_SPIN = 0.002;   // Seconds spun instead of slept
 
 #define atlasDir "atlas.png"
 #define MAX_ENTITIES 16384
@@ -1,7 +1,11 @@
 #include "cre_engine.h"
 #include "cre_commandBus.h"
 #include "cre_config.h"
+#include "cre_engineStats.h"
 #include "cre_logger.h"
+#include "cre_replay.h"
+#include "cre_simState.h"
+#include "cre_stateHash.h"
 #include "engine/core/cre_enginePackets.h"
 #include "engine/core/cre_systemPackets.h"
 #include "engine/core/cre_types.h"
@@ -9,17 +13,26 @@
 #include "engine/ecs/cre_entitySystem.h"
 #include "engine/loaders/cre_assetManager.h"
 #include "engine/memory/cre_arena.h"
+#include "engine/platform/cre_framePacer.h"
 #include "engine/platform/cre_input.h"
 #include "engine/platform/cre_sys.h"
 #include "engine/platform/cre_time.h"
 #include "engine/platform/cre_viewport.h"
 #include "engine/scene/cre_sceneManager.h"
+#include "engine/systems/ai/cre_aiSystem.h"
 #include "engine/systems/animation/cre_animationSystem.h"
 #include "engine/systems/audio/cre_audioSystem.h"
 #include "engine/systems/camera/cre_cameraSystem.h"
+#include "engine/systems/debug/cre_debugDraw.h"
 #include "engine/systems/debug/cre_profilerSystem.h"
+#include "engine/systems/light/cre_lightSystem.h"
 #include "engine/systems/physics/cre_physicsSystem.h"
 #include "engine/systems/render/cre_rendererCore.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include "engine/systems/transform/cre_transformSystem.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+#include "engine/systems/ui/cre_uiSystem.h"
+#include "engine/systems/vision/cre_visionSystem.h"
 #include "raylib.h"
 #include <stdlib.h>
 
@@ -37,6 +50,9 @@ void Engine_Init(EngineContext &ctx, const char *title,
   ctx.busArena = arena_Split(&ctx.masterArena, 8 * 1024 * 1024, 64);     // 8MB
   ctx.audioArena = arena_Split(&ctx.masterArena, 16 * 1024 * 1024, 64);  // 16MB
   ctx.frameArena = arena_Split(&ctx.masterArena, 16 * 1024 * 1024, 64);  // 16MB
+  ctx.timerArena = arena_Split(&ctx.masterArena, 1 * 1024 * 1024, 64);   // 1MB
+  ctx.lightArena = arena_Split(&ctx.masterArena, 4 * 1024 * 1024, 64);   // 4MB
+  ctx.visionArena = arena_Split(&ctx.masterArena, 1 * 1024 * 1024, 64);  // 1MB
   ctx.reg = arena_Push<EntityRegistry>(&ctx.entityArena);
   ctx.bus = arena_Push<CommandBus>(&ctx.busArena);
 
@@ -44,11 +60,16 @@ void Engine_Init(EngineContext &ctx, const char *title,
   Logger_Init();
   Log(LogLevel::Info, "[ENGINE] Engine is Initializing...");
 
-  SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+  Replay_Start(&ctx.time);
+  StateHash_Start();
+
+  // Replays run unthrottled in a hidden window (raylib still needs a context).
+  const bool isReplay = Replay_IsPlaying();
+  SetConfigFlags(isReplay ? FLAG_WINDOW_HIDDEN : FLAG_WINDOW_RESIZABLE);
   Viewport_Init(SCREEN_WIDTH, SCREEN_HEIGHT);
   ViewportSize v = Viewport_Get();
   InitWindow(static_cast<int>(v.width), static_cast<int>(v.height), title);
-  SetTargetFPS(TARGET_FRAMERATE);
+  FramePacer_Init(isReplay ? 0U : static_cast<uint32_t>(TARGET_FRAMERATE));
   Log(LogLevel::Debug, "[ENGINE] Target Resolution: {}x{}", v.width, v.height);
 
   // Clean this configPath later on.
@@ -67,8 +88,18 @@ void Engine_Init(EngineContext &ctx, const char *title,
 
   rendererCore_Init(v.width, v.height);
   PhysicsSystem_Init();
+  // Recordings, replays and hash logs must reproduce bit for bit
+  if (Replay_IsPlaying() || Replay_IsRecording() || StateHash_IsEnabled())
+    PhysicsSystem_SetTimeBudget(0.0f);
+  aiSystem_Init();
+  TweenSystem_Init();
+  TimerSystem_Init(&ctx.timerArena, TIMER_CAPACITY);
+  LightSystem_Init(&ctx.lightArena, LIGHT_GRID_WIDTH, LIGHT_GRID_HEIGHT);
+  VisionSystem_Init(&ctx.visionArena, VISION_GRID_WIDTH, VISION_GRID_HEIGHT);
+  UISystem_Init();
   cameraSystem_Init(*ctx.reg);
   audioSystem_Init();
+  SimState_RegisterEngine(ctx.reg);
   Log(LogLevel::Info, "[ENGINE] Windows created successfully.");
 }
 void Engine_Run(EngineContext &ctx) {
@@ -79,8 +110,11 @@ void Engine_Run(EngineContext &ctx) {
   p3Packet pkt3 = {.reg = ctx.reg, .bus = ctx.bus, .time = &ctx.time};
   p4Packet pkt4 = {.bus = ctx.bus};
 
-  while (!WindowShouldClose()) {
+  while (!WindowShouldClose() && !Replay_IsFinished()) {
+    FramePacer_BeginFrame();
+    const double frameStart = Platform_GetTime();
     PROFILE_START(PROF_TOTAL_ACTIVE);
+    DEBUG_DRAW_BEGIN_FRAME(&ctx.frameArena);
     EnginePhase0_PlatformSync(&pkt0);
     EnginePhase1_InputAndLogic(&pkt1);
     EnginePhase2_Simulation(&pkt2);
@@ -88,6 +122,11 @@ void Engine_Run(EngineContext &ctx) {
     EnginePhase4_Cleanup(&pkt4);
     arena_Clear(&ctx.frameArena);
     PROFILE_END(PROF_TOTAL_ACTIVE);
+    Replay_EndFrame(Platform_GetTime() - frameStart);
+    Profiler_SetEngineStats(EngineStats_Get(*ctx.reg));
+    const PhysicsStepStats steps = PhysicsSystem_GetStepStats();
+    Profiler_SetPhysicsSteps(steps.subSteps, steps.iterations);
+    Profiler_SetFramePacing(FramePacer_GetStats());
     Profiler_UpdateAndPrint(ctx.time.realDt);
   }
 }
@@ -96,6 +135,8 @@ void Engine_Shutdown(EngineContext &ctx) {
   SceneManager_Shutdown(*ctx.reg, *ctx.bus);
   EntityManager_Shutdown(*ctx.reg);
   audioSystem_Shutdown();
+  Replay_Shutdown();
+  StateHash_Shutdown();
 
   CloseWindow();
 
@@ -106,7 +147,7 @@ void Engine_Shutdown(EngineContext &ctx) {
 
 // ENGINE PHASES
 static void EnginePhase0_PlatformSync(p0Packet *packet) {
-  timeSystem_Update(packet->time);
+  Replay_BeginFrame(packet->time);
 
   Viewport_Update();
   if (Viewport_wasResized()) {
@@ -126,7 +167,8 @@ static void EnginePhase1_InputAndLogic(p1Packet *packet) {
   // -----------------------------------------------------------------------------
   scenePacket scenePkt =
       CreateScenePacket(packet->reg, packet->bus, packet->time->gameDt);
-  Input_Poll(); // Empty right now.
+  Input_Poll();
+  Replay_ProcessInput();
   // SceneManager handles input right now due to raylib.
   PROFILE_START(PROF_SCENE);
   SceneManager_Update(&scenePkt);
@@ -134,31 +176,63 @@ static void EnginePhase1_InputAndLogic(p1Packet *packet) {
 }
 
 static void EnginePhase2_Simulation(p2Packet *packet) {
-  // AI and Particle systems are not implemented right now.
+  // Particle system is not implemented right now.
 #ifndef NDEBUG
   packet->bus->current_phase = BUS_PHASE_SIMULATION;
 #endif
 
   entityPacket entityPkt = CreateEntityPacket(packet->reg, packet->bus);
-  physicsPacket physicsPkt =
-      CreatePhysicsPacket(packet->reg, packet->bus, packet->time->fixedDt);
-  animPacket animPkt =
-      CreateAnimPacket(packet->reg, packet->bus, packet->time->gameDt);
-
   PROFILE_START(PROF_ECS_SYS);
   EntitySystem_Update(&entityPkt);
   PROFILE_END(PROF_ECS_SYS);
 
+  // Visibility follows this frame's positions before AI targets with it.
+  PROFILE_START(PROF_VISION);
+  VisionSystem_Update(*packet->reg);
+  PROFILE_END(PROF_VISION);
+
+  // AI runs after spawns land and before physics consumes its commands.
+  aiPacket aiPkt =
+      CreateAIPacket(packet->reg, packet->bus, packet->time->gameDt);
+  PROFILE_START(PROF_AI);
+  aiSystem_Update(&aiPkt);
+  PROFILE_END(PROF_AI);
+
+  // Packets snapshot max_used_bound: build them after this frame's spawns
+  physicsPacket physicsPkt =
+      CreatePhysicsPacket(packet->reg, packet->bus, packet->time->fixedDt);
+  const uint32_t stepCommands = packet->bus->head;
   PROFILE_START(PROF_PHYSICS);
   while (timeSystem_ConsumeFixedStep(packet->time)) {
+    // Deferred commands land before the step that consumes them.
+    TimerSystem_Advance(*packet->bus);
     PhysicsSystem_Update(&physicsPkt);
+    Replay_OnFixedStep();
+    StateHash_Step(*packet->reg, packet->time->frameIndex);
   }
   PROFILE_END(PROF_PHYSICS);
 
+  // Entity commands the timers fired, before Phase 4 flushes them
+  EntitySystem_UpdateSince(&entityPkt, stepCommands);
+
+  animPacket animPkt =
+      CreateAnimPacket(packet->reg, packet->bus, packet->time->gameDt);
   PROFILE_START(PROF_ANIMATION);
   AnimationSystem_Update(&animPkt);
   PROFILE_END(PROF_ANIMATION);
 
+  tweenPacket tweenPkt =
+      CreateTweenPacket(packet->reg, packet->time->gameDt);
+  PROFILE_START(PROF_TWEEN);
+  TweenSystem_Update(&tweenPkt);
+  PROFILE_END(PROF_TWEEN);
+
+  // Children follow their parents' final positions of this frame.
+  transformPacket xformPkt = CreateTransformPacket(packet->reg, packet->bus);
+  PROFILE_START(PROF_TRANSFORM);
+  TransformSystem_Update(&xformPkt);
+  PROFILE_END(PROF_TRANSFORM);
+
   audioSystem_Update(*packet->bus);
 }
 
@@ -174,11 +248,26 @@ static void EnginePhase3_RenderState(p3Packet *packet) {
   cameraSystem_Update(&camPkt);
   PROFILE_END(PROF_CAMERA);
 
+  // Lights follow this frame's final positions before sprites sample them
+  PROFILE_START(PROF_LIGHT);
+  LightSystem_Update(*packet->reg);
+  PROFILE_END(PROF_LIGHT);
+
   PROFILE_START(PROF_RENDER);
   rendererCore_BeginFrame();
   SceneManager_Draw(&scenePkt);
   PROFILE_END(PROF_RENDER);
+
+  // Retained UI on top of the scene, one atlas batch
+  PROFILE_START(PROF_UI_LAYOUT);
+  UISystem_Update(static_cast<float>(GetScreenWidth()),
+                  static_cast<float>(GetScreenHeight()));
+  PROFILE_END(PROF_UI_LAYOUT);
+  PROFILE_START(PROF_UI_DRAW);
+  UISystem_Render();
+  PROFILE_END(PROF_UI_DRAW);
   rendererCore_EndFrame();
+  FramePacer_Present();
 }
 
 static void EnginePhase4_Cleanup(p4Packet *packet) {
@@ -0,0 +1,177 @@
+#include "cre_engineHeadless.h"
+#include "cre_commandBus.h"
+#include "cre_config.h"
+#include "cre_logger.h"
+#include "cre_replay.h"
+#include "cre_simState.h"
+#include "cre_stateHash.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/core/cre_types.h"
+#include "engine/ecs/cre_entityManager.h"
+#include "engine/ecs/cre_entitySystem.h"
+#include "engine/memory/cre_arena.h"
+#include "engine/platform/cre_input.h"
+#include "engine/platform/cre_sys.h"
+#include "engine/platform/cre_time.h"
+#include "engine/platform/cre_viewport.h"
+#include "engine/scene/cre_sceneManager.h"
+#include "engine/systems/ai/cre_aiSystem.h"
+#include "engine/systems/animation/cre_animationSystem.h"
+#include "engine/systems/camera/cre_cameraSystem.h"
+#include "engine/systems/debug/cre_profilerSystem.h"
+#include "engine/systems/light/cre_lightSystem.h"
+#include "engine/systems/physics/cre_physicsSystem.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include "engine/systems/transform/cre_transformSystem.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+#include "engine/systems/vision/cre_visionSystem.h"
+#include <assert.h>
+
+void EngineHeadless_Init(EngineContext &ctx) {
+  // Same layout as Engine_Init so systems see identical capacities.
+  ctx.entityArena = arena_Split(&ctx.masterArena, 8 * 1024 * 1024, 64);  // 8MB
+  ctx.physicsArena = arena_Split(&ctx.masterArena, 4 * 1024 * 1024, 64); // 4MB
+  ctx.busArena = arena_Split(&ctx.masterArena, 8 * 1024 * 1024, 64);     // 8MB
+  ctx.frameArena = arena_Split(&ctx.masterArena, 16 * 1024 * 1024, 64);  // 16MB
+  ctx.timerArena = arena_Split(&ctx.masterArena, 1 * 1024 * 1024, 64);   // 1MB
+  ctx.lightArena = arena_Split(&ctx.masterArena, 4 * 1024 * 1024, 64);   // 4MB
+  ctx.visionArena = arena_Split(&ctx.masterArena, 1 * 1024 * 1024, 64);  // 1MB
+  ctx.reg = arena_Push<EntityRegistry>(&ctx.entityArena);
+  ctx.bus = arena_Push<CommandBus>(&ctx.busArena);
+
+  timeSystem_Init(&ctx.time);
+  Logger_Init();
+  Log(LogLevel::Info, "[ENGINE] Headless engine is Initializing...");
+  StateHash_Start();
+
+  CommandBus_Init(*ctx.bus);
+  EntityManager_Init(*ctx.reg);
+  PhysicsSystem_Init();
+  // Hash logs must reproduce bit for bit
+  if (StateHash_IsEnabled())
+    PhysicsSystem_SetTimeBudget(0.0f);
+  aiSystem_Init();
+  TweenSystem_Init();
+  TimerSystem_Init(&ctx.timerArena, TIMER_CAPACITY);
+  LightSystem_Init(&ctx.lightArena, LIGHT_GRID_WIDTH, LIGHT_GRID_HEIGHT);
+  VisionSystem_Init(&ctx.visionArena, VISION_GRID_WIDTH, VISION_GRID_HEIGHT);
+  cameraSystem_Init(*ctx.reg);
+  // Replayed scenes read the viewport like the client's unresized window
+  Viewport_Init(SCREEN_WIDTH, SCREEN_HEIGHT);
+  Input_Init(nullptr);
+  SimState_RegisterEngine(ctx.reg);
+  Log(LogLevel::Info, "[ENGINE] Headless engine ready.");
+}
+
+void EngineHeadless_Tick(EngineContext &ctx) {
+  EntityRegistry *reg = ctx.reg;
+  CommandBus *bus = ctx.bus;
+  TimeContext *time = &ctx.time;
+
+  // Exactly one fixed step per tick, independent of wall time (timeScale is
+  // never changed on the server). A replay tick is one recorded client frame
+  // instead: its delta, and with it its fixed step count.
+  const double tickStart = Platform_GetTime();
+  const bool replaying = Replay_IsPlaying();
+  if (replaying) {
+    Replay_BeginFrame(time);
+  } else {
+    timeSystem_Advance(time, time->fixedDt);
+  }
+
+  // Phase 1: Logic
+  bus->consumed_end = bus->tail;
+#ifndef NDEBUG
+  bus->current_phase = BUS_PHASE_OPEN;
+#endif
+  if (replaying)
+    Replay_ProcessInput();
+  scenePacket scenePkt = CreateScenePacket(reg, bus, time->gameDt);
+  PROFILE_START(PROF_SCENE);
+  SceneManager_Update(&scenePkt);
+  PROFILE_END(PROF_SCENE);
+
+  // Phase 2: Simulation
+#ifndef NDEBUG
+  bus->current_phase = BUS_PHASE_SIMULATION;
+#endif
+  entityPacket entityPkt = CreateEntityPacket(reg, bus);
+  PROFILE_START(PROF_ECS_SYS);
+  EntitySystem_Update(&entityPkt);
+  PROFILE_END(PROF_ECS_SYS);
+
+  PROFILE_START(PROF_VISION);
+  VisionSystem_Update(*reg);
+  PROFILE_END(PROF_VISION);
+
+  aiPacket aiPkt = CreateAIPacket(reg, bus, time->gameDt);
+  PROFILE_START(PROF_AI);
+  aiSystem_Update(&aiPkt);
+  PROFILE_END(PROF_AI);
+
+  physicsPacket physicsPkt = CreatePhysicsPacket(reg, bus, time->fixedDt);
+  const uint32_t stepCommands = bus->head;
+  PROFILE_START(PROF_PHYSICS);
+  while (timeSystem_ConsumeFixedStep(time)) {
+    TimerSystem_Advance(*bus);
+    PhysicsSystem_Update(&physicsPkt);
+    Replay_OnFixedStep();
+    StateHash_Step(*reg, time->frameIndex);
+  }
+  PROFILE_END(PROF_PHYSICS);
+
+  EntitySystem_UpdateSince(&entityPkt, stepCommands);
+
+  animPacket animPkt = CreateAnimPacket(reg, bus, time->gameDt);
+  PROFILE_START(PROF_ANIMATION);
+  AnimationSystem_Update(&animPkt);
+  PROFILE_END(PROF_ANIMATION);
+
+  tweenPacket tweenPkt = CreateTweenPacket(reg, time->gameDt);
+  PROFILE_START(PROF_TWEEN);
+  TweenSystem_Update(&tweenPkt);
+  PROFILE_END(PROF_TWEEN);
+
+  transformPacket xformPkt = CreateTransformPacket(reg, bus);
+  PROFILE_START(PROF_TRANSFORM);
+  TransformSystem_Update(&xformPkt);
+  PROFILE_END(PROF_TRANSFORM);
+
+  // Camera follow moves camera entities, which the state hash covers
+  PROFILE_START(PROF_CAMERA);
+  cameraPacket camPkt = CreateCameraPacket(reg, bus, time->gameDt);
+  cameraSystem_Update(&camPkt);
+  PROFILE_END(PROF_CAMERA);
+
+  // CPU light map (headless tests, server-side visibility of lights)
+  PROFILE_START(PROF_LIGHT);
+  LightSystem_Update(*reg);
+  PROFILE_END(PROF_LIGHT);
+
+  // Phase 4: Cleanup (no render phase, commands for render/audio/camera are
+  // simply flushed)
+  PROFILE_START(PROF_CLEANUP);
+#ifndef NDEBUG
+  bus->current_phase = BUS_PHASE_OPEN;
+#endif
+  uint32_t flush_end = bus->consumed_end;
+  if ((flush_end - bus->tail) > (bus->head - bus->tail)) {
+    flush_end = bus->tail;
+  }
+  CommandIterator iter = {.current = bus->tail, .end = flush_end};
+  CommandBus_Flush(*bus, &iter);
+  arena_Clear(&ctx.frameArena);
+  PROFILE_END(PROF_CLEANUP);
+
+  if (replaying)
+    Replay_EndFrame(Platform_GetTime() - tickStart);
+}
+
+void EngineHeadless_Shutdown(EngineContext &ctx) {
+  Log(LogLevel::Info, "Headless engine shutting down...");
+  SceneManager_Shutdown(*ctx.reg, *ctx.bus);
+  EntityManager_Shutdown(*ctx.reg);
+  StateHash_Shutdown();
+  Log(LogLevel::Info, "Headless engine shutdown complete.");
+  Logger_Shutdown();
+}
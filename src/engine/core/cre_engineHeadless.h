@@ -0,0 +1,29 @@
+/**
+ * @file cre_engineHeadless.h
+ * @brief Headless Engine Loop (server / batch simulation)
+ *
+ * Runs the simulation half of the engine: scene logic, ECS, AI, physics,
+ * animation, camera follow and the command bus. No raylib, window, renderer
+ * or audio. Every tick advances exactly one fixed step and is not
+ * throttled, so the caller decides the tick rate. During replay playback
+ * (cre_replay.h) a tick is one recorded frame instead, with its delta and
+ * input.
+ */
+
+#ifndef CRE_ENGINEHEADLESS_H
+#define CRE_ENGINEHEADLESS_H
+
+// Forward Declaration
+struct EngineContext;
+
+void EngineHeadless_Init(EngineContext &ctx);
+
+/**
+ * @brief Run one fixed simulation step (Phase 1, 2 and 4 of Engine_Run),
+ * or one recorded frame while a replay plays.
+ */
+void EngineHeadless_Tick(EngineContext &ctx);
+
+void EngineHeadless_Shutdown(EngineContext &ctx);
+
+#endif
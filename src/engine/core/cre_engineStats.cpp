@@ -0,0 +1,42 @@
+#include "cre_engineStats.h"
+#include "engine/ecs/cre_entityRegistry.h"
+
+EngineStats EngineStats_Get(const EntityRegistry &reg) {
+  const EntityCounters &c = reg.counters;
+  return EngineStats{.active = c.active,
+                     .physics = c.physics,
+                     .statics = c.statics,
+                     .sleeping = c.sleeping,
+                     .culled = c.culled,
+                     .awake = c.active - c.dormant};
+}
+
+EngineStats EngineStats_Recount(const EntityRegistry &reg) {
+  EngineStats stats = {.active = 0,
+                       .physics = 0,
+                       .statics = 0,
+                       .sleeping = 0,
+                       .culled = 0,
+                       .awake = 0};
+
+  const uint32_t bound = reg.max_used_bound;
+  for (uint32_t i = 0; i < bound; i++) {
+    const uint64_t flags = reg.state_flags[i];
+    if (!(flags & FLAG_ACTIVE))
+      continue;
+
+    stats.active++;
+    stats.physics += (reg.component_masks[i] & COMP_PHYSICS) ? 1u : 0u;
+    stats.statics += (flags & FLAG_STATIC) ? 1u : 0u;
+    stats.sleeping += (flags & FLAG_SLEEPING) ? 1u : 0u;
+    stats.culled += (flags & FLAG_CULLED) ? 1u : 0u;
+    stats.awake += (flags & (FLAG_SLEEPING | FLAG_CULLED)) ? 0u : 1u;
+  }
+  return stats;
+}
+
+bool EngineStats_Equal(const EngineStats &a, const EngineStats &b) {
+  return a.active == b.active && a.physics == b.physics &&
+         a.statics == b.statics && a.sleeping == b.sleeping &&
+         a.culled == b.culled && a.awake == b.awake;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file cre_engineStats.h
+ * @brief Entity Counts for the HUD, Profiler and Benchmarks
+ *
+ * Read from the counters the registry keeps up to date
+ * (EntityRegistry::counters), so getting them is O(1). EngineStats_Recount
+ * is the full-scan reference, used by benchmarks to check the counters.
+ */
+
+#ifndef CRE_ENGINESTATS_H
+#define CRE_ENGINESTATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct EntityRegistry;
+
+struct EngineStats {
+  uint32_t active;   // Alive entities
+  uint32_t physics;  // Alive with COMP_PHYSICS
+  uint32_t statics;  // FLAG_STATIC
+  uint32_t sleeping; // FLAG_SLEEPING
+  uint32_t culled;   // FLAG_CULLED
+  uint32_t awake;    // Neither sleeping nor culled
+};
+
+/**
+ * @brief Current counts (no registry scan).
+ */
+EngineStats EngineStats_Get(const EntityRegistry &reg);
+
+/**
+ * @brief Same counts from a full pass over [0, max_used_bound).
+ */
+EngineStats EngineStats_Recount(const EntityRegistry &reg);
+
+bool EngineStats_Equal(const EngineStats &a, const EngineStats &b);
+
+#endif
@@ -0,0 +1,46 @@
+#include "cre_random.h"
+#include "cre_simState.h"
+
+// PCG32 (XSH RR), fixed increment.
+static constexpr uint64_t PCG_MULTIPLIER = 6364136223846793005ULL;
+static constexpr uint64_t PCG_INCREMENT = 1442695040888963407ULL;
+
+static uint64_t s_state = 0;
+static uint64_t s_seed = 0;
+
+void Random_Seed(uint64_t seed) {
+  s_seed = seed;
+  s_state = 0;
+  Random_Next();
+  s_state += seed;
+  Random_Next();
+}
+
+uint64_t Random_GetSeed(void) { return s_seed; }
+
+uint32_t Random_Next(void) {
+  const uint64_t old = s_state;
+  s_state = old * PCG_MULTIPLIER + PCG_INCREMENT;
+  const uint32_t xorshifted =
+      static_cast<uint32_t>(((old >> 18U) ^ old) >> 27U);
+  const uint32_t rot = static_cast<uint32_t>(old >> 59U);
+  return (xorshifted >> rot) | (xorshifted << ((32U - rot) & 31U));
+}
+
+int32_t Random_Range(int32_t min, int32_t max) {
+  if (max < min) {
+    const int32_t tmp = min;
+    min = max;
+    max = tmp;
+  }
+  const uint64_t span =
+      static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1U;
+  // Multiply-shift keeps the bias negligible for gameplay ranges.
+  const uint64_t r = (static_cast<uint64_t>(Random_Next()) * span) >> 32U;
+  return static_cast<int32_t>(static_cast<int64_t>(min) +
+                              static_cast<int64_t>(r));
+}
+
+void Random_GetSimState(SimStateBlock *out) {
+  *out = {.name = "random", .base = &s_state, .size = sizeof(s_state)};
+}
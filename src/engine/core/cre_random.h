@@ -0,0 +1,42 @@
+/**
+ * @file cre_random.h
+ * @brief Seeded Gameplay RNG (PCG32)
+ *
+ * Single global generator for gameplay randomness. Unlike raylib's
+ * GetRandomValue the seed is owned by the engine, so recordings can store
+ * it and replays reproduce every spawn position.
+ */
+
+#ifndef CRE_RANDOM_H
+#define CRE_RANDOM_H
+
+#include <stdint.h>
+
+struct SimStateBlock;
+
+/**
+ * @brief Reset the generator state from a seed.
+ */
+void Random_Seed(uint64_t seed);
+
+/**
+ * @brief Seed passed to the last Random_Seed call.
+ */
+uint64_t Random_GetSeed(void);
+
+/**
+ * @brief Next raw 32-bit value.
+ */
+uint32_t Random_Next(void);
+
+/**
+ * @brief Uniform integer in [min, max] (inclusive, like GetRandomValue).
+ */
+int32_t Random_Range(int32_t min, int32_t max);
+
+/**
+ * @brief Generator state, for rollback (see cre_simState.h).
+ */
+void Random_GetSimState(SimStateBlock *out);
+
+#endif
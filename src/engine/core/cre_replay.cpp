@@ -0,0 +1,326 @@
+#include "cre_replay.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_random.h"
+#include "engine/core/cre_types.h"
+#include "engine/platform/cre_input.h"
+#include "engine/platform/cre_time.h"
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static constexpr char REPLAY_MAGIC[4] = {'C', 'R', 'R', 'P'};
+static constexpr uint16_t REPLAY_VERSION = 1;
+static constexpr uint32_t REPLAY_HEADER_SIZE = 24;
+static constexpr uint32_t REPLAY_FRAME_SIZE = 9;
+static constexpr uint32_t REPLAY_FRAMECOUNT_OFFSET = 20;
+
+static_assert(ACTION_COUNT <= 16, "Replay frames store actions as u16");
+
+enum ReplayMode : uint8_t {
+  REPLAY_MODE_NONE = 0,
+  REPLAY_MODE_RECORD,
+  REPLAY_MODE_PLAY,
+};
+
+struct ReplayFrame {
+  float dt;
+  uint16_t down;
+  uint16_t pressed;
+  uint8_t fixedSteps;
+};
+
+static ReplayMode s_mode = REPLAY_MODE_NONE;
+static const char *s_path = nullptr;
+static const char *s_timingsPath = nullptr;
+static uint32_t s_frameLimit = 0;   // --frames, 0 = unlimited
+
+static FILE *s_file = nullptr;      // Recording output
+static ReplayFrame s_current = {};  // Frame being recorded/played
+static uint32_t s_frameCount = 0;   // Recorded frames / total replay frames
+static uint32_t s_frameIndex = 0;   // Playback cursor
+static uint32_t s_fixedSteps = 0;   // Steps executed this frame
+static bool s_diverged = false;
+
+static ReplayFrame *s_frames = nullptr; // Playback frames
+static float *s_frameMs = nullptr;      // Playback CPU time per frame
+
+// ============================================================================
+// Serialization (field by field, no struct padding in the file)
+// ============================================================================
+
+static void WriteBytes(uint8_t *restrict dst, uint32_t *offset,
+                       const void *src, uint32_t size) {
+  memcpy(dst + *offset, src, size);
+  *offset += size;
+}
+
+static void ReadBytes(const uint8_t *restrict src, uint32_t *offset,
+                      void *dst, uint32_t size) {
+  memcpy(dst, src + *offset, size);
+  *offset += size;
+}
+
+static bool Replay_OpenRecording(TimeContext *time) {
+  s_file = fopen(s_path, "wb");
+  if (!s_file) {
+    Log(LogLevel::Error, "[REPLAY] Cannot open '{}' for recording", s_path);
+    return false;
+  }
+
+  uint8_t header[REPLAY_HEADER_SIZE];
+  uint32_t offset = 0;
+  const uint16_t actionCount = ACTION_COUNT;
+  const uint64_t seed = Random_GetSeed();
+  const uint32_t frameCount = 0; // Patched in Replay_Shutdown
+  WriteBytes(header, &offset, REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+  WriteBytes(header, &offset, &REPLAY_VERSION, sizeof(REPLAY_VERSION));
+  WriteBytes(header, &offset, &actionCount, sizeof(actionCount));
+  WriteBytes(header, &offset, &seed, sizeof(seed));
+  WriteBytes(header, &offset, &time->fixedDt, sizeof(time->fixedDt));
+  WriteBytes(header, &offset, &frameCount, sizeof(frameCount));
+
+  fwrite(header, 1, REPLAY_HEADER_SIZE, s_file);
+  Log(LogLevel::Info, "[REPLAY] Recording to '{}' (seed {})", s_path, seed);
+  return true;
+}
+
+static bool Replay_LoadPlayback(TimeContext *time) {
+  FILE *file = fopen(s_path, "rb");
+  if (!file) {
+    Log(LogLevel::Error, "[REPLAY] Cannot open replay '{}'", s_path);
+    return false;
+  }
+
+  fseek(file, 0, SEEK_END);
+  const long fileSize = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  if (fileSize < static_cast<long>(REPLAY_HEADER_SIZE)) {
+    Log(LogLevel::Error, "[REPLAY] '{}' is too small", s_path);
+    fclose(file);
+    return false;
+  }
+
+  uint8_t *data = static_cast<uint8_t *>(malloc(static_cast<size_t>(fileSize)));
+  const size_t readSize =
+      data ? fread(data, 1, static_cast<size_t>(fileSize), file) : 0;
+  fclose(file);
+  if (readSize != static_cast<size_t>(fileSize)) {
+    Log(LogLevel::Error, "[REPLAY] Failed to read '{}'", s_path);
+    free(data);
+    return false;
+  }
+
+  uint32_t offset = 0;
+  char magic[4];
+  uint16_t version = 0;
+  uint16_t actionCount = 0;
+  uint64_t seed = 0;
+  float fixedDt = 0.0f;
+  uint32_t frameCount = 0;
+  ReadBytes(data, &offset, magic, sizeof(magic));
+  ReadBytes(data, &offset, &version, sizeof(version));
+  ReadBytes(data, &offset, &actionCount, sizeof(actionCount));
+  ReadBytes(data, &offset, &seed, sizeof(seed));
+  ReadBytes(data, &offset, &fixedDt, sizeof(fixedDt));
+  ReadBytes(data, &offset, &frameCount, sizeof(frameCount));
+
+  if (memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 ||
+      version != REPLAY_VERSION || actionCount != ACTION_COUNT) {
+    Log(LogLevel::Error,
+        "[REPLAY] '{}' is not a compatible replay (version {}, {} actions)",
+        s_path, version, actionCount);
+    free(data);
+    return false;
+  }
+
+  // Tolerate recordings cut short by a crash: trust the payload size.
+  const uint32_t storedFrames = static_cast<uint32_t>(
+      (static_cast<uint32_t>(fileSize) - REPLAY_HEADER_SIZE) /
+      REPLAY_FRAME_SIZE);
+  if (frameCount == 0 || frameCount > storedFrames) {
+    frameCount = storedFrames;
+  }
+
+  s_frames =
+      static_cast<ReplayFrame *>(malloc(sizeof(ReplayFrame) * (frameCount + 1)));
+  s_frameMs = static_cast<float *>(malloc(sizeof(float) * (frameCount + 1)));
+  if (!s_frames || !s_frameMs) {
+    Log(LogLevel::Error, "[REPLAY] Out of memory for {} frames", frameCount);
+    free(data);
+    return false;
+  }
+
+  for (uint32_t i = 0; i < frameCount; i++) {
+    ReplayFrame &f = s_frames[i];
+    ReadBytes(data, &offset, &f.dt, sizeof(f.dt));
+    ReadBytes(data, &offset, &f.down, sizeof(f.down));
+    ReadBytes(data, &offset, &f.pressed, sizeof(f.pressed));
+    ReadBytes(data, &offset, &f.fixedSteps, sizeof(f.fixedSteps));
+  }
+  free(data);
+
+  s_frameCount = frameCount;
+  timeSystem_SetFixedDt(time, fixedDt);
+  Random_Seed(seed);
+  Log(LogLevel::Info, "[REPLAY] Playing '{}': {} frames (seed {})", s_path,
+      frameCount, seed);
+  return true;
+}
+
+static void Replay_WriteFrame(const ReplayFrame &f) {
+  uint8_t buffer[REPLAY_FRAME_SIZE];
+  uint32_t offset = 0;
+  WriteBytes(buffer, &offset, &f.dt, sizeof(f.dt));
+  WriteBytes(buffer, &offset, &f.down, sizeof(f.down));
+  WriteBytes(buffer, &offset, &f.pressed, sizeof(f.pressed));
+  WriteBytes(buffer, &offset, &f.fixedSteps, sizeof(f.fixedSteps));
+  fwrite(buffer, 1, REPLAY_FRAME_SIZE, s_file);
+  s_frameCount++;
+}
+
+static void Replay_Report(void) {
+  const uint32_t count = s_frameIndex;
+  if (count == 0)
+    return;
+
+  if (s_timingsPath) {
+    FILE *csv = fopen(s_timingsPath, "w");
+    if (csv) {
+      fprintf(csv, "frame,dt_ms,fixed_steps,frame_ms\n");
+      for (uint32_t i = 0; i < count; i++) {
+        fprintf(csv, "%u,%.4f,%u,%.4f\n", i,
+                static_cast<double>(s_frames[i].dt) * 1000.0,
+                s_frames[i].fixedSteps, static_cast<double>(s_frameMs[i]));
+      }
+      fclose(csv);
+      Log(LogLevel::Info, "[REPLAY] Frame timings written to '{}'",
+          s_timingsPath);
+    } else {
+      Log(LogLevel::Error, "[REPLAY] Cannot write timings '{}'",
+          s_timingsPath);
+    }
+  }
+
+  double sum = 0.0;
+  for (uint32_t i = 0; i < count; i++) {
+    sum += static_cast<double>(s_frameMs[i]);
+  }
+  // Sorting in place is fine, the CSV is already written.
+  std::sort(s_frameMs, s_frameMs + count);
+  const uint32_t p99 = std::min(count - 1, (count * 99) / 100);
+  Log(LogLevel::Info,
+      "[REPLAY] {} frames | avg {:.3f} ms | p99 {:.3f} ms | max {:.3f} ms",
+      count, sum / count, s_frameMs[p99], s_frameMs[count - 1]);
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void Replay_Init(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const bool hasValue = (i + 1) < argc;
+    if (strcmp(argv[i], "--record") == 0 && hasValue) {
+      s_mode = REPLAY_MODE_RECORD;
+      s_path = argv[++i];
+    } else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+      s_mode = REPLAY_MODE_PLAY;
+      s_path = argv[++i];
+    } else if (strcmp(argv[i], "--timings") == 0 && hasValue) {
+      s_timingsPath = argv[++i];
+    } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+      s_frameLimit = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    }
+  }
+}
+
+void Replay_Start(TimeContext *time) {
+  // Normal and recorded sessions get a fresh seed, replays use the stored one.
+  Random_Seed(static_cast<uint64_t>(::time(nullptr)) * 0x9E3779B97F4A7C15ULL);
+
+  bool ok = true;
+  if (s_mode == REPLAY_MODE_RECORD) {
+    ok = Replay_OpenRecording(time);
+  } else if (s_mode == REPLAY_MODE_PLAY) {
+    ok = Replay_LoadPlayback(time);
+  }
+  if (!ok) {
+    s_mode = REPLAY_MODE_NONE;
+  } else if (s_mode == REPLAY_MODE_PLAY && s_frameLimit != 0 &&
+             s_frameLimit < s_frameCount) {
+    s_frameCount = s_frameLimit;
+  }
+}
+
+void Replay_Shutdown(void) {
+  if (s_mode == REPLAY_MODE_RECORD && s_file) {
+    fseek(s_file, REPLAY_FRAMECOUNT_OFFSET, SEEK_SET);
+    fwrite(&s_frameCount, sizeof(s_frameCount), 1, s_file);
+    fclose(s_file);
+    s_file = nullptr;
+    Log(LogLevel::Info, "[REPLAY] Recorded {} frames to '{}'", s_frameCount,
+        s_path);
+  } else if (s_mode == REPLAY_MODE_PLAY) {
+    Replay_Report();
+    free(s_frames);
+    free(s_frameMs);
+    s_frames = nullptr;
+    s_frameMs = nullptr;
+  }
+  s_mode = REPLAY_MODE_NONE;
+}
+
+bool Replay_IsPlaying(void) { return s_mode == REPLAY_MODE_PLAY; }
+
+bool Replay_IsRecording(void) { return s_mode == REPLAY_MODE_RECORD; }
+
+bool Replay_IsFinished(void) {
+  if (s_mode == REPLAY_MODE_PLAY)
+    return s_frameIndex >= s_frameCount;
+  if (s_mode == REPLAY_MODE_RECORD)
+    return s_frameLimit != 0 && s_frameCount >= s_frameLimit;
+  return false;
+}
+
+void Replay_BeginFrame(TimeContext *time) {
+  s_fixedSteps = 0;
+  if (s_mode == REPLAY_MODE_PLAY) {
+    s_current = s_frames[s_frameIndex];
+    timeSystem_Advance(time, s_current.dt);
+    return;
+  }
+
+  timeSystem_Update(time);
+  s_current.dt = time->realDt;
+}
+
+void Replay_ProcessInput(void) {
+  if (s_mode == REPLAY_MODE_PLAY) {
+    Input_SetFrame(InputFrame{.down = s_current.down,
+                              .pressed = s_current.pressed});
+  } else if (s_mode == REPLAY_MODE_RECORD) {
+    const InputFrame frame = Input_GetFrame();
+    s_current.down = static_cast<uint16_t>(frame.down);
+    s_current.pressed = static_cast<uint16_t>(frame.pressed);
+  }
+}
+
+void Replay_OnFixedStep(void) { s_fixedSteps++; }
+
+void Replay_EndFrame(double frameSeconds) {
+  if (s_mode == REPLAY_MODE_RECORD) {
+    s_current.fixedSteps = static_cast<uint8_t>(std::min(s_fixedSteps, 255U));
+    Replay_WriteFrame(s_current);
+  } else if (s_mode == REPLAY_MODE_PLAY) {
+    if (!s_diverged && s_fixedSteps != s_current.fixedSteps) {
+      s_diverged = true;
+      Log(LogLevel::Warning,
+          "[REPLAY] Diverged at frame {}: {} fixed steps, recorded {}",
+          s_frameIndex, s_fixedSteps, s_current.fixedSteps);
+    }
+    s_frameMs[s_frameIndex] = static_cast<float>(frameSeconds * 1000.0);
+    s_frameIndex++;
+  }
+}
@@ -0,0 +1,75 @@
+/**
+ * @file cre_replay.h
+ * @brief Input Recording & Deterministic Replay
+ *
+ * Recording (--record <file>) captures, per rendered frame, the clamped real
+ * delta, the action snapshot (cre_input.h) and the number of fixed steps run.
+ * The header stores the RNG seed and fixed step, so a replay
+ * (--replay <file>) reproduces the session exactly: same seed, same deltas,
+ * same inputs. Playback runs in a hidden window without frame limiting and
+ * reports per-frame CPU time (--timings <csv> writes every frame).
+ * CRayEngine_Server --replay plays the same file headless, through
+ * EngineHeadless_Tick (one recorded frame per tick).
+ * --frames <n> stops a recording (or truncates a replay) after n frames.
+ *
+ * File layout (little endian):
+ *   Header: "CRRP" | u16 version | u16 actionCount | u64 seed |
+ *           f32 fixedDt | u32 frameCount
+ *   Frame:  f32 dt | u16 down | u16 pressed | u8 fixedSteps
+ */
+
+#ifndef CRE_REPLAY_H
+#define CRE_REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct TimeContext;
+
+/**
+ * @brief Parse replay options from the command line (before Engine_Init).
+ */
+void Replay_Init(int argc, char **argv);
+
+/**
+ * @brief Seed the RNG and open the recording / load the replay.
+ * Called by Engine_Init after the time context exists.
+ */
+void Replay_Start(TimeContext *time);
+
+/**
+ * @brief Finalize the recording or print the timing report.
+ */
+void Replay_Shutdown(void);
+
+bool Replay_IsPlaying(void);
+bool Replay_IsRecording(void);
+
+/**
+ * @brief True once every recorded frame was played back, or the recording
+ * reached its --frames limit. Ends Engine_Run.
+ */
+bool Replay_IsFinished(void);
+
+/**
+ * @brief Advance time for this frame (Phase 0).
+ * Playback feeds the recorded delta, otherwise the wall clock is used.
+ */
+void Replay_BeginFrame(TimeContext *time);
+
+/**
+ * @brief Capture or inject the action snapshot (Phase 1, after Input_Poll).
+ */
+void Replay_ProcessInput(void);
+
+/**
+ * @brief Count one executed fixed step (Phase 2).
+ */
+void Replay_OnFixedStep(void);
+
+/**
+ * @brief Close the frame: write it, or verify it and store its CPU time.
+ */
+void Replay_EndFrame(double frameSeconds);
+
+#endif
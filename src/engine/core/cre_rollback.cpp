@@ -0,0 +1,258 @@
+#include "cre_rollback.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
+#include "engine/memory/cre_arena.h"
+#include <string.h>
+
+/**
+ * @brief Undo record of one saved tick: its pages in the pool are the
+ * contents they had at tick - 1.
+ */
+struct RollbackTick {
+  uint32_t tick;
+  uint32_t firstSlot; // Monotonic pool slot
+  uint32_t count;
+};
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+// Page table (live address + byte size, the last page of a block is short)
+static uint8_t **s_pageBase = nullptr;
+static uint32_t *s_pageSize = nullptr;
+static uint32_t s_pageCount = 0;
+
+// Full copy of the head tick
+static uint8_t *s_head = nullptr;
+
+// Undo pool: FIFO of pages, slots are monotonic (slot % s_poolPages)
+static uint8_t *s_pool = nullptr;
+static uint32_t *s_poolPage = nullptr;
+static uint32_t s_poolPages = 0;
+static uint32_t s_slotHead = 0;
+static uint32_t s_slotTail = 0;
+
+// Undo ring, oldest at s_tickFirst
+static RollbackTick s_ticks[ROLLBACK_MAX_TICKS];
+static uint32_t s_tickFirst = 0;
+static uint32_t s_tickCount = 0;
+static uint32_t s_maxTicks = 0;
+
+static uint32_t s_headTick = 0;
+static bool s_hasHead = false;
+static bool s_ready = false;
+static RollbackStats s_stats = {};
+
+static inline uint8_t *HeadPage(uint32_t page) {
+  return s_head + static_cast<size_t>(page) * ROLLBACK_PAGE_BYTES;
+}
+
+static inline uint8_t *PoolPage(uint32_t slot) {
+  return s_pool + static_cast<size_t>(slot % s_poolPages) * ROLLBACK_PAGE_BYTES;
+}
+
+static void Rollback_DropOldest(void) {
+  s_slotTail += s_ticks[s_tickFirst].count;
+  s_tickFirst = (s_tickFirst + 1) % ROLLBACK_MAX_TICKS;
+  s_tickCount--;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool Rollback_Init(Arena *arena, uint32_t maxTicks, uint32_t poolPages) {
+  s_ready = false;
+  s_hasHead = false;
+
+  const uint32_t blockCount = SimState_GetBlockCount();
+  const SimStateBlock *blocks = SimState_GetBlocks();
+  uint32_t pages = 0;
+  for (uint32_t b = 0; b < blockCount; b++) {
+    pages += static_cast<uint32_t>((blocks[b].size + ROLLBACK_PAGE_BYTES - 1) /
+                                   ROLLBACK_PAGE_BYTES);
+  }
+  if (pages == 0 || poolPages == 0) {
+    Log(LogLevel::Error, "Rollback_Init: Nothing to track");
+    return false;
+  }
+
+  s_pageBase = arena_Push<uint8_t *>(arena, pages);
+  s_pageSize = arena_Push<uint32_t>(arena, pages);
+  s_head = arena_Push<uint8_t>(
+      arena, static_cast<size_t>(pages) * ROLLBACK_PAGE_BYTES, 64);
+  s_pool = arena_Push<uint8_t>(
+      arena, static_cast<size_t>(poolPages) * ROLLBACK_PAGE_BYTES, 64);
+  s_poolPage = arena_Push<uint32_t>(arena, poolPages);
+  if (!s_pageBase || !s_pageSize || !s_head || !s_pool || !s_poolPage) {
+    Log(LogLevel::Error, "Rollback_Init: Arena too small for {} + {} pages",
+        pages, poolPages);
+    return false;
+  }
+
+  uint32_t page = 0;
+  for (uint32_t b = 0; b < blockCount; b++) {
+    uint8_t *base = static_cast<uint8_t *>(blocks[b].base);
+    for (size_t offset = 0; offset < blocks[b].size;
+         offset += ROLLBACK_PAGE_BYTES) {
+      const size_t remaining = blocks[b].size - offset;
+      s_pageBase[page] = base + offset;
+      s_pageSize[page] = static_cast<uint32_t>(
+          (remaining < ROLLBACK_PAGE_BYTES) ? remaining : ROLLBACK_PAGE_BYTES);
+      page++;
+    }
+  }
+
+  s_pageCount = pages;
+  s_poolPages = poolPages;
+  s_maxTicks = (maxTicks == 0)                   ? 1
+               : (maxTicks > ROLLBACK_MAX_TICKS) ? ROLLBACK_MAX_TICKS
+                                                 : maxTicks;
+  s_ready = true;
+  Rollback_Reset();
+
+  Log(LogLevel::Info,
+      "Rollback Initialized ({} blocks, {} pages / {} KB, {} ticks, "
+      "{} KB undo pool)",
+      blockCount, pages,
+      (static_cast<size_t>(pages) * ROLLBACK_PAGE_BYTES) / 1024, s_maxTicks,
+      (static_cast<size_t>(poolPages) * ROLLBACK_PAGE_BYTES) / 1024);
+  return true;
+}
+
+void Rollback_Reset(void) {
+  s_hasHead = false;
+  s_slotHead = 0;
+  s_slotTail = 0;
+  s_tickFirst = 0;
+  s_tickCount = 0;
+  s_stats = {.pages = s_pageCount,
+             .poolPages = s_poolPages,
+             .usedPages = 0,
+             .savedTicks = 0,
+             .lastDirtyPages = 0,
+             .lastRestoredPages = 0,
+             .evictedTicks = 0};
+}
+
+void Rollback_Save(uint32_t tick) {
+  if (!s_ready)
+    return;
+
+  // First save, or a gap: start the history over from a full copy
+  if (!s_hasHead || tick != s_headTick + 1) {
+    for (uint32_t p = 0; p < s_pageCount; p++) {
+      memcpy(HeadPage(p), s_pageBase[p], s_pageSize[p]);
+    }
+    s_slotHead = 0;
+    s_slotTail = 0;
+    s_tickFirst = 0;
+    s_tickCount = 0;
+    s_headTick = tick;
+    s_hasHead = true;
+    s_stats.lastDirtyPages = s_pageCount;
+    return;
+  }
+
+  if (s_tickCount == s_maxTicks) {
+    Rollback_DropOldest();
+  }
+
+  RollbackTick entry = {.tick = tick, .firstSlot = s_slotHead, .count = 0};
+  bool overflow = false;
+  uint32_t dirty = 0;
+
+  for (uint32_t p = 0; p < s_pageCount; p++) {
+    uint8_t *live = s_pageBase[p];
+    uint8_t *head = HeadPage(p);
+    const uint32_t size = s_pageSize[p];
+    if (memcmp(live, head, size) == 0)
+      continue;
+
+    if (!overflow) {
+      // Make room by forgetting the oldest ticks first
+      while (s_slotHead - s_slotTail >= s_poolPages && s_tickCount > 0) {
+        Rollback_DropOldest();
+        s_stats.evictedTicks++;
+      }
+      if (s_slotHead - s_slotTail >= s_poolPages) {
+        overflow = true; // This tick alone does not fit
+      } else {
+        const uint32_t slot = s_slotHead++;
+        memcpy(PoolPage(slot), head, size);
+        s_poolPage[slot % s_poolPages] = p;
+        entry.count++;
+      }
+    }
+    memcpy(head, live, size);
+    dirty++;
+  }
+
+  if (overflow) {
+    Log(LogLevel::Warning,
+        "Rollback_Save: Tick {} changed {} pages (pool {}), history reset",
+        tick, dirty, s_poolPages);
+    s_slotTail = s_slotHead;
+    s_tickFirst = 0;
+    s_tickCount = 0;
+  } else {
+    s_ticks[(s_tickFirst + s_tickCount) % ROLLBACK_MAX_TICKS] = entry;
+    s_tickCount++;
+  }
+
+  s_headTick = tick;
+  s_stats.lastDirtyPages = dirty;
+}
+
+bool Rollback_CanRestore(uint32_t tick) {
+  return s_ready && s_hasHead && tick <= s_headTick &&
+         (s_headTick - tick) <= s_tickCount;
+}
+
+bool Rollback_Restore(uint32_t tick) {
+  if (!Rollback_CanRestore(tick))
+    return false;
+
+  uint32_t restored = 0;
+
+  // Undo whatever ran since the last save
+  for (uint32_t p = 0; p < s_pageCount; p++) {
+    uint8_t *live = s_pageBase[p];
+    const uint8_t *head = HeadPage(p);
+    const uint32_t size = s_pageSize[p];
+    if (memcmp(live, head, size) != 0) {
+      memcpy(live, head, size);
+      restored++;
+    }
+  }
+
+  // Walk the undo ring back, newest first
+  while (s_headTick != tick) {
+    const uint32_t last = (s_tickFirst + s_tickCount - 1) % ROLLBACK_MAX_TICKS;
+    const RollbackTick &entry = s_ticks[last];
+    for (uint32_t k = 0; k < entry.count; k++) {
+      const uint32_t slot = entry.firstSlot + k;
+      const uint32_t p = s_poolPage[slot % s_poolPages];
+      const uint8_t *src = PoolPage(slot);
+      memcpy(s_pageBase[p], src, s_pageSize[p]);
+      memcpy(HeadPage(p), src, s_pageSize[p]);
+    }
+    restored += entry.count;
+    s_slotHead -= entry.count;
+    s_tickCount--;
+    s_headTick--;
+  }
+
+  s_stats.lastRestoredPages = restored;
+  return true;
+}
+
+uint32_t Rollback_GetHeadTick(void) { return s_headTick; }
+
+RollbackStats Rollback_GetStats(void) {
+  RollbackStats stats = s_stats;
+  stats.usedPages = s_slotHead - s_slotTail;
+  stats.savedTicks = s_tickCount;
+  return stats;
+}
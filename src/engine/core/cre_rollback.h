@@ -0,0 +1,80 @@
+/**
+ * @file cre_rollback.h
+ * @brief Per-Tick Save/Restore of the Simulation State (Delta Pages)
+ *
+ * The blocks in cre_simState.h are split into ROLLBACK_PAGE_BYTES pages.
+ * Rollback keeps one full copy of the last saved tick (the head) plus an
+ * undo ring: saving tick T compares every live page with the head, and for
+ * each page that changed stores the head's old contents before updating it.
+ * A saved tick therefore costs one compare pass plus a copy of the pages it
+ * actually touched (at 4k entities only a fraction of the registry columns
+ * change per tick).
+ *
+ * Restoring tick K reverts the live state to the head (changed pages only),
+ * then applies the undo pages of ticks head..K+1 newest first. Ticks after K
+ * are dropped; re-simulating saves them again.
+ *
+ *   Rollback_Save(tick)          after every simulated tick
+ *   Rollback_Restore(oldTick)    on a late input, then re-tick + save
+ *
+ * Call Rollback_Init after SimState_RegisterEngine (and any game blocks).
+ */
+
+#ifndef CRE_ROLLBACK_H
+#define CRE_ROLLBACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct Arena;
+
+constexpr uint32_t ROLLBACK_PAGE_BYTES = 4096;
+constexpr uint32_t ROLLBACK_MAX_TICKS = 64;
+
+struct RollbackStats {
+  uint32_t pages;             // Pages tracked (all blocks)
+  uint32_t poolPages;         // Undo page capacity
+  uint32_t usedPages;         // Undo pages currently held
+  uint32_t savedTicks;        // Restorable ticks behind the head
+  uint32_t lastDirtyPages;    // Pages stored by the last save
+  uint32_t lastRestoredPages; // Pages written by the last restore
+  uint32_t evictedTicks;      // Dropped early because the pool was full
+};
+
+/**
+ * @brief Build the page table from the current SimState blocks and allocate
+ * the head copy and undo pool from the arena.
+ *
+ * @param maxTicks  Restorable ticks behind the head (<= ROLLBACK_MAX_TICKS)
+ * @param poolPages Undo page capacity shared by those ticks
+ * @return false if the arena is too small
+ */
+bool Rollback_Init(Arena *arena, uint32_t maxTicks, uint32_t poolPages);
+
+/**
+ * @brief Forget every saved tick. The next save copies the full state.
+ */
+void Rollback_Reset(void);
+
+/**
+ * @brief Save the live state as `tick`. Ticks must be consecutive; any other
+ * value resets the history and starts over from this tick.
+ */
+void Rollback_Save(uint32_t tick);
+
+/**
+ * @brief Restore the live state to a saved tick.
+ * @return false if the tick is not in the history (state left untouched)
+ */
+bool Rollback_Restore(uint32_t tick);
+
+bool Rollback_CanRestore(uint32_t tick);
+
+/**
+ * @brief Last saved tick (the head). Only valid after a save.
+ */
+uint32_t Rollback_GetHeadTick(void);
+
+RollbackStats Rollback_GetStats(void);
+
+#endif
@@ -0,0 +1,70 @@
+#include "cre_simState.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_random.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include "engine/systems/ai/cre_aiSystem.h"
+#include "engine/systems/physics/cre_physicsConstraints.h"
+#include "engine/systems/physics/cre_physicsSystem.h"
+#include "engine/systems/physics/cre_spatialHash.h"
+#include "engine/systems/physics/cre_staticGeometry.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+
+static SimStateBlock s_blocks[SIMSTATE_MAX_BLOCKS];
+static uint32_t s_blockCount = 0;
+
+void SimState_Clear(void) { s_blockCount = 0; }
+
+bool SimState_Register(const SimStateBlock &block) {
+  if (!block.base || block.size == 0)
+    return false;
+
+  for (uint32_t i = 0; i < s_blockCount; i++) {
+    if (s_blocks[i].base == block.base) {
+      s_blocks[i] = block;
+      return true;
+    }
+  }
+  if (s_blockCount >= SIMSTATE_MAX_BLOCKS) {
+    Log(LogLevel::Error, "SimState_Register: Table full, '{}' not added",
+        block.name);
+    return false;
+  }
+  s_blocks[s_blockCount++] = block;
+  return true;
+}
+
+void SimState_RegisterEngine(EntityRegistry *reg) {
+  SimState_Clear();
+  SimState_Register({.name = "registry", .base = reg, .size = sizeof(*reg)});
+
+  SimStateBlock block;
+  PhysicsSystem_GetSimState(&block);
+  SimState_Register(block);
+  PhysicsConstraints_GetSimState(&block);
+  SimState_Register(block);
+  SpatialHash_GetSimState(&block);
+  SimState_Register(block);
+  StaticGeometry_GetSimState(&block);
+  SimState_Register(block);
+  aiSystem_GetSimState(&block);
+  SimState_Register(block);
+  Random_GetSimState(&block);
+  SimState_Register(block);
+  TimerSystem_GetSimState(&block);
+  SimState_Register(block);
+  TweenSystem_GetSimState(&block);
+  SimState_Register(block);
+}
+
+uint32_t SimState_GetBlockCount(void) { return s_blockCount; }
+
+const SimStateBlock *SimState_GetBlocks(void) { return s_blocks; }
+
+size_t SimState_GetTotalBytes(void) {
+  size_t total = 0;
+  for (uint32_t i = 0; i < s_blockCount; i++) {
+    total += s_blocks[i].size;
+  }
+  return total;
+}
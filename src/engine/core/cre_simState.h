@@ -0,0 +1,59 @@
+/**
+ * @file cre_simState.h
+ * @brief Simulation State Block Table
+ *
+ * Everything a tick reads from the previous tick, and nothing else:
+ *   - EntityRegistry (components, cameras, free list)
+ *   - physics world (gravity, materials), joint pools + handles
+ *   - spatial hash static layer, compiled static geometry
+ *   - AI time-slice schedule, gameplay RNG, pending timers
+ *   - running tweens (they write pos and rotation)
+ *
+ * Each system keeps its persistent statics in one struct and hands out a
+ * block describing it; per-step scratch (contact rows, solver arrays, the
+ * dynamic spatial layer, AI grouping buffers) is deliberately excluded
+ * because it is rebuilt before it is read. Rollback treats the table as one
+ * contiguous, paged state.
+ *
+ * The table holds pointers only. It must be rebuilt (and rollback
+ * re-initialized) if a block moves, e.g. the registry after an arena reset.
+ */
+
+#ifndef CRE_SIMSTATE_H
+#define CRE_SIMSTATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct EntityRegistry;
+
+constexpr uint32_t SIMSTATE_MAX_BLOCKS = 32;
+
+struct SimStateBlock {
+  const char *name;
+  void *base;
+  size_t size;
+};
+
+/**
+ * @brief Drop every block.
+ */
+void SimState_Clear(void);
+
+/**
+ * @brief Add a block. A block with the same base is replaced.
+ * @return false if the table is full
+ */
+bool SimState_Register(const SimStateBlock &block);
+
+/**
+ * @brief Clear, then register the registry and every engine system block.
+ * Game code may register its own blocks afterwards.
+ */
+void SimState_RegisterEngine(EntityRegistry *reg);
+
+uint32_t SimState_GetBlockCount(void);
+const SimStateBlock *SimState_GetBlocks(void);
+size_t SimState_GetTotalBytes(void);
+
+#endif
@@ -0,0 +1,262 @@
+#include "cre_stateHash.h"
+#include "engine/core/cre_logger.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <stdio.h>
+#include <string.h>
+
+static constexpr uint32_t HASH_PRIME1 = 0x9E3779B1u;
+static constexpr uint32_t HASH_PRIME2 = 0x85EBCA77u;
+static constexpr uint32_t HASH_LANES = 8;
+static constexpr uint32_t HASH_BLOCK = HASH_LANES * sizeof(uint32_t);
+
+static constexpr uint32_t STATE_HASH_ROW_SIZE = 2048;
+
+static const char *s_logPath = nullptr;
+static const char *s_refPath = nullptr;
+static FILE *s_log = nullptr;
+static FILE *s_ref = nullptr;     // Open until it ends or diverges
+static uint32_t s_refMatched = 0; // Steps equal to the reference
+static bool s_refDiverged = false;
+static uint32_t s_lastFrame = UINT32_MAX;
+static uint32_t s_stepInFrame = 0;
+
+// ============================================================================
+// Hash Core
+// ============================================================================
+
+static inline uint32_t Rotl32(uint32_t x, uint32_t r) {
+  return (x << r) | (x >> (32u - r));
+}
+
+static inline uint64_t Mix64(uint64_t h) {
+  h ^= h >> 30;
+  h *= 0xBF58476D1CE4E5B9ULL;
+  h ^= h >> 27;
+  h *= 0x94D049BB133111EBULL;
+  h ^= h >> 31;
+  return h;
+}
+
+uint64_t StateHash_Bytes(const void *data, uint32_t size, uint64_t seed) {
+  const uint8_t *restrict bytes = static_cast<const uint8_t *>(data);
+
+  uint32_t acc[HASH_LANES];
+  for (uint32_t l = 0; l < HASH_LANES; l++) {
+    acc[l] = static_cast<uint32_t>(seed) + HASH_PRIME1 * (l + 1u);
+  }
+
+  // Lanes never depend on each other inside a block
+  const uint32_t blocks = size / HASH_BLOCK;
+  for (uint32_t b = 0; b < blocks; b++) {
+    uint32_t words[HASH_LANES];
+    memcpy(words, bytes + b * HASH_BLOCK, HASH_BLOCK);
+    for (uint32_t l = 0; l < HASH_LANES; l++) {
+      acc[l] = Rotl32(acc[l] + words[l] * HASH_PRIME2, 13) * HASH_PRIME1;
+    }
+  }
+
+  uint64_t h = seed ^ (static_cast<uint64_t>(size) * HASH_PRIME1);
+  for (uint32_t l = 0; l < HASH_LANES; l++) {
+    h = Mix64(h ^ acc[l]);
+  }
+
+  // Tail (< 32 bytes)
+  for (uint32_t i = blocks * HASH_BLOCK; i < size; i++) {
+    h = (h ^ bytes[i]) * 0x100000001B3ULL;
+  }
+  return Mix64(h);
+}
+
+// ============================================================================
+// Registry Columns
+// ============================================================================
+
+// Engine columns, then every game column (cre_gameComponents.h). Each X
+// generator has an X##_FIELD twin taking the game FIELD arguments.
+#define STATE_HASH_COLUMNS(X)                                                  \
+  X(pos)                                                                       \
+  X(vel)                                                                       \
+  X(state_flags)                                                               \
+  X(component_masks)                                                           \
+  X(size)                                                                      \
+  X(inv_mass)                                                                  \
+  X(rotation)                                                                  \
+  X(generations)                                                               \
+  X(types)                                                                     \
+  X(ai_states)                                                                 \
+  X(ai_timers)                                                                 \
+  X(ai_targets)                                                                \
+  X(anim_frames)                                                               \
+  X(anim_timers)                                                               \
+  CRE_GAME_COMPONENTS(CRE_COMPONENT_IGNORE, X##_FIELD)
+
+#define STATE_HASH_COUNT_ONE(name) +1
+#define STATE_HASH_COUNT_ONE_FIELD(component, name, type, init, clone) +1
+static constexpr uint32_t STATE_HASH_COLUMN_COUNT =
+    0 STATE_HASH_COLUMNS(STATE_HASH_COUNT_ONE);
+#undef STATE_HASH_COUNT_ONE
+#undef STATE_HASH_COUNT_ONE_FIELD
+
+// CSV field names, in row order
+#define STATE_HASH_NAME(name) #name,
+#define STATE_HASH_NAME_FIELD(component, name, type, init, clone) #name,
+static const char *const s_fieldNames[] = {
+    "frame", "step", STATE_HASH_COLUMNS(STATE_HASH_NAME) "total"};
+#undef STATE_HASH_NAME
+#undef STATE_HASH_NAME_FIELD
+static constexpr uint32_t STATE_HASH_FIELD_COUNT =
+    sizeof(s_fieldNames) / sizeof(s_fieldNames[0]);
+
+// ============================================================================
+// Reference Comparison
+// ============================================================================
+
+static void StateHash_CloseRef(void) {
+  fclose(s_ref);
+  s_ref = nullptr;
+}
+
+// Index of the first CSV field that differs (both rows end with '\n').
+static uint32_t StateHash_FirstDiff(const char *a, const char *b) {
+  uint32_t field = 0;
+  while (*a == *b && *a != '\n' && *a != '\0') {
+    if (*a == ',')
+      field++;
+    a++;
+    b++;
+  }
+  return field < STATE_HASH_FIELD_COUNT ? field : STATE_HASH_FIELD_COUNT - 1;
+}
+
+static void StateHash_Compare(const char *row, uint32_t frame,
+                              uint32_t step) {
+  char refRow[STATE_HASH_ROW_SIZE];
+  if (!fgets(refRow, sizeof(refRow), s_ref)) {
+    Log(LogLevel::Warning, "[STATEHASH] Reference '{}' ends after {} steps",
+        s_refPath, s_refMatched);
+    StateHash_CloseRef();
+    return;
+  }
+  if (strcmp(row, refRow) == 0) {
+    s_refMatched++;
+    return;
+  }
+
+  s_refDiverged = true;
+  Log(LogLevel::Error,
+      "[STATEHASH] Diverged from '{}' at frame {} step {} (step {} of the "
+      "run), first column: {}",
+      s_refPath, frame, step, s_refMatched,
+      s_fieldNames[StateHash_FirstDiff(row, refRow)]);
+  StateHash_CloseRef();
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void StateHash_Init(int argc, char **argv) {
+  for (int i = 1; i + 1 < argc; i++) {
+    if (strcmp(argv[i], "--hash-log") == 0) {
+      s_logPath = argv[++i];
+    } else if (strcmp(argv[i], "--hash-ref") == 0) {
+      s_refPath = argv[++i];
+    }
+  }
+}
+
+void StateHash_Start(void) {
+  char header[STATE_HASH_ROW_SIZE];
+  uint32_t length = 0;
+  for (uint32_t f = 0; f < STATE_HASH_FIELD_COUNT; f++) {
+    length += static_cast<uint32_t>(
+        snprintf(header + length, sizeof(header) - length, "%s%s",
+                 f == 0 ? "" : ",", s_fieldNames[f]));
+  }
+  snprintf(header + length, sizeof(header) - length, "\n");
+
+  if (s_logPath) {
+    s_log = fopen(s_logPath, "w");
+    if (s_log) {
+      fputs(header, s_log);
+      Log(LogLevel::Info, "[STATEHASH] Logging {} columns per step to '{}'",
+          STATE_HASH_COLUMN_COUNT, s_logPath);
+    } else {
+      Log(LogLevel::Error, "[STATEHASH] Cannot open '{}'", s_logPath);
+    }
+  }
+
+  if (s_refPath) {
+    s_ref = fopen(s_refPath, "r");
+    char refHeader[STATE_HASH_ROW_SIZE];
+    if (!s_ref) {
+      Log(LogLevel::Error, "[STATEHASH] Cannot open reference '{}'",
+          s_refPath);
+    } else if (!fgets(refHeader, sizeof(refHeader), s_ref) ||
+               strcmp(header, refHeader) != 0) {
+      Log(LogLevel::Error,
+          "[STATEHASH] Reference '{}' hashes other columns than this build",
+          s_refPath);
+      StateHash_CloseRef();
+    } else {
+      Log(LogLevel::Info, "[STATEHASH] Comparing every step against '{}'",
+          s_refPath);
+    }
+  }
+}
+
+void StateHash_Shutdown(void) {
+  if (s_log) {
+    fclose(s_log);
+    s_log = nullptr;
+  }
+  if (s_ref) {
+    StateHash_CloseRef();
+  }
+  if (s_refPath && !s_refDiverged && s_refMatched > 0) {
+    Log(LogLevel::Info, "[STATEHASH] Matched '{}' for {} steps", s_refPath,
+        s_refMatched);
+  }
+}
+
+bool StateHash_IsEnabled(void) { return s_log != nullptr || s_ref != nullptr; }
+
+void StateHash_Step(const EntityRegistry &reg, uint32_t frame) {
+  if (!s_log && !s_ref)
+    return;
+
+  if (frame != s_lastFrame) {
+    s_lastFrame = frame;
+    s_stepInFrame = 0;
+  }
+  const uint32_t step = s_stepInFrame++;
+
+  const uint32_t bound = reg.max_used_bound;
+  uint64_t total = bound;
+  char row[STATE_HASH_ROW_SIZE];
+  uint32_t length = static_cast<uint32_t>(
+      snprintf(row, sizeof(row), "%u,%u", frame, step));
+
+#define STATE_HASH_COLUMN(name)                                                \
+  {                                                                            \
+    const uint64_t h = StateHash_Bytes(                                        \
+        reg.name, static_cast<uint32_t>(sizeof(reg.name[0]) * bound), bound);  \
+    total = Mix64(total ^ h);                                                  \
+    length += static_cast<uint32_t>(                                           \
+        snprintf(row + length, sizeof(row) - length, ",%016llx",               \
+                 static_cast<unsigned long long>(h)));                         \
+  }
+#define STATE_HASH_COLUMN_FIELD(component, name, type, init, clone)           \
+  STATE_HASH_COLUMN(name)
+  STATE_HASH_COLUMNS(STATE_HASH_COLUMN)
+#undef STATE_HASH_COLUMN
+#undef STATE_HASH_COLUMN_FIELD
+
+  snprintf(row + length, sizeof(row) - length, ",%016llx\n",
+           static_cast<unsigned long long>(total));
+
+  if (s_log)
+    fputs(row, s_log);
+  if (s_ref)
+    StateHash_Compare(row, frame, step);
+}
@@ -0,0 +1,62 @@
+/**
+ * @file cre_stateHash.h
+ * @brief Per-Step Simulation State Hashing
+ *
+ * Hashes the simulation columns of the EntityRegistry, game component
+ * columns included, after every fixed step. With --hash-log <file> each step appends one CSV row:
+ *   frame,step,<column hash>...,total
+ * Two runs of the same replay must produce identical files; use
+ * tools/hash_diff.py to find the first diverging frame and column.
+ * --hash-ref <file> compares against such a log while running instead (a
+ * headless replay against the client's log) and reports the first step and
+ * column that differ.
+ *
+ * Columns are hashed bitwise over [0, max_used_bound), so -0.0 vs 0.0 or a
+ * single ULP of drift shows up as a mismatch.
+ */
+
+#ifndef CRE_STATEHASH_H
+#define CRE_STATEHASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct EntityRegistry;
+
+/**
+ * @brief Parse --hash-log <file> and --hash-ref <file> (before Engine_Init).
+ */
+void StateHash_Init(int argc, char **argv);
+
+/**
+ * @brief Open the hash log and the reference. Called by Engine_Init once
+ * logging is up.
+ */
+void StateHash_Start(void);
+
+/**
+ * @brief Close the files and report how far the reference matched.
+ */
+void StateHash_Shutdown(void);
+
+/**
+ * @brief True while a hash log is written or a reference compared.
+ */
+bool StateHash_IsEnabled(void);
+
+/**
+ * @brief 64-bit hash of a byte range (8 independent 32-bit lanes).
+ *
+ * Lanes are updated independently per 32-byte block, so the core loop
+ * vectorizes to a single 256-bit multiply/rotate chain.
+ */
+uint64_t StateHash_Bytes(const void *data, uint32_t size, uint64_t seed);
+
+/**
+ * @brief Hash every simulation column, append a log row and check it
+ * against the reference.
+ * Called after each fixed step; frame comes from TimeContext::frameIndex.
+ */
+void StateHash_Step(const EntityRegistry &reg, uint32_t frame);
+
+#endif
@@ -6,7 +6,10 @@ struct EntityRegistry;
 struct CommandBus;
 struct TimeContext;
 struct creVec2;
+struct creColor;
 struct CameraComponent;
+struct Entity;
+struct EntityCounters;
 
 struct scenePacket {
   EntityRegistry *reg;
@@ -34,6 +37,7 @@ struct physicsPacket {
     float *drag;
     float *gravity_scale;
     uint8_t *material_id;
+    EntityCounters *counters; // Sleep/static flag changes
   } write;
 };
 
@@ -60,6 +64,60 @@ struct animPacket {
   } write;
 };
 
+struct aiPacket {
+  CommandBus *bus;
+  float dt; // gameDt
+  uint32_t max_used_bound;
+  struct ReadAccess {
+    const creVec2 *pos;
+    const creVec2 *vel;
+    const uint64_t *component_masks;
+    const uint64_t *state_flags;
+    const uint32_t *generations;
+    const uint16_t *types;
+  } read;
+  struct WriteAccess {
+    uint8_t *ai_states;
+    float *ai_timers;
+    Entity *ai_targets;
+  } write;
+};
+
+struct transformPacket {
+  CommandBus *bus;
+  uint32_t max_used_bound;
+  struct ReadAccess {
+    const uint64_t *state_flags;
+    const uint32_t *generations;
+  } read;
+  struct WriteAccess {
+    uint64_t *component_masks; // Attach/detach add/remove COMP_HIERARCHY
+    EntityCounters *counters;
+    Entity *parents;
+    creVec2 *local_pos;
+    float *local_rotation;
+    creVec2 *local_scale;
+    creVec2 *pos;
+    float *rotation;
+    creVec2 *visual_scale;
+  } write;
+};
+
+struct tweenPacket {
+  float dt; // gameDt
+  struct ReadAccess {
+    const uint64_t *state_flags;
+    const uint32_t *generations;
+  } read;
+  struct WriteAccess {
+    creVec2 *pos;
+    float *rotation;
+    creVec2 *visual_scale;
+    creColor *colors;
+    CameraComponent *cameras;
+  } write;
+};
+
 struct cameraPacket {
   CommandBus *bus;
   float dt;
@@ -26,10 +26,12 @@ struct Arena {
 struct TimeContext {
   float realDt;
   float gameDt;
-  float fixedDt;
+  float fixedDt;       // fixedStepUs in seconds (derived)
   double lastTime;
-  float accumulator;
+  int64_t fixedStepUs; // Fixed step in integer microseconds
+  int64_t accumulatorUs; // Integer, so step counts never drift
   float timeScale;
+  uint32_t frameIndex; // Frames advanced since init
 };
 
 struct EngineContext {
@@ -39,6 +41,9 @@ struct EngineContext {
   Arena audioArena;
   Arena busArena;
   Arena frameArena;
+  Arena timerArena;
+  Arena lightArena;
+  Arena visionArena;
   TimeContext time;
   EntityRegistry *reg;
   CommandBus *bus;
@@ -65,6 +70,55 @@ struct AudioID {
   uint16_t gen;
 };
 
+struct PhysJointID {
+  uint16_t index;
+  uint16_t gen;
+};
+
+#define PHYS_JOINT_INVALID (PhysJointID{.index = 0xFFFF, .gen = 0})
+
+struct TweenID {
+  uint16_t index;
+  uint16_t gen;
+};
+
+#define TWEEN_INVALID (TweenID{.index = 0xFFFF, .gen = 0})
+
+struct TimerID {
+  uint32_t index;
+  uint32_t gen;
+};
+
+#define TIMER_INVALID (TimerID{.index = 0xFFFFFFFFU, .gen = 0})
+
+struct TextID {
+  uint16_t index;
+  uint16_t gen;
+};
+
+#define TEXT_INVALID (TextID{.index = 0xFFFF, .gen = 0})
+
+struct UIWidgetID {
+  uint16_t index;
+  uint16_t gen;
+};
+
+#define UI_INVALID (UIWidgetID{.index = 0xFFFF, .gen = 0})
+
+struct LightID {
+  uint16_t index;
+  uint16_t gen;
+};
+
+#define LIGHT_INVALID (LightID{.index = 0xFFFF, .gen = 0})
+
+struct ViewerID {
+  uint16_t index;
+  uint16_t gen;
+};
+
+#define VIEWER_INVALID (ViewerID{.index = 0xFFFF, .gen = 0})
+
 struct creVec2 {
   float x;
   float y;
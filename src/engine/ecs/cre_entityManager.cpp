@@ -63,6 +63,17 @@ void EntityManager_Reset(EntityRegistry &reg) {
   memset(reg.anim_frames, 0, sizeof(reg.anim_frames));
   memset(reg.anim_finished, 0, sizeof(reg.anim_finished));
   memset(reg.anim_base_durations, 0, sizeof(reg.anim_base_durations));
+  memset(reg.ai_states, 0, sizeof(reg.ai_states));
+  memset(reg.ai_timers, 0, sizeof(reg.ai_timers));
+  memset(reg.ai_targets, 0, sizeof(reg.ai_targets));
+  memset(reg.parents, 0, sizeof(reg.parents));
+  memset(reg.local_pos, 0, sizeof(reg.local_pos));
+  memset(reg.local_rotation, 0, sizeof(reg.local_rotation));
+  memset(reg.local_scale, 0, sizeof(reg.local_scale));
+#define CRE_FIELD_RESET(component, name, type, init, clone)                   \
+  memset(reg.name, 0, sizeof(reg.name));
+  CRE_GAME_COMPONENTS(CRE_COMPONENT_IGNORE, CRE_FIELD_RESET)
+#undef CRE_FIELD_RESET
   memset(reg.cameras, 0, sizeof(reg.cameras));
   reg.camera_count = 0;
 
@@ -76,6 +87,13 @@ void EntityManager_Reset(EntityRegistry &reg) {
   reg.free_count = MAX_ENTITIES;
   reg.active_count = 0;
   reg.max_used_bound = 0;
+  reg.counters = {.active = 0,
+                  .physics = 0,
+                  .statics = 0,
+                  .sleeping = 0,
+                  .culled = 0,
+                  .dormant = 0,
+                  .children = 0};
 
   Log(LogLevel::Info, "Entity Manager Reset Complete (generations preserved)");
 }
@@ -149,7 +167,26 @@ Entity EntityManager_Create(EntityRegistry &reg, uint16_t type, creVec2 pos,
   reg.anim_timers[index] = 0.0f;
   reg.anim_finished[index] = false;
 
+  // AI
+  reg.ai_states[index] = AI_STATE_NONE;
+  reg.ai_timers[index] = 0.0f;
+  reg.ai_targets[index] = ENTITY_INVALID;
+
+  // Hierarchy
+  reg.parents[index] = ENTITY_INVALID;
+  reg.local_pos[index] = creVec2{0.0f, 0.0f};
+  reg.local_rotation[index] = 0.0f;
+  reg.local_scale[index] = creVec2{1.0f, 1.0f};
+
+  // Game components
+#define CRE_FIELD_INIT(component, name, type, init, clone)                    \
+  reg.name[index] = init;
+  CRE_GAME_COMPONENTS(CRE_COMPONENT_IGNORE, CRE_FIELD_INIT)
+#undef CRE_FIELD_INIT
+
   reg.active_count++;
+  EntityCounters_OnEntity(&reg.counters, 0, COMP_NONE, initial_flags,
+                          initial_CompMask);
 
   // Track max used index for loop optimization
   if (index >= reg.max_used_bound)
@@ -169,6 +206,8 @@ void EntityManager_Destroy(EntityRegistry &reg, Entity e) {
     return;
 
   // Clear the slot
+  EntityCounters_OnEntity(&reg.counters, reg.state_flags[e.id],
+                          reg.component_masks[e.id], 0, COMP_NONE);
   reg.component_masks[e.id] = COMP_NONE;
   reg.state_flags[e.id] = 0;
   reg.render_layer[e.id] = 0; // Keep these in mind**
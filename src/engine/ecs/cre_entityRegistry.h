@@ -14,6 +14,7 @@
 
 #include "cre_components.h"
 #include "cre_entityEvents.h"
+#include "cre_gameComponents.h"
 #include "engine/core/cre_config.h"
 #include "engine/core/cre_types.h"
 #include <stdalign.h>
@@ -40,9 +41,10 @@ constexpr uint64_t COMP_SOUND = (1ULL << 6);
 constexpr uint64_t COMP_AI = (1ULL << 7);
 constexpr uint64_t COMP_SHADER = (1ULL << 8);
 constexpr uint64_t COMP_CAMERA = (1ULL << 9);
+constexpr uint64_t COMP_HIERARCHY = (1ULL << 10); // Transform from a parent
 
-// Reserve bits 6-31 for future component types
-// Bits 32-63 available for game-specific components
+// Reserve bits 11-31 for future component types
+// Bits 32-63 are registered by the game (cre_gameComponents.h)
 
 // ============================================================================
 // State Flags (uint64_t state_flags[])
@@ -84,6 +86,34 @@ constexpr uint64_t CLONE_FLAGS_SCRUB_MASK =
 #define CLEAR_MASK(flags)                                                      \
   (static_cast<uint32_t>(flags) & ~(0xFFFFULL << MASK_SHIFT)
 
+// ============================================================================
+// Entity Counters (uint32_t, maintained incrementally)
+// ============================================================================
+
+/**
+ * @brief Active entities per tracked bit. Every write of a tracked bit goes
+ * through EntityRegistry_SetFlags/ClearFlags (or EntityCounters_OnEntity for
+ * spawn, destroy and component changes), so nothing has to scan the
+ * registry to get them. Inactive slots never count.
+ */
+struct EntityCounters {
+  uint32_t active;   //< FLAG_ACTIVE (active_count also holds prototypes)
+  uint32_t physics;  //< COMP_PHYSICS
+  uint32_t statics;  //< FLAG_STATIC
+  uint32_t sleeping; //< FLAG_SLEEPING
+  uint32_t culled;   //< FLAG_CULLED
+  uint32_t dormant;  //< FLAG_SLEEPING or FLAG_CULLED (awake = active - this)
+  uint32_t children; //< COMP_HIERARCHY
+};
+
+// ============================================================================
+// AI State Ids (uint8_t ai_states[])
+// ============================================================================
+// State 0 is reserved: the AI system never dispatches entities in it.
+// Games register their own states (1..AI_MAX_STATES-1) with the AI system.
+
+constexpr uint8_t AI_STATE_NONE = 0;
+
 // ============================================================================
 // Entity Registry (Packed Parallel SoA)
 // ============================================================================
@@ -127,6 +157,20 @@ struct EntityRegistry {
   alignas(64) uint16_t anim_start_sprites[MAX_ENTITIES];
   alignas(64) bool anim_loops[MAX_ENTITIES];
 
+  alignas(64) uint8_t ai_states[MAX_ENTITIES]; //< Current AI state id
+  alignas(64) float ai_timers[MAX_ENTITIES];   //< Seconds spent in state
+  alignas(64) Entity ai_targets[MAX_ENTITIES]; //< Current AI target
+
+  // Hierarchy (COMP_HIERARCHY): pos/rotation/visual_scale are derived from
+  // the parent by the transform system, see cre_transformSystem.h
+  alignas(64) Entity parents[MAX_ENTITIES];       //< Parent handle
+  alignas(64) creVec2 local_pos[MAX_ENTITIES];    //< Offset in parent space
+  alignas(64) float local_rotation[MAX_ENTITIES]; //< Degrees, plus parent's
+  alignas(64) creVec2 local_scale[MAX_ENTITIES];  //< Times parent's scale
+
+  // Game-specific components, one column per registered field
+  CRE_GAME_COMPONENTS(CRE_COMPONENT_IGNORE, CRE_FIELD_COLUMN)
+
   alignas(64) CameraComponent cameras[MAX_CAMERAS];
   alignas(64) uint32_t camera_count;
 
@@ -137,6 +181,7 @@ struct EntityRegistry {
   alignas(64) uint32_t free_count;     //< Number of free slots
   alignas(64) uint32_t active_count;   //< Number of active entities
   alignas(64) uint32_t max_used_bound; //< Highest idx ever used
+  alignas(64) EntityCounters counters; //< Per-flag counts of active entities
 
   alignas(64) EntityEventDispatcher events; //< Lifecycle hook dispatcher state
 };
@@ -156,6 +201,75 @@ static inline bool EntityRegistry_IsAlive(const uint64_t *state_flags,
   return generations[e.id] == e.generation;
 }
 
+static inline uint32_t EntityCounters_Has(uint64_t flags, uint64_t bits) {
+  return ((flags & FLAG_ACTIVE) && (flags & bits)) ? 1u : 0u;
+}
+
+/**
+ * @brief Apply one entity's state flag change to the counters.
+ * Differences wrap in uint32_t, which nets out to the right count.
+ */
+static inline void EntityCounters_OnFlags(EntityCounters *counters,
+                                          uint64_t oldFlags,
+                                          uint64_t newFlags) {
+  constexpr uint64_t dormantBits = FLAG_SLEEPING | FLAG_CULLED;
+  counters->active += EntityCounters_Has(newFlags, FLAG_ACTIVE) -
+                      EntityCounters_Has(oldFlags, FLAG_ACTIVE);
+  counters->statics += EntityCounters_Has(newFlags, FLAG_STATIC) -
+                       EntityCounters_Has(oldFlags, FLAG_STATIC);
+  counters->sleeping += EntityCounters_Has(newFlags, FLAG_SLEEPING) -
+                        EntityCounters_Has(oldFlags, FLAG_SLEEPING);
+  counters->culled += EntityCounters_Has(newFlags, FLAG_CULLED) -
+                      EntityCounters_Has(oldFlags, FLAG_CULLED);
+  counters->dormant += EntityCounters_Has(newFlags, dormantBits) -
+                       EntityCounters_Has(oldFlags, dormantBits);
+}
+
+/**
+ * @brief Spawn, destroy or component change (flags and mask together).
+ */
+static inline void EntityCounters_OnEntity(EntityCounters *counters,
+                                           uint64_t oldFlags,
+                                           uint64_t oldComps,
+                                           uint64_t newFlags,
+                                           uint64_t newComps) {
+  const uint32_t hadPhysics = (oldComps & COMP_PHYSICS)
+                                  ? EntityCounters_Has(oldFlags, FLAG_ACTIVE)
+                                  : 0u;
+  const uint32_t hasPhysics = (newComps & COMP_PHYSICS)
+                                  ? EntityCounters_Has(newFlags, FLAG_ACTIVE)
+                                  : 0u;
+  counters->physics += hasPhysics - hadPhysics;
+  const uint32_t hadParent = (oldComps & COMP_HIERARCHY)
+                                 ? EntityCounters_Has(oldFlags, FLAG_ACTIVE)
+                                 : 0u;
+  const uint32_t hasParent = (newComps & COMP_HIERARCHY)
+                                 ? EntityCounters_Has(newFlags, FLAG_ACTIVE)
+                                 : 0u;
+  counters->children += hasParent - hadParent;
+  EntityCounters_OnFlags(counters, oldFlags, newFlags);
+}
+
+/**
+ * @brief flags |= bits, keeping the counters in sync.
+ */
+static inline void EntityRegistry_SetFlags(EntityCounters *counters,
+                                           uint64_t *flags, uint64_t bits) {
+  const uint64_t oldFlags = *flags;
+  *flags = oldFlags | bits;
+  EntityCounters_OnFlags(counters, oldFlags, *flags);
+}
+
+/**
+ * @brief flags &= ~bits, keeping the counters in sync.
+ */
+static inline void EntityRegistry_ClearFlags(EntityCounters *counters,
+                                             uint64_t *flags, uint64_t bits) {
+  const uint64_t oldFlags = *flags;
+  *flags = oldFlags & ~bits;
+  EntityCounters_OnFlags(counters, oldFlags, *flags);
+}
+
 static inline bool EntityRegistry_IsValid(const uint32_t *generations,
                                           Entity e) {
   if (e.id >= MAX_ENTITIES)
@@ -18,6 +18,8 @@ entityPacket CreateEntityPacket(EntityRegistry *reg, CommandBus *bus) {
 
 static void EntitySystem_CopyPrototype(EntityRegistry *reg, uint32_t dst_id,
                                        uint32_t src_id, creVec2 position) {
+  const uint64_t oldFlags = reg->state_flags[dst_id];
+  const uint64_t oldComps = reg->component_masks[dst_id];
 
   reg->pos[dst_id] = reg->pos[src_id];
   reg->size[dst_id] = reg->size[src_id];
@@ -46,14 +48,34 @@ static void EntitySystem_CopyPrototype(EntityRegistry *reg, uint32_t dst_id,
   reg->anim_start_sprites[dst_id] = reg->anim_start_sprites[src_id];
   reg->anim_loops[dst_id] = reg->anim_loops[src_id];
 
+  reg->ai_states[dst_id] = reg->ai_states[src_id];
+  reg->ai_targets[dst_id] = reg->ai_targets[src_id];
+
+  reg->parents[dst_id] = reg->parents[src_id];
+  reg->local_pos[dst_id] = reg->local_pos[src_id];
+  reg->local_rotation[dst_id] = reg->local_rotation[src_id];
+  reg->local_scale[dst_id] = reg->local_scale[src_id];
+
+#define CRE_FIELD_CLONE(component, name, type, init, clone)                   \
+  if constexpr ((clone) == CLONE_COPY)                                         \
+    reg->name[dst_id] = reg->name[src_id];                                     \
+  else                                                                         \
+    reg->name[dst_id] = init;
+  CRE_GAME_COMPONENTS(CRE_COMPONENT_IGNORE, CRE_FIELD_CLONE)
+#undef CRE_FIELD_CLONE
+
   reg->pos[dst_id] = position;
   reg->anim_timers[dst_id] = 0.0f;
   reg->anim_frames[dst_id] = 0;
   reg->anim_finished[dst_id] = false;
+  reg->ai_timers[dst_id] = 0.0f;
 
   reg->vel[dst_id] = creVec2{0.0f, 0.0f};
 
   reg->state_flags[dst_id] |= FLAG_ACTIVE;
+  EntityCounters_OnEntity(&reg->counters, oldFlags, oldComps,
+                          reg->state_flags[dst_id],
+                          reg->component_masks[dst_id]);
 
   if (dst_id >= reg->max_used_bound) {
     reg->max_used_bound = dst_id + 1;
@@ -253,9 +275,8 @@ void EntitySystem_ClearAllHooks(EntityRegistry &reg) {
   EntitySystem_ClearDestroyHooks(reg);
 }
 
-static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus) {
-
-  CommandIterator iter = CommandBus_GetIterator(bus);
+static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus,
+                                         CommandIterator iter) {
   const Command *cmd;
 
   while (CommandBus_Next(bus, &iter, &cmd)) {
@@ -372,6 +393,8 @@ static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus) {
       }
       reg.events.is_dispatching_destroy_hooks = false;
 
+      EntityCounters_OnEntity(&reg.counters, reg.state_flags[id],
+                              reg.component_masks[id], 0, COMP_NONE);
       reg.component_masks[id] = COMP_NONE;
       reg.state_flags[id] &= ~FLAG_ACTIVE;
       reg.generations[id]++;
@@ -385,7 +408,11 @@ static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus) {
                                   cmd->entity))
         break;
       uint32_t id = cmd->entity.id;
-      reg.component_masks[id] |= cmd->u64.value;
+      const uint64_t comps = reg.component_masks[id] | cmd->u64.value;
+      EntityCounters_OnEntity(&reg.counters, reg.state_flags[id],
+                              reg.component_masks[id], reg.state_flags[id],
+                              comps);
+      reg.component_masks[id] = comps;
       break;
     }
     case CMD_ENTITY_REMOVE_COMPONENT: {
@@ -393,7 +420,11 @@ static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus) {
                                   cmd->entity))
         break;
       uint32_t id = cmd->entity.id;
-      reg.component_masks[id] &= ~cmd->u64.value;
+      const uint64_t comps = reg.component_masks[id] & ~cmd->u64.value;
+      EntityCounters_OnEntity(&reg.counters, reg.state_flags[id],
+                              reg.component_masks[id], reg.state_flags[id],
+                              comps);
+      reg.component_masks[id] = comps;
       break;
     }
     case CMD_ENTITY_SET_PIVOT: {
@@ -418,7 +449,11 @@ static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus) {
                                   cmd->entity))
         break;
       uint32_t id = cmd->entity.id;
-      reg.state_flags[id] |= cmd->u64.value;
+      const uint64_t flags = reg.state_flags[id] | cmd->u64.value;
+      EntityCounters_OnEntity(&reg.counters, reg.state_flags[id],
+                              reg.component_masks[id], flags,
+                              reg.component_masks[id]);
+      reg.state_flags[id] = flags;
       break;
     }
     case CMD_ENTITY_REMOVE_FLAGS: {
@@ -426,7 +461,11 @@ static void EntitySystem_ProcessCommands(EntityRegistry &reg, CommandBus &bus) {
                                   cmd->entity))
         break;
       uint32_t id = cmd->entity.id;
-      reg.state_flags[id] &= ~cmd->u64.value;
+      const uint64_t flags = reg.state_flags[id] & ~cmd->u64.value;
+      EntityCounters_OnEntity(&reg.counters, reg.state_flags[id],
+                              reg.component_masks[id], flags,
+                              reg.component_masks[id]);
+      reg.state_flags[id] = flags;
       break;
     }
     case CMD_ENTITY_RESET: {
@@ -445,5 +484,14 @@ void EntitySystem_Update(entityPacket *packet) {
 
   EntityRegistry &reg = *packet->reg;
   CommandBus &bus = *packet->bus;
-  EntitySystem_ProcessCommands(reg, bus);
+  EntitySystem_ProcessCommands(reg, bus, CommandBus_GetIterator(bus));
+}
+
+void EntitySystem_UpdateSince(entityPacket *packet, uint32_t begin) {
+  assert(packet != nullptr && "EntitySystem_UpdateSince: packet is NULL");
+
+  EntityRegistry &reg = *packet->reg;
+  CommandBus &bus = *packet->bus;
+  EntitySystem_ProcessCommands(reg, bus,
+                               CommandBus_GetIteratorFrom(bus, begin));
 }
@@ -28,4 +28,10 @@ void EntitySystem_ClearDestroyHooks(EntityRegistry &reg);
 void EntitySystem_ClearAllHooks(EntityRegistry &reg);
 
 void EntitySystem_Update(entityPacket *packet);
+
+/**
+ * @brief Apply the entity commands pushed since `begin` (bus head before the
+ * fixed steps): timers push them after EntitySystem_Update has drained.
+ */
+void EntitySystem_UpdateSince(entityPacket *packet, uint32_t begin);
 #endif
@@ -0,0 +1,83 @@
+/**
+ * @file cre_gameComponents.h
+ * @brief Game-Specific Component Registration (Generated SoA Columns)
+ *
+ * A game lists its components once, as an X-macro in the header named by
+ * CRE_GAME_COMPONENTS_HEADER (set by CMake):
+ *
+ *   #define CRE_GAME_COMPONENTS(COMPONENT, FIELD)                  \
+ *     COMPONENT(HEALTH, 32)                                        \
+ *     FIELD(HEALTH, health, int16_t, 100, CLONE_COPY)              \
+ *     FIELD(HEALTH, hit_timer, float, 0.0f, CLONE_RESET)
+ *
+ * COMPONENT(NAME, bit) defines COMP_NAME = 1ULL << bit, bit in 32..63.
+ * FIELD(COMPONENT, name, type, init, clone) becomes an
+ * `alignas(64) type name[MAX_ENTITIES]` member of EntityRegistry, so hot
+ * loops index reg.name[i] like any engine column. EntityManager_Create
+ * sets it to init, a prototype clone copies it (CLONE_COPY) or sets it to
+ * init (CLONE_RESET: timers, per-instance state), EntityManager_Reset
+ * zeroes it. Wrap an init containing commas in parentheses.
+ *
+ * The columns live inside the registry, so SimState snapshots, rollback
+ * and the state hash cover them. Field types must be trivially copyable.
+ */
+
+#ifndef CRE_GAMECOMPONENTS_H
+#define CRE_GAMECOMPONENTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef CRE_GAME_COMPONENTS_HEADER
+#include CRE_GAME_COMPONENTS_HEADER
+#endif
+
+#ifndef CRE_GAME_COMPONENTS
+#define CRE_GAME_COMPONENTS(COMPONENT, FIELD)
+#endif
+
+enum ComponentClone : uint8_t {
+  CLONE_COPY = 0, // Clones start with the prototype's value
+  CLONE_RESET     // Clones start with the field's init value
+};
+
+// Generators: pass one of each kind to CRE_GAME_COMPONENTS
+#define CRE_COMPONENT_IGNORE(component, bit)
+#define CRE_FIELD_IGNORE(component, name, type, init, clone)
+
+#define CRE_COMPONENT_DEFINE(component, bit)                                  \
+  constexpr uint64_t COMP_##component = (1ULL << (bit));
+#define CRE_COMPONENT_BIT(component, bit) (bit),
+#define CRE_FIELD_CHECK(component, name, type, init, clone)                   \
+  static_assert((COMP_##component) != 0, #name ": unknown component");
+#define CRE_FIELD_COLUMN(component, name, type, init, clone)                  \
+  alignas(64) type name[MAX_ENTITIES];
+
+// ============================================================================
+// Game Component Mask Bits (uint64_t component_masks[])
+// ============================================================================
+
+CRE_GAME_COMPONENTS(CRE_COMPONENT_DEFINE, CRE_FIELD_IGNORE)
+CRE_GAME_COMPONENTS(CRE_COMPONENT_IGNORE, CRE_FIELD_CHECK)
+
+/**
+ * @brief Every game component has its own bit in 32..63.
+ */
+constexpr bool GameComponents_BitsValid(void) {
+  constexpr uint32_t bits[] = {
+      CRE_GAME_COMPONENTS(CRE_COMPONENT_BIT, CRE_FIELD_IGNORE) 64};
+  uint64_t seen = 0;
+  for (size_t i = 0; i + 1 < sizeof(bits) / sizeof(bits[0]); i++) {
+    if (bits[i] < 32 || bits[i] > 63)
+      return false;
+    if (seen & (1ULL << bits[i]))
+      return false;
+    seen |= 1ULL << bits[i];
+  }
+  return true;
+}
+
+static_assert(GameComponents_BitsValid(),
+              "Game components need distinct bits in 32..63");
+
+#endif
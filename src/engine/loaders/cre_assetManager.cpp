@@ -46,10 +46,13 @@ Texture2D Asset_getTexture(void) { return atlasTexture; }
 // why does this parameter has int? Change this to uint32_t after changing
 // spriteids to uint32_t
 creRectangle Asset_getRect(int spriteID) {
+  return SpriteMeta_ToRect(Asset_getSprite(spriteID));
+}
+const SpriteMeta *Asset_getSprite(int spriteID) {
   if (spriteID < 0 || spriteID >= SPRITE_COUNT) {
     Log(LogLevel::Warning, "ASSETS: Missing sprite ID {},using Fallback.",
         spriteID);
-    return SpriteMeta_ToRect(&ASSET_SPRITES[SPR_MISSING]);
+    return &ASSET_SPRITES[SPR_MISSING];
   }
-  return SpriteMeta_ToRect(&ASSET_SPRITES[spriteID]);
+  return &ASSET_SPRITES[spriteID];
 }
@@ -1,6 +1,7 @@
 #ifndef CRE_ASSETMANAGER_H
 #define CRE_ASSETMANAGER_H
 
+#include "atlas_data.h"
 #include "engine/core/cre_types.h"
 #include "raylib.h"
 
@@ -8,5 +9,7 @@ void Asset_Init(void);
 void Asset_Shutdown(void);
 Texture2D Asset_getTexture(void);
 creRectangle Asset_getRect(int spriteID);
+// Full metadata (trim offsets, original size), SPR_MISSING when out of range
+const SpriteMeta *Asset_getSprite(int spriteID);
 
 #endif
@@ -0,0 +1,164 @@
+/**
+ * @file cre_bitstream.h
+ * @brief Little-endian Bit Writer / Reader
+ *
+ * LSB-first bit packing over a caller-owned byte buffer. Overflowing the
+ * buffer (writer) or reading past the end (reader) sets `overflow` and
+ * further operations become no-ops returning 0, so callers check once at
+ * the end instead of after every field.
+ */
+
+#ifndef CRE_BITSTREAM_H
+#define CRE_BITSTREAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct BitWriter {
+  uint8_t *data;
+  uint32_t capacity; // Bytes
+  uint32_t bytePos;
+  uint64_t scratch;
+  uint32_t scratchBits;
+  bool overflow;
+};
+
+struct BitReader {
+  const uint8_t *data;
+  uint32_t size; // Bytes
+  uint32_t bytePos;
+  uint64_t scratch;
+  uint32_t scratchBits;
+  bool overflow;
+};
+
+// ============================================================================
+// Zigzag (signed <-> unsigned, small magnitudes stay small)
+// ============================================================================
+
+static inline uint32_t Bits_ZigZag(int32_t v) {
+  return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31);
+}
+
+static inline int32_t Bits_UnZigZag(uint32_t v) {
+  return static_cast<int32_t>(v >> 1) ^ -static_cast<int32_t>(v & 1u);
+}
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+static inline void BitWriter_Init(BitWriter *w, uint8_t *data,
+                                  uint32_t capacity) {
+  *w = {.data = data,
+        .capacity = capacity,
+        .bytePos = 0,
+        .scratch = 0,
+        .scratchBits = 0,
+        .overflow = false};
+}
+
+/**
+ * @brief Append the low `bits` bits of value (bits <= 32).
+ */
+static inline void BitWriter_Write(BitWriter *w, uint32_t value,
+                                   uint32_t bits) {
+  const uint64_t mask = (bits >= 32) ? 0xFFFFFFFFull : ((1ull << bits) - 1ull);
+  w->scratch |= (static_cast<uint64_t>(value) & mask) << w->scratchBits;
+  w->scratchBits += bits;
+  while (w->scratchBits >= 8) {
+    if (w->bytePos >= w->capacity) {
+      w->overflow = true;
+      w->scratchBits = 0;
+      w->scratch = 0;
+      return;
+    }
+    w->data[w->bytePos++] = static_cast<uint8_t>(w->scratch);
+    w->scratch >>= 8;
+    w->scratchBits -= 8;
+  }
+}
+
+/**
+ * @brief Variable length unsigned: groups of `groupBits` data bits, each
+ * followed by a continue bit. Pick the group to fit the common magnitude.
+ */
+static inline void BitWriter_WriteVarUint(BitWriter *w, uint32_t value,
+                                          uint32_t groupBits) {
+  const uint32_t groupMask = (1u << groupBits) - 1u;
+  do {
+    const uint32_t chunk = value & groupMask;
+    value >>= groupBits;
+    BitWriter_Write(w, chunk | ((value != 0) ? (1u << groupBits) : 0u),
+                    groupBits + 1);
+  } while (value != 0);
+}
+
+static inline void BitWriter_WriteVarInt(BitWriter *w, int32_t value,
+                                         uint32_t groupBits) {
+  BitWriter_WriteVarUint(w, Bits_ZigZag(value), groupBits);
+}
+
+/**
+ * @brief Pad the last byte with zeros.
+ * @return Bytes written, 0 on overflow
+ */
+static inline uint32_t BitWriter_Flush(BitWriter *w) {
+  if (w->scratchBits > 0) {
+    BitWriter_Write(w, 0, 8 - w->scratchBits);
+  }
+  return w->overflow ? 0 : w->bytePos;
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+static inline void BitReader_Init(BitReader *r, const uint8_t *data,
+                                  uint32_t size) {
+  *r = {.data = data,
+        .size = size,
+        .bytePos = 0,
+        .scratch = 0,
+        .scratchBits = 0,
+        .overflow = false};
+}
+
+static inline uint32_t BitReader_Read(BitReader *r, uint32_t bits) {
+  while (r->scratchBits < bits) {
+    if (r->bytePos >= r->size) {
+      r->overflow = true;
+      return 0;
+    }
+    r->scratch |= static_cast<uint64_t>(r->data[r->bytePos++])
+                  << r->scratchBits;
+    r->scratchBits += 8;
+  }
+  const uint64_t mask = (bits >= 32) ? 0xFFFFFFFFull : ((1ull << bits) - 1ull);
+  const uint32_t value = static_cast<uint32_t>(r->scratch & mask);
+  r->scratch >>= bits;
+  r->scratchBits -= bits;
+  return value;
+}
+
+static inline uint32_t BitReader_ReadVarUint(BitReader *r,
+                                             uint32_t groupBits) {
+  const uint32_t groupMask = (1u << groupBits) - 1u;
+  uint32_t value = 0;
+  uint32_t shift = 0;
+  while (shift < 32) {
+    const uint32_t chunk = BitReader_Read(r, groupBits + 1);
+    value |= (chunk & groupMask) << shift;
+    if (!(chunk >> groupBits) || r->overflow)
+      return value;
+    shift += groupBits;
+  }
+  r->overflow = true; // Malformed: more than 32 bits
+  return 0;
+}
+
+static inline int32_t BitReader_ReadVarInt(BitReader *r, uint32_t groupBits) {
+  return Bits_UnZigZag(BitReader_ReadVarUint(r, groupBits));
+}
+
+#endif
@@ -0,0 +1,442 @@
+#include "cre_replication.h"
+#include "cre_bitstream.h"
+#include "cre_transport.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_types.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <math.h>
+#include <string.h>
+
+static_assert((REPL_HISTORY & (REPL_HISTORY - 1)) == 0,
+              "REPL_HISTORY must be a power of two");
+
+// Message types (first 8 bits of every message)
+constexpr uint32_t REPL_MSG_SNAPSHOT = 1;
+constexpr uint32_t REPL_MSG_ACK = 2;
+
+// Per-entity field bits
+constexpr uint8_t REPL_FIELD_POS = (1 << 0);
+constexpr uint8_t REPL_FIELD_VEL = (1 << 1);
+constexpr uint8_t REPL_FIELD_SPRITE = (1 << 2);
+constexpr uint8_t REPL_FIELD_ANIM = (1 << 3);
+constexpr uint8_t REPL_FIELD_FLAGS = (1 << 4);
+constexpr uint32_t REPL_FIELD_BITS = 5;
+
+// Varint group sizes, tuned for per-tick deltas of moving bodies
+constexpr uint32_t REPL_GAP_GROUP = 4;
+constexpr uint32_t REPL_POS_GROUP = 6;
+constexpr uint32_t REPL_VEL_GROUP = 4;
+constexpr uint32_t REPL_SMALL_GROUP = 3;
+
+constexpr uint64_t REPL_FLAGS_MASK = 0xFFFFull; // Behavioural bits only
+
+// Baseline for clients without an acked snapshot (all zero)
+static ReplSnapshot s_emptySnapshot = {};
+
+static inline uint32_t Repl_Slot(uint32_t seq) {
+  return seq & (REPL_HISTORY - 1);
+}
+
+// Wrapping difference, the decoder adds it back with the same wrap
+static inline int32_t Repl_Delta32(int32_t cur, int32_t base) {
+  return static_cast<int32_t>(static_cast<uint32_t>(cur) -
+                              static_cast<uint32_t>(base));
+}
+
+static inline int32_t Repl_Add32(int32_t base, int32_t delta) {
+  return static_cast<int32_t>(static_cast<uint32_t>(base) +
+                              static_cast<uint32_t>(delta));
+}
+
+static inline int16_t Repl_QuantizeVel(float v) {
+  if (!(v > -32767.0f))
+    return (v != v) ? 0 : -32767; // NaN -> 0
+  if (v > 32767.0f)
+    return 32767;
+  return static_cast<int16_t>(lrintf(v));
+}
+
+static inline int32_t Repl_QuantizePos(float p) {
+  const float q = p * REPL_POS_SCALE;
+  if (!(q > -2.0e9f))
+    return (q != q) ? 0 : -2000000000;
+  if (q > 2.0e9f)
+    return 2000000000;
+  return static_cast<int32_t>(lrintf(q));
+}
+
+static void Repl_ClearSnapshot(ReplSnapshot *snap) {
+  memset(snap, 0, sizeof(*snap));
+  snap->seq = REPL_NO_BASELINE;
+  snap->bound = 0;
+}
+
+// ============================================================================
+// Server
+// ============================================================================
+
+void ReplicationServer_Init(ReplicationServer *server) {
+  for (uint32_t i = 0; i < REPL_HISTORY; i++) {
+    Repl_ClearSnapshot(&server->history[i]);
+  }
+  for (uint32_t c = 0; c < REPL_MAX_CLIENTS; c++) {
+    server->clients[c] = {.transport = nullptr, .ackedSeq = REPL_NO_BASELINE};
+  }
+  server->nextSeq = 0;
+  server->stats = {};
+}
+
+int32_t ReplicationServer_AddClient(ReplicationServer *server,
+                                    Transport *transport) {
+  for (uint32_t c = 0; c < REPL_MAX_CLIENTS; c++) {
+    if (!server->clients[c].transport) {
+      server->clients[c] = {.transport = transport,
+                            .ackedSeq = REPL_NO_BASELINE};
+      return static_cast<int32_t>(c);
+    }
+  }
+  Log(LogLevel::Warning, "ReplicationServer_AddClient: All {} slots taken",
+      REPL_MAX_CLIENTS);
+  return -1;
+}
+
+void ReplicationServer_RemoveClient(ReplicationServer *server,
+                                    int32_t client) {
+  if (client < 0 || client >= static_cast<int32_t>(REPL_MAX_CLIENTS))
+    return;
+  server->clients[client] = {.transport = nullptr,
+                             .ackedSeq = REPL_NO_BASELINE};
+}
+
+uint32_t ReplicationServer_Capture(ReplicationServer *server,
+                                   const EntityRegistry &reg) {
+  const uint32_t seq = server->nextSeq++;
+  ReplSnapshot *restrict snap = &server->history[Repl_Slot(seq)];
+  const uint32_t bound = reg.max_used_bound;
+  const uint32_t oldBound = snap->bound;
+
+  const creVec2 *restrict pos = reg.pos;
+  const creVec2 *restrict vel = reg.vel;
+  const uint64_t *restrict flags = reg.state_flags;
+
+  for (uint32_t i = 0; i < bound; i++) {
+    const bool active = (flags[i] & FLAG_ACTIVE) != 0;
+    // Inactive slots replicate as all-zero so despawns are a plain delta
+    snap->posX[i] = active ? Repl_QuantizePos(pos[i].x) : 0;
+    snap->posY[i] = active ? Repl_QuantizePos(pos[i].y) : 0;
+    snap->velX[i] = active ? Repl_QuantizeVel(vel[i].x) : 0;
+    snap->velY[i] = active ? Repl_QuantizeVel(vel[i].y) : 0;
+    snap->sprite[i] = active ? reg.sprite_ids[i] : 0;
+    snap->animFrame[i] = active ? reg.anim_frames[i] : 0;
+    snap->flags[i] =
+        active ? static_cast<uint16_t>(flags[i] & REPL_FLAGS_MASK) : 0;
+  }
+
+  // Keep the "zero beyond bound" invariant the delta relies on
+  for (uint32_t i = bound; i < oldBound; i++) {
+    snap->posX[i] = 0;
+    snap->posY[i] = 0;
+    snap->velX[i] = 0;
+    snap->velY[i] = 0;
+    snap->sprite[i] = 0;
+    snap->animFrame[i] = 0;
+    snap->flags[i] = 0;
+  }
+
+  snap->seq = seq;
+  snap->bound = bound;
+  return seq;
+}
+
+uint32_t ReplicationServer_Send(ReplicationServer *server, int32_t client) {
+  if (client < 0 || client >= static_cast<int32_t>(REPL_MAX_CLIENTS) ||
+      !server->clients[client].transport || server->nextSeq == 0) {
+    return 0;
+  }
+
+  ReplClientSlot *slot = &server->clients[client];
+  const uint32_t seq = server->nextSeq - 1;
+  const ReplSnapshot *restrict cur = &server->history[Repl_Slot(seq)];
+
+  // Use the acked snapshot as baseline while it is still in the ring
+  const ReplSnapshot *restrict base = &s_emptySnapshot;
+  uint32_t baseSeq = REPL_NO_BASELINE;
+  if (slot->ackedSeq != REPL_NO_BASELINE &&
+      (seq - slot->ackedSeq) < REPL_HISTORY &&
+      server->history[Repl_Slot(slot->ackedSeq)].seq == slot->ackedSeq) {
+    baseSeq = slot->ackedSeq;
+    base = &server->history[Repl_Slot(baseSeq)];
+  }
+
+  const uint32_t range = (cur->bound > base->bound) ? cur->bound : base->bound;
+
+  // Pass 1: field masks (branch-free, straight column compares)
+  uint8_t *restrict mask = server->changeMask;
+  uint32_t changed = 0;
+  for (uint32_t i = 0; i < range; i++) {
+    uint8_t m = 0;
+    m |= ((cur->posX[i] != base->posX[i]) | (cur->posY[i] != base->posY[i]))
+             ? REPL_FIELD_POS
+             : 0;
+    m |= ((cur->velX[i] != base->velX[i]) | (cur->velY[i] != base->velY[i]))
+             ? REPL_FIELD_VEL
+             : 0;
+    m |= (cur->sprite[i] != base->sprite[i]) ? REPL_FIELD_SPRITE : 0;
+    m |= (cur->animFrame[i] != base->animFrame[i]) ? REPL_FIELD_ANIM : 0;
+    m |= (cur->flags[i] != base->flags[i]) ? REPL_FIELD_FLAGS : 0;
+    mask[i] = m;
+    changed += (m != 0);
+  }
+
+  // Pass 2: bit-pack the changed entities
+  BitWriter w;
+  BitWriter_Init(&w, server->packet, REPL_MAX_PACKET);
+  BitWriter_Write(&w, REPL_MSG_SNAPSHOT, 8);
+  BitWriter_Write(&w, seq, 32);
+  BitWriter_Write(&w, baseSeq, 32);
+  BitWriter_Write(&w, cur->bound, 16);
+  BitWriter_Write(&w, changed, 16);
+
+  uint32_t prev = 0;
+  bool first = true;
+  for (uint32_t i = 0; i < range; i++) {
+    const uint8_t m = mask[i];
+    if (!m)
+      continue;
+
+    BitWriter_WriteVarUint(&w, first ? i : (i - prev - 1), REPL_GAP_GROUP);
+    BitWriter_Write(&w, m, REPL_FIELD_BITS);
+    prev = i;
+    first = false;
+
+    if (m & REPL_FIELD_POS) {
+      BitWriter_WriteVarInt(&w, Repl_Delta32(cur->posX[i], base->posX[i]),
+                            REPL_POS_GROUP);
+      BitWriter_WriteVarInt(&w, Repl_Delta32(cur->posY[i], base->posY[i]),
+                            REPL_POS_GROUP);
+    }
+    if (m & REPL_FIELD_VEL) {
+      BitWriter_WriteVarInt(&w, cur->velX[i] - base->velX[i], REPL_VEL_GROUP);
+      BitWriter_WriteVarInt(&w, cur->velY[i] - base->velY[i], REPL_VEL_GROUP);
+    }
+    if (m & REPL_FIELD_SPRITE) {
+      BitWriter_WriteVarInt(&w, cur->sprite[i] - base->sprite[i],
+                            REPL_SMALL_GROUP);
+    }
+    if (m & REPL_FIELD_ANIM) {
+      BitWriter_WriteVarInt(&w, cur->animFrame[i] - base->animFrame[i],
+                            REPL_SMALL_GROUP);
+    }
+    if (m & REPL_FIELD_FLAGS) {
+      BitWriter_Write(&w, cur->flags[i], 16);
+    }
+  }
+
+  const uint32_t bytes = BitWriter_Flush(&w);
+  if (bytes == 0) {
+    Log(LogLevel::Error,
+        "ReplicationServer_Send: Snapshot {} exceeds {} bytes ({} changed)",
+        seq, REPL_MAX_PACKET, changed);
+    return 0;
+  }
+
+  Transport *t = slot->transport;
+  if (!t->Send(t->user, server->packet, bytes)) {
+    Log(LogLevel::Warning, "ReplicationServer_Send: Transport is full!");
+    return 0;
+  }
+
+  ReplicationStats *stats = &server->stats;
+  stats->lastBytes = bytes;
+  stats->lastChanged = changed;
+  stats->lastBaseline = baseSeq;
+  stats->totalBytes += bytes;
+  stats->snapshotsSent++;
+  stats->fullSnapshots += (baseSeq == REPL_NO_BASELINE);
+  return bytes;
+}
+
+void ReplicationServer_ReceiveAcks(ReplicationServer *server) {
+  uint8_t buffer[16];
+  for (uint32_t c = 0; c < REPL_MAX_CLIENTS; c++) {
+    ReplClientSlot *slot = &server->clients[c];
+    Transport *t = slot->transport;
+    if (!t)
+      continue;
+
+    uint32_t size;
+    while ((size = t->Receive(t->user, buffer, sizeof(buffer))) != 0) {
+      BitReader r;
+      BitReader_Init(&r, buffer, size);
+      if (BitReader_Read(&r, 8) != REPL_MSG_ACK)
+        continue;
+      const uint32_t acked = BitReader_Read(&r, 32);
+      if (r.overflow)
+        continue;
+      // Keep the newest ack (sequence numbers wrap)
+      if (slot->ackedSeq == REPL_NO_BASELINE ||
+          static_cast<int32_t>(acked - slot->ackedSeq) > 0) {
+        slot->ackedSeq = acked;
+      }
+    }
+  }
+}
+
+// ============================================================================
+// Client
+// ============================================================================
+
+void ReplicationClient_Init(ReplicationClient *client, Transport *transport) {
+  for (uint32_t i = 0; i < REPL_HISTORY; i++) {
+    Repl_ClearSnapshot(&client->history[i]);
+  }
+  client->transport = transport;
+  client->latestSeq = REPL_NO_BASELINE;
+  client->decoded = 0;
+  client->rejected = 0;
+}
+
+static bool ReplicationClient_Decode(ReplicationClient *client,
+                                     const uint8_t *data, uint32_t size,
+                                     uint32_t *outSeq) {
+  BitReader r;
+  BitReader_Init(&r, data, size);
+  if (BitReader_Read(&r, 8) != REPL_MSG_SNAPSHOT)
+    return false;
+
+  const uint32_t seq = BitReader_Read(&r, 32);
+  const uint32_t baseSeq = BitReader_Read(&r, 32);
+  const uint32_t bound = BitReader_Read(&r, 16);
+  const uint32_t changed = BitReader_Read(&r, 16);
+  if (r.overflow || bound > MAX_ENTITIES || seq == REPL_NO_BASELINE)
+    return false;
+
+  const ReplSnapshot *base = &s_emptySnapshot;
+  if (baseSeq != REPL_NO_BASELINE) {
+    base = &client->history[Repl_Slot(baseSeq)];
+    if (base->seq != baseSeq)
+      return false; // Baseline already overwritten or never received
+  }
+
+  ReplSnapshot *restrict snap = &client->history[Repl_Slot(seq)];
+  if (snap == base)
+    return false;
+
+  // Start from the baseline (zero beyond its bound), then apply deltas
+  uint32_t copyRange = (snap->bound > base->bound) ? snap->bound : base->bound;
+  if (bound > copyRange)
+    copyRange = bound;
+  memcpy(snap->posX, base->posX, sizeof(int32_t) * copyRange);
+  memcpy(snap->posY, base->posY, sizeof(int32_t) * copyRange);
+  memcpy(snap->velX, base->velX, sizeof(int16_t) * copyRange);
+  memcpy(snap->velY, base->velY, sizeof(int16_t) * copyRange);
+  memcpy(snap->sprite, base->sprite, sizeof(uint16_t) * copyRange);
+  memcpy(snap->animFrame, base->animFrame, sizeof(uint16_t) * copyRange);
+  memcpy(snap->flags, base->flags, sizeof(uint16_t) * copyRange);
+  snap->seq = REPL_NO_BASELINE; // Invalid until fully decoded
+
+  uint32_t index = 0;
+  for (uint32_t k = 0; k < changed; k++) {
+    const uint32_t gap = BitReader_ReadVarUint(&r, REPL_GAP_GROUP);
+    index = (k == 0) ? gap : (index + gap + 1);
+    const uint32_t m = BitReader_Read(&r, REPL_FIELD_BITS);
+    if (r.overflow || index >= MAX_ENTITIES || index >= copyRange)
+      return false;
+
+    if (m & REPL_FIELD_POS) {
+      snap->posX[index] = Repl_Add32(snap->posX[index],
+                                     BitReader_ReadVarInt(&r, REPL_POS_GROUP));
+      snap->posY[index] = Repl_Add32(snap->posY[index],
+                                     BitReader_ReadVarInt(&r, REPL_POS_GROUP));
+    }
+    if (m & REPL_FIELD_VEL) {
+      snap->velX[index] = static_cast<int16_t>(
+          snap->velX[index] + BitReader_ReadVarInt(&r, REPL_VEL_GROUP));
+      snap->velY[index] = static_cast<int16_t>(
+          snap->velY[index] + BitReader_ReadVarInt(&r, REPL_VEL_GROUP));
+    }
+    if (m & REPL_FIELD_SPRITE) {
+      snap->sprite[index] = static_cast<uint16_t>(
+          snap->sprite[index] + BitReader_ReadVarInt(&r, REPL_SMALL_GROUP));
+    }
+    if (m & REPL_FIELD_ANIM) {
+      snap->animFrame[index] = static_cast<uint16_t>(
+          snap->animFrame[index] + BitReader_ReadVarInt(&r, REPL_SMALL_GROUP));
+    }
+    if (m & REPL_FIELD_FLAGS) {
+      snap->flags[index] = static_cast<uint16_t>(BitReader_Read(&r, 16));
+    }
+  }
+  if (r.overflow)
+    return false;
+
+  snap->bound = bound;
+  snap->seq = seq;
+  *outSeq = seq;
+  return true;
+}
+
+uint32_t ReplicationClient_Receive(ReplicationClient *client) {
+  Transport *t = client->transport;
+  if (!t)
+    return 0;
+
+  uint32_t decodedNow = 0;
+  uint32_t size;
+  while ((size = t->Receive(t->user, client->packet, REPL_MAX_PACKET)) != 0) {
+    uint32_t seq = 0;
+    if (!ReplicationClient_Decode(client, client->packet, size, &seq)) {
+      client->rejected++;
+      continue;
+    }
+
+    if (client->latestSeq == REPL_NO_BASELINE ||
+        static_cast<int32_t>(seq - client->latestSeq) > 0) {
+      client->latestSeq = seq;
+    }
+    client->decoded++;
+    decodedNow++;
+
+    uint8_t ack[5];
+    BitWriter w;
+    BitWriter_Init(&w, ack, sizeof(ack));
+    BitWriter_Write(&w, REPL_MSG_ACK, 8);
+    BitWriter_Write(&w, seq, 32);
+    const uint32_t ackBytes = BitWriter_Flush(&w);
+    if (!t->Send(t->user, ack, ackBytes)) {
+      Log(LogLevel::Warning, "ReplicationClient_Receive: Ack dropped!");
+    }
+  }
+  return decodedNow;
+}
+
+const ReplSnapshot *ReplicationClient_Latest(const ReplicationClient *client) {
+  if (client->latestSeq == REPL_NO_BASELINE)
+    return nullptr;
+  const ReplSnapshot *snap = &client->history[Repl_Slot(client->latestSeq)];
+  return (snap->seq == client->latestSeq) ? snap : nullptr;
+}
+
+void ReplicationClient_Apply(const ReplicationClient *client,
+                             EntityRegistry &reg) {
+  const ReplSnapshot *snap = ReplicationClient_Latest(client);
+  if (!snap)
+    return;
+
+  const float invScale = 1.0f / REPL_POS_SCALE;
+  for (uint32_t i = 0; i < snap->bound; i++) {
+    reg.pos[i].x = static_cast<float>(snap->posX[i]) * invScale;
+    reg.pos[i].y = static_cast<float>(snap->posY[i]) * invScale;
+    reg.vel[i].x = static_cast<float>(snap->velX[i]);
+    reg.vel[i].y = static_cast<float>(snap->velY[i]);
+    reg.sprite_ids[i] = snap->sprite[i];
+    reg.anim_frames[i] = snap->animFrame[i];
+    // Replicated FLAG_ACTIVE spawns and despawns: count physics and
+    // children too
+    const uint64_t oldFlags = reg.state_flags[i];
+    const uint64_t comps = reg.component_masks[i];
+    reg.state_flags[i] = (oldFlags & ~REPL_FLAGS_MASK) | snap->flags[i];
+    EntityCounters_OnEntity(&reg.counters, oldFlags, comps,
+                            reg.state_flags[i], comps);
+  }
+}
@@ -0,0 +1,152 @@
+/**
+ * @file cre_replication.h
+ * @brief Snapshot Replication (Delta vs Last Acked Baseline)
+ *
+ * Server side, once per tick:
+ *   1. ReplicationServer_Capture quantizes the replicated registry columns
+ *      into a ring of REPL_HISTORY snapshots.
+ *   2. ReplicationServer_Send encodes, per client, only the entities whose
+ *      quantized state differs from the snapshot that client last acked
+ *      (or from an empty state if it acked nothing recent) and bit-packs
+ *      the field deltas.
+ *   3. ReplicationServer_ReceiveAcks drains the clients' acks.
+ *
+ * Client side, ReplicationClient_Receive decodes snapshots against its own
+ * copy of the referenced baseline, stores the result in its ring, and acks
+ * it. ReplicationClient_Apply writes the latest state into a registry.
+ *
+ * Replicated columns and quantization:
+ *   pos          1/8 px, int32, zigzag varint delta
+ *   vel          1 px/s, int16 (clamped), zigzag varint delta
+ *   sprite_ids   u16, varint delta
+ *   anim_frames  u16, varint delta
+ *   state_flags  behavioural bits 0-15, raw
+ */
+
+#ifndef CRE_REPLICATION_H
+#define CRE_REPLICATION_H
+
+#include "engine/core/cre_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+struct EntityRegistry;
+struct Transport;
+
+constexpr uint32_t REPL_HISTORY = 16; // Snapshot ring (power of two)
+constexpr uint32_t REPL_MAX_CLIENTS = 8;
+constexpr uint32_t REPL_MAX_PACKET = 256 * 1024;
+constexpr uint32_t REPL_NO_BASELINE = 0xFFFFFFFFu;
+constexpr float REPL_POS_SCALE = 8.0f; // 1/8 px
+
+/**
+ * @brief Quantized replicated state (SoA).
+ */
+struct ReplSnapshot {
+  alignas(64) int32_t posX[MAX_ENTITIES];
+  alignas(64) int32_t posY[MAX_ENTITIES];
+  alignas(64) int16_t velX[MAX_ENTITIES];
+  alignas(64) int16_t velY[MAX_ENTITIES];
+  alignas(64) uint16_t sprite[MAX_ENTITIES];
+  alignas(64) uint16_t animFrame[MAX_ENTITIES];
+  alignas(64) uint16_t flags[MAX_ENTITIES];
+  uint32_t seq;   // REPL_NO_BASELINE = slot empty
+  uint32_t bound; // Entities [0, bound) are meaningful
+};
+
+struct ReplClientSlot {
+  Transport *transport; // nullptr = free slot
+  uint32_t ackedSeq;    // REPL_NO_BASELINE until the first ack
+};
+
+struct ReplicationStats {
+  uint32_t lastBytes;     // Size of the last encoded snapshot
+  uint32_t lastChanged;   // Entities written in the last snapshot
+  uint32_t lastBaseline;  // Baseline seq of the last snapshot
+  uint64_t totalBytes;
+  uint32_t snapshotsSent;
+  uint32_t fullSnapshots; // Sent without a baseline
+};
+
+/**
+ * @brief Server replication state. Caller-owned (~5MB, use an arena).
+ */
+struct ReplicationServer {
+  ReplSnapshot history[REPL_HISTORY];
+  ReplClientSlot clients[REPL_MAX_CLIENTS];
+  uint32_t nextSeq;
+  ReplicationStats stats;
+  alignas(64) uint8_t changeMask[MAX_ENTITIES]; // Encode scratch
+  alignas(64) uint8_t packet[REPL_MAX_PACKET];
+};
+
+/**
+ * @brief Client replication state. Caller-owned (~5MB, use an arena).
+ */
+struct ReplicationClient {
+  ReplSnapshot history[REPL_HISTORY];
+  Transport *transport;
+  uint32_t latestSeq; // REPL_NO_BASELINE until the first snapshot
+  uint32_t decoded;
+  uint32_t rejected;  // Missing baseline or malformed
+  alignas(64) uint8_t packet[REPL_MAX_PACKET];
+};
+
+// ============================================================================
+// Server
+// ============================================================================
+
+void ReplicationServer_Init(ReplicationServer *server);
+
+/**
+ * @brief Register a client endpoint.
+ * @return Client index, or -1 if every slot is taken
+ */
+int32_t ReplicationServer_AddClient(ReplicationServer *server,
+                                    Transport *transport);
+
+void ReplicationServer_RemoveClient(ReplicationServer *server, int32_t client);
+
+/**
+ * @brief Quantize the registry into the next history slot.
+ * @return Sequence number of the captured snapshot
+ */
+uint32_t ReplicationServer_Capture(ReplicationServer *server,
+                                   const EntityRegistry &reg);
+
+/**
+ * @brief Encode the latest capture for one client and send it.
+ * @return Bytes sent, 0 on failure
+ */
+uint32_t ReplicationServer_Send(ReplicationServer *server, int32_t client);
+
+/**
+ * @brief Drain acks from every client transport.
+ */
+void ReplicationServer_ReceiveAcks(ReplicationServer *server);
+
+// ============================================================================
+// Client
+// ============================================================================
+
+void ReplicationClient_Init(ReplicationClient *client, Transport *transport);
+
+/**
+ * @brief Decode every pending snapshot and ack the ones that decoded.
+ * @return Number of snapshots decoded
+ */
+uint32_t ReplicationClient_Receive(ReplicationClient *client);
+
+/**
+ * @brief Latest decoded snapshot, nullptr before the first one.
+ */
+const ReplSnapshot *ReplicationClient_Latest(const ReplicationClient *client);
+
+/**
+ * @brief Write the latest snapshot into a registry (pos, vel, sprite,
+ * anim frame, behavioural flags). Other columns are left untouched.
+ */
+void ReplicationClient_Apply(const ReplicationClient *client,
+                             EntityRegistry &reg);
+
+#endif
@@ -0,0 +1,124 @@
+#include "cre_transport.h"
+#include "engine/core/cre_logger.h"
+#include <string.h>
+
+static_assert((LOOPBACK_QUEUE_BYTES & (LOOPBACK_QUEUE_BYTES - 1)) == 0,
+              "Loopback queue size must be a power of two");
+
+static constexpr uint32_t LOOPBACK_MASK = LOOPBACK_QUEUE_BYTES - 1;
+
+static void Queue_Reset(LoopbackQueue *q) {
+  q->head = 0;
+  q->tail = 0;
+  q->sent = 0;
+  q->dropped = 0;
+  q->dropOneIn = 0;
+}
+
+// Copy across the ring seam
+static void Queue_Write(LoopbackQueue *q, uint32_t offset, const void *src,
+                        uint32_t size) {
+  const uint32_t start = offset & LOOPBACK_MASK;
+  const uint32_t first = (size < LOOPBACK_QUEUE_BYTES - start)
+                             ? size
+                             : (LOOPBACK_QUEUE_BYTES - start);
+  memcpy(q->bytes + start, src, first);
+  memcpy(q->bytes, static_cast<const uint8_t *>(src) + first, size - first);
+}
+
+static void Queue_Read(const LoopbackQueue *q, uint32_t offset, void *dst,
+                       uint32_t size) {
+  const uint32_t start = offset & LOOPBACK_MASK;
+  const uint32_t first = (size < LOOPBACK_QUEUE_BYTES - start)
+                             ? size
+                             : (LOOPBACK_QUEUE_BYTES - start);
+  memcpy(dst, q->bytes + start, first);
+  memcpy(static_cast<uint8_t *>(dst) + first, q->bytes, size - first);
+}
+
+static bool Queue_Push(LoopbackQueue *q, const uint8_t *data, uint32_t size) {
+  q->sent++;
+  if (q->dropOneIn != 0 && (q->sent % q->dropOneIn) == 0) {
+    q->dropped++;
+    return true; // Lost on the "wire", the sender can't tell
+  }
+
+  const uint32_t used = q->head - q->tail;
+  const uint32_t needed = size + static_cast<uint32_t>(sizeof(uint32_t));
+  if (needed > LOOPBACK_QUEUE_BYTES - used) {
+    q->dropped++;
+    return false;
+  }
+
+  Queue_Write(q, q->head, &size, sizeof(size));
+  Queue_Write(q, q->head + sizeof(uint32_t), data, size);
+  q->head += needed;
+  return true;
+}
+
+// 0 means empty: skip messages the receiver can never hold instead of
+// returning 0 for them, or everything queued behind waits a frame.
+static uint32_t Queue_Pop(LoopbackQueue *q, uint8_t *out, uint32_t capacity) {
+  while (q->head != q->tail) {
+    uint32_t size = 0;
+    Queue_Read(q, q->tail, &size, sizeof(size));
+    const uint32_t consumed = size + static_cast<uint32_t>(sizeof(uint32_t));
+    if (size > capacity) {
+      q->tail += consumed;
+      q->dropped++;
+      Log(LogLevel::Warning,
+          "[NET] Dropped a {} byte message, receive buffer holds {}", size,
+          capacity);
+      continue;
+    }
+
+    Queue_Read(q, q->tail + sizeof(uint32_t), out, size);
+    q->tail += consumed;
+    return size;
+  }
+  return 0;
+}
+
+// ============================================================================
+// Endpoint Tables
+// ============================================================================
+
+static bool Loopback_ServerSend(void *user, const uint8_t *data,
+                                uint32_t size) {
+  return Queue_Push(&static_cast<LoopbackLink *>(user)->toClient, data, size);
+}
+
+static uint32_t Loopback_ServerReceive(void *user, uint8_t *out,
+                                       uint32_t capacity) {
+  return Queue_Pop(&static_cast<LoopbackLink *>(user)->toServer, out,
+                   capacity);
+}
+
+static bool Loopback_ClientSend(void *user, const uint8_t *data,
+                                uint32_t size) {
+  return Queue_Push(&static_cast<LoopbackLink *>(user)->toServer, data, size);
+}
+
+static uint32_t Loopback_ClientReceive(void *user, uint8_t *out,
+                                       uint32_t capacity) {
+  return Queue_Pop(&static_cast<LoopbackLink *>(user)->toClient, out,
+                   capacity);
+}
+
+void LoopbackTransport_Init(LoopbackLink *link, Transport *serverSide,
+                            Transport *clientSide) {
+  Queue_Reset(&link->toClient);
+  Queue_Reset(&link->toServer);
+
+  *serverSide = {.user = link,
+                 .Send = Loopback_ServerSend,
+                 .Receive = Loopback_ServerReceive};
+  *clientSide = {.user = link,
+                 .Send = Loopback_ClientSend,
+                 .Receive = Loopback_ClientReceive};
+}
+
+void LoopbackTransport_SetLoss(LoopbackLink *link, uint32_t dropOneIn) {
+  link->toClient.dropOneIn = dropOneIn;
+  link->toServer.dropOneIn = dropOneIn;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file cre_transport.h
+ * @brief Pluggable Message Transport + In-Process Loopback
+ *
+ * Replication only talks to a Transport: an opaque user pointer plus two
+ * function pointers that move whole messages. Real sockets (UDP with
+ * fragmentation) plug in behind the same table later.
+ *
+ * The loopback implementation connects two endpoints inside one process
+ * through fixed byte rings, so replication can be tested and benchmarked
+ * without a network. It can drop every Nth message to exercise the
+ * baseline/ack recovery paths.
+ */
+
+#ifndef CRE_TRANSPORT_H
+#define CRE_TRANSPORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct Transport {
+  void *user;
+  /// Queue one message. Returns false if it could not be queued.
+  bool (*Send)(void *user, const uint8_t *data, uint32_t size);
+  /// Pop the next message into out. Returns its size, 0 if none (or too big).
+  uint32_t (*Receive)(void *user, uint8_t *out, uint32_t capacity);
+};
+
+// ============================================================================
+// Loopback
+// ============================================================================
+
+constexpr uint32_t LOOPBACK_QUEUE_BYTES = 1024 * 1024; // Per direction
+
+/**
+ * @brief Single-direction message ring (u32 size prefix + payload).
+ */
+struct LoopbackQueue {
+  alignas(64) uint8_t bytes[LOOPBACK_QUEUE_BYTES];
+  uint32_t head;     // Write offset (monotonic)
+  uint32_t tail;     // Read offset (monotonic)
+  uint32_t sent;     // Messages accepted
+  uint32_t dropped;  // Messages dropped (full, simulated loss, too large)
+  uint32_t dropOneIn; // 0 = lossless, N = drop every Nth message
+};
+
+/**
+ * @brief One queue per direction. Caller-owned (2MB,
+ * allocate from an arena).
+ */
+struct LoopbackLink {
+  LoopbackQueue toClient;
+  LoopbackQueue toServer;
+};
+
+/**
+ * @brief Reset both queues and fill the two endpoint tables.
+ */
+void LoopbackTransport_Init(LoopbackLink *link, Transport *serverSide,
+                            Transport *clientSide);
+
+/**
+ * @brief Simulated loss (both directions). 0 disables it.
+ */
+void LoopbackTransport_SetLoss(LoopbackLink *link, uint32_t dropOneIn);
+
+#endif
@@ -0,0 +1,118 @@
+#include "cre_framePacer.h"
+#include "engine/core/cre_config.h"
+#include "engine/platform/cre_sys.h"
+#include "raylib.h"
+
+// Per-frame samples, FRAME_PACER_HISTORY deep (seconds)
+static float s_cost[FRAME_PACER_HISTORY];     // Poll to swap call
+static float s_wait[FRAME_PACER_HISTORY];     // Wait before the poll
+static float s_interval[FRAME_PACER_HISTORY]; // Previous poll to this poll
+static float s_present[FRAME_PACER_HISTORY];  // Poll to swap return
+static uint32_t s_head = 0;
+static uint32_t s_count = 0;
+
+static double s_period = 0.0;   // 0 when unpaced
+static double s_deadline = 0.0; // Present target of the current frame
+static double s_pollTime = 0.0;
+static double s_prevPollTime = 0.0;
+static float s_waited = 0.0f;
+static uint32_t s_late = 0;
+
+// Slowest recent frame plus margin, never more than a period.
+static double FramePacer_Budget(void) {
+  float slowest = 0.0f;
+  for (uint32_t i = 0; i < s_count; i++) {
+    if (s_cost[i] > slowest)
+      slowest = s_cost[i];
+  }
+  const double budget = static_cast<double>(slowest) + FRAME_PACER_MARGIN;
+  return budget < s_period ? budget : s_period;
+}
+
+// Sleep most of the way, spin the last FRAME_PACER_SPIN.
+static void FramePacer_WaitUntil(double wake) {
+  const double sleepFor = wake - FRAME_PACER_SPIN - Platform_GetTime();
+  if (sleepFor > 0.0)
+    WaitTime(sleepFor);
+  while (Platform_GetTime() < wake) {
+  }
+}
+
+void FramePacer_Init(uint32_t targetFps) {
+  s_period = targetFps > 0 ? 1.0 / static_cast<double>(targetFps) : 0.0;
+  s_head = 0;
+  s_count = 0;
+  s_late = 0;
+  s_pollTime = Platform_GetTime();
+  s_prevPollTime = s_pollTime;
+  s_deadline = s_pollTime + s_period;
+}
+
+void FramePacer_BeginFrame(void) {
+  const double start = Platform_GetTime();
+  if (s_period > 0.0) {
+    const double wake = s_deadline - FramePacer_Budget();
+    if (wake > start)
+      FramePacer_WaitUntil(wake);
+  }
+
+  s_prevPollTime = s_pollTime;
+  s_pollTime = Platform_GetTime();
+  s_waited = static_cast<float>(s_pollTime - start);
+  PollInputEvents();
+}
+
+void FramePacer_Present(void) {
+  const double swapStart = Platform_GetTime();
+  SwapScreenBuffer();
+  const double present = Platform_GetTime();
+
+  s_cost[s_head] = static_cast<float>(swapStart - s_pollTime);
+  s_wait[s_head] = s_waited;
+  s_interval[s_head] = static_cast<float>(s_pollTime - s_prevPollTime);
+  s_present[s_head] = static_cast<float>(present - s_pollTime);
+  s_head = (s_head + 1U) % FRAME_PACER_HISTORY;
+  if (s_count < FRAME_PACER_HISTORY)
+    s_count++;
+
+  if (s_period <= 0.0)
+    return;
+  if (present > s_deadline + FRAME_PACER_MARGIN)
+    s_late++;
+  // Overran or the swap blocked: restart the grid from this present
+  if (present > s_deadline)
+    s_deadline = present;
+  s_deadline += s_period;
+}
+
+double FramePacer_GetInputTime(void) { return s_pollTime; }
+
+FramePacerStats FramePacer_GetStats(void) {
+  FramePacerStats stats = {.costMs = 0.0f,
+                           .costMaxMs = 0.0f,
+                           .waitMs = 0.0f,
+                           .latencyMs = 0.0f,
+                           .latencyMaxMs = 0.0f,
+                           .frames = s_count,
+                           .late = s_late};
+  if (s_count == 0)
+    return stats;
+
+  for (uint32_t i = 0; i < s_count; i++) {
+    const float latencyMax = s_interval[i] + s_present[i];
+    stats.costMs += s_cost[i];
+    stats.waitMs += s_wait[i];
+    stats.latencyMs += 0.5f * s_interval[i] + s_present[i];
+    if (s_cost[i] > stats.costMaxMs)
+      stats.costMaxMs = s_cost[i];
+    if (latencyMax > stats.latencyMaxMs)
+      stats.latencyMaxMs = latencyMax;
+  }
+  const float toAvgMs = 1000.0f / static_cast<float>(s_count);
+  stats.costMs *= toAvgMs;
+  stats.waitMs *= toAvgMs;
+  stats.latencyMs *= toAvgMs;
+  stats.costMaxMs *= 1000.0f;
+  stats.latencyMaxMs *= 1000.0f;
+  return stats;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file cre_framePacer.h
+ * @brief Frame Pacing (Late Input Sampling, Spin-Plus-Sleep Wait)
+ *
+ * Replaces raylib's SetTargetFPS timing, which swaps, sleeps out the rest
+ * of the period and then polls. When the swap blocks until the display's
+ * refresh (vsync forced by the driver or compositor), that poll happens
+ * right after a refresh and waits a whole period to be shown. The pacer
+ * schedules each present on a deadline grid and starts the frame as late
+ * as it can instead: it waits until deadline - estimated cost, polls input,
+ * and the frame built from it is presented at the deadline. Input is then
+ * shown the frame's actual CPU cost after it was sampled.
+ *
+ * The estimate is the slowest of the last FRAME_PACER_HISTORY frames (poll
+ * to swap) plus FRAME_PACER_MARGIN, capped at one period. A present
+ * after its deadline (an overrun, or a swap that blocked until the refresh)
+ * restarts the grid from that present, which keeps it locked to vsync.
+ *
+ * Waits sleep until FRAME_PACER_SPIN before the wake time and spin the
+ * rest: OS sleeps overshoot by up to a scheduler tick.
+ *
+ * Needs raylib built with SUPPORT_CUSTOM_FRAME_CONTROL (EndDrawing neither
+ * swaps, waits nor polls). Events are still polled on the main thread, as
+ * GLFW requires.
+ */
+
+#ifndef CRE_FRAMEPACER_H
+#define CRE_FRAMEPACER_H
+
+#include <stdint.h>
+
+struct FramePacerStats {
+  float costMs;       ///< Average CPU frame cost (input poll to swap)
+  float costMaxMs;    ///< Slowest frame
+  float waitMs;       ///< Average wait before the poll
+  float latencyMs;    ///< Average input-to-present estimate: half the time
+                      ///< between polls plus poll to present
+  float latencyMaxMs; ///< Worst case: a whole poll interval plus poll to
+                      ///< present
+  uint32_t frames;    ///< Frames the averages cover (<= FRAME_PACER_HISTORY)
+  uint32_t late;      ///< Frames presented more than FRAME_PACER_MARGIN
+                      ///< after their deadline, total
+};
+
+/**
+ * @brief Start the deadline grid (call after InitWindow).
+ * @param targetFps 0 runs unpaced (replays): no waits, stats still kept
+ */
+void FramePacer_Init(uint32_t targetFps);
+
+/**
+ * @brief Wait for the frame's wake time, then poll input. Call at the top
+ * of the frame, before anything reads input or time.
+ */
+void FramePacer_BeginFrame(void);
+
+/**
+ * @brief Swap buffers and advance the deadline. Call after EndDrawing.
+ */
+void FramePacer_Present(void);
+
+/**
+ * @brief Platform time at which this frame's input was polled.
+ */
+double FramePacer_GetInputTime(void);
+
+/**
+ * @brief Averages over the last FRAME_PACER_HISTORY frames.
+ */
+FramePacerStats FramePacer_GetStats(void);
+
+#endif
@@ -8,6 +8,9 @@
 // Fix naming inconsistencies in this file too.
 // Haven't decided what would be the prefix.
 static int32_t keyBindings[ACTION_COUNT];
+static InputFrame s_frame = {};
+
+static_assert(ACTION_COUNT <= 32, "InputFrame stores one bit per action");
 
 struct ActionMapping {
   // Do we really need pointers?
@@ -24,6 +27,11 @@ static constexpr ActionMapping actionTable[] = {{"UP", ACTION_UP},
                                                 {"PAUSE", ACTION_PAUSE},
                                                 {"PRIMARY", ACTION_PRIMARY},
                                                 {"SECONDARY", ACTION_SECONDARY},
+                                                {"DEBUG_OVERLAY", ACTION_DEBUG_OVERLAY},
+                                                {"DEBUG_STATS", ACTION_DEBUG_STATS},
+                                                {"DEBUG_SPAWN_HORDE", ACTION_DEBUG_SPAWN_HORDE},
+                                                {"DEBUG_SPAWN_CHAIN", ACTION_DEBUG_SPAWN_CHAIN},
+                                                {"DEBUG_MUSIC", ACTION_DEBUG_MUSIC},
                                                 {nullptr, ACTION_INVALID}};
 
 struct KeyMapping {
@@ -43,6 +51,7 @@ static constexpr KeyMapping keyTable[] = {{"SPACE", KEY_SPACE},
                                           {"LEFT_SHIFT", KEY_LEFT_SHIFT},
                                           {"CONTROL", KEY_LEFT_CONTROL},
                                           {"LEFT_CONTROL", KEY_LEFT_CONTROL},
+                                          {"F1", KEY_F1},
                                           {nullptr, KEY_NULL}};
 
 // Find action ID from String
@@ -117,19 +126,36 @@ void Input_Init(const char *configPath) {
   keyBindings[ACTION_PRIMARY] = KEY_SPACE;
   keyBindings[ACTION_SECONDARY] = KEY_LEFT_SHIFT;
 
+  // Debug
+  keyBindings[ACTION_DEBUG_OVERLAY] = KEY_F1;
+  keyBindings[ACTION_DEBUG_STATS] = KEY_TAB;
+  keyBindings[ACTION_DEBUG_SPAWN_HORDE] = KEY_Z;
+  keyBindings[ACTION_DEBUG_SPAWN_CHAIN] = KEY_C;
+  keyBindings[ACTION_DEBUG_MUSIC] = KEY_X;
+
   Input_LoadConfig(configPath);
 }
 
 bool Input_IsPressed(GameAction action) {
-  int32_t key = keyBindings[action];
-  return IsKeyPressed(key);
+  return (s_frame.pressed >> action) & 1U;
 }
 
-bool Input_IsDown(GameAction action) {
-  int32_t key = keyBindings[action];
-  return IsKeyDown(key);
-}
+bool Input_IsDown(GameAction action) { return (s_frame.down >> action) & 1U; }
 
 void Input_Remap(GameAction action, int32_t key) { keyBindings[action] = key; }
 
-void Input_Poll(void) {}
+void Input_Poll(void) {
+  InputFrame frame = {};
+  for (uint32_t i = 0; i < ACTION_COUNT; i++) {
+    const int32_t key = keyBindings[i];
+    if (IsKeyDown(key))
+      frame.down |= (1U << i);
+    if (IsKeyPressed(key))
+      frame.pressed |= (1U << i);
+  }
+  s_frame = frame;
+}
+
+InputFrame Input_GetFrame(void) { return s_frame; }
+
+void Input_SetFrame(InputFrame frame) { s_frame = frame; }
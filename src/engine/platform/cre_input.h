@@ -18,10 +18,26 @@ typedef enum {
   ACTION_PRIMARY,
   ACTION_SECONDARY,
 
+  // Debug tools (recorded like every other action)
+  ACTION_DEBUG_OVERLAY,
+  ACTION_DEBUG_STATS,
+  ACTION_DEBUG_SPAWN_HORDE,
+  ACTION_DEBUG_SPAWN_CHAIN,
+  ACTION_DEBUG_MUSIC,
+
   ACTION_COUNT,
   ACTION_INVALID = 255 // This is temporary fix.
 } GameAction;
 
+/**
+ * @brief Per-frame action state, one bit per GameAction.
+ * Captured once by Input_Poll so recording/replay can swap the source.
+ */
+struct InputFrame {
+  uint32_t down;
+  uint32_t pressed;
+};
+
 void Input_Init(const char *configPath);
 
 bool Input_IsPressed(GameAction action);
@@ -30,6 +46,16 @@ bool Input_IsDown(GameAction action);
 
 void Input_Remap(GameAction action, int32_t key);
 
+/**
+ * @brief Sample raylib once for every bound action (call once per frame).
+ */
 void Input_Poll(void);
 
+InputFrame Input_GetFrame(void);
+
+/**
+ * @brief Override this frame's action state (replay playback).
+ */
+void Input_SetFrame(InputFrame frame);
+
 #endif
@@ -0,0 +1,28 @@
+// Input shim for the headless server target (no raylib, no keyboard).
+// Implements the cre_input.h contract: the action state only ever comes from
+// Input_SetFrame (replay playback), Input_Poll keeps it.
+#include "cre_input.h"
+
+static InputFrame s_frame = {};
+
+void Input_Init(const char *configPath) {
+  (void)configPath;
+  s_frame = InputFrame{.down = 0, .pressed = 0};
+}
+
+bool Input_IsPressed(GameAction action) {
+  return (s_frame.pressed >> action) & 1U;
+}
+
+bool Input_IsDown(GameAction action) { return (s_frame.down >> action) & 1U; }
+
+void Input_Remap(GameAction action, int32_t key) {
+  (void)action;
+  (void)key;
+}
+
+void Input_Poll(void) {}
+
+InputFrame Input_GetFrame(void) { return s_frame; }
+
+void Input_SetFrame(InputFrame frame) { s_frame = frame; }
@@ -0,0 +1,81 @@
+// Platform shim for the headless server target (no raylib, no window).
+// Implements the same cre_sys.h contract as cre_sys.cpp.
+#include "cre_sys.h"
+#include <stdio.h>
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <sys/stat.h>
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+static char s_appDir[1024] = {};
+
+const char *Platform_GetAppDir(void) {
+  if (s_appDir[0] != '\0')
+    return s_appDir;
+
+#if defined(_WIN32)
+  DWORD len = GetModuleFileNameA(nullptr, s_appDir, sizeof(s_appDir));
+#else
+  ssize_t len = readlink("/proc/self/exe", s_appDir, sizeof(s_appDir) - 1);
+#endif
+  if (len <= 0) {
+    snprintf(s_appDir, sizeof(s_appDir), "./");
+    return s_appDir;
+  }
+  s_appDir[len] = '\0';
+
+  // Strip the executable name, keep the trailing separator (like raylib)
+  for (int i = static_cast<int>(len) - 1; i >= 0; i--) {
+    if (s_appDir[i] == '/' || s_appDir[i] == '\\') {
+      s_appDir[i + 1] = '\0';
+      break;
+    }
+  }
+  return s_appDir;
+}
+
+bool Platform_DirExists(const char *dirPath) {
+  struct stat info;
+  if (stat(dirPath, &info) != 0)
+    return false;
+  return (info.st_mode & S_IFDIR) != 0;
+}
+
+int Platform_MakeDir(const char *dirPath) {
+#if defined(_WIN32)
+  return _mkdir(dirPath) == 0 ? 0 : 1;
+#else
+  return mkdir(dirPath, 0755) == 0 ? 0 : 1;
+#endif
+}
+
+double Platform_GetTime(void) {
+#if defined(_WIN32)
+  static LARGE_INTEGER s_frequency = {};
+  static LARGE_INTEGER s_start = {};
+  LARGE_INTEGER now;
+  if (s_frequency.QuadPart == 0) {
+    QueryPerformanceFrequency(&s_frequency);
+    QueryPerformanceCounter(&s_start);
+  }
+  QueryPerformanceCounter(&now);
+  return static_cast<double>(now.QuadPart - s_start.QuadPart) /
+         static_cast<double>(s_frequency.QuadPart);
+#else
+  // Seconds since the first call, like raylib's GetTime after InitWindow
+  static double s_start = -1.0;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double now = static_cast<double>(ts.tv_sec) +
+                     static_cast<double>(ts.tv_nsec) * 1e-9;
+  if (s_start < 0.0)
+    s_start = now;
+  return now - s_start;
+#endif
+}
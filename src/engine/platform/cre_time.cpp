@@ -1,32 +1,55 @@
 #include "cre_time.h"
 #include "cre_sys.h"
+#include "engine/core/cre_config.h"
 #include "engine/core/cre_types.h"
+#include <math.h>
 
 void timeSystem_Init(TimeContext *time) {
   time->realDt = 0.0f;
   time->gameDt = 0.0f;
-  time->fixedDt = 0.0166667f; // 60 FPS fixed timestep
+  time->fixedStepUs = FIXED_STEP_US;
+  time->fixedDt = static_cast<float>(FIXED_STEP_US) / 1000000.0f;
   time->lastTime = Platform_GetTime();
-  time->accumulator = 0.0f;
+  time->accumulatorUs = 0;
   time->timeScale = 1.0f;
+  time->frameIndex = 0;
 }
 void timeSystem_Update(TimeContext *time) {
   double current = Platform_GetTime();
-  time->realDt = static_cast<float>(current - time->lastTime);
+  float realDt = static_cast<float>(current - time->lastTime);
   time->lastTime = current;
 
-  if (time->realDt > 0.1f)
-    time->realDt = 0.1f;
+  // lastTime is sampled before the window exists, so the first delta can be
+  // garbage in either direction.
+  if (realDt > 0.1f)
+    realDt = 0.1f;
+  if (realDt < 0.0f)
+    realDt = 0.0f;
 
+  timeSystem_Advance(time, realDt);
+}
+
+void timeSystem_Advance(TimeContext *time, float realDt) {
+  time->realDt = realDt;
   time->gameDt = time->realDt * time->timeScale;
-  time->accumulator += time->gameDt;
+  // Quantize once per frame; the float delta never feeds back into the
+  // accumulator, so step counts only depend on the per-frame deltas.
+  time->accumulatorUs += llround(static_cast<double>(time->gameDt) * 1000000.0);
+  time->frameIndex++;
 }
 
 bool timeSystem_ConsumeFixedStep(TimeContext *time) {
-  float fixedDt = time->fixedDt;
-  if (time->accumulator >= fixedDt) {
-    time->accumulator -= fixedDt;
+  if (time->accumulatorUs >= time->fixedStepUs) {
+    time->accumulatorUs -= time->fixedStepUs;
     return true;
   }
   return false;
 }
+
+void timeSystem_SetFixedDt(TimeContext *time, float fixedDt) {
+  int64_t stepUs = llround(static_cast<double>(fixedDt) * 1000000.0);
+  if (stepUs < 1)
+    stepUs = FIXED_STEP_US;
+  time->fixedStepUs = stepUs;
+  time->fixedDt = static_cast<float>(stepUs) / 1000000.0f;
+}
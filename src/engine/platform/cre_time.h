@@ -5,6 +5,14 @@ struct TimeContext;
 
 void timeSystem_Init(TimeContext *time);
 void timeSystem_Update(TimeContext *time);
+/**
+ * @brief Advance by an explicit real delta (replay playback, headless runs).
+ */
+void timeSystem_Advance(TimeContext *time, float realDt);
 bool timeSystem_ConsumeFixedStep(TimeContext *time);
+/**
+ * @brief Set the fixed step (rounded to whole microseconds).
+ */
+void timeSystem_SetFixedDt(TimeContext *time, float fixedDt);
 
 #endif
@@ -0,0 +1,20 @@
+// Viewport shim for the headless server target (no raylib, no window).
+// Implements the cre_viewport.h contract with the size given to
+// Viewport_Init, which never changes: there is no window to resize.
+#include "cre_viewport.h"
+#include "engine/core/cre_config.h"
+
+static ViewportSize s_view = {};
+
+void Viewport_Init(float initialW, float initialH) {
+  // Same virtual size as cre_viewport.cpp
+  s_view.height = GAME_VIRTUAL_HEIGHT;
+  s_view.aspect = initialW / initialH;
+  s_view.width = GAME_VIRTUAL_HEIGHT * s_view.aspect;
+}
+
+ViewportSize Viewport_Get(void) { return s_view; }
+
+void Viewport_Update(void) {}
+
+bool Viewport_wasResized(void) { return false; }
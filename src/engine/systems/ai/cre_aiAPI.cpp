@@ -0,0 +1,39 @@
+#include "cre_aiAPI.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_logger.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <assert.h>
+#include <stdint.h>
+
+void aiAPI_SetState(CommandBus &bus, Entity entity, uint8_t state) {
+  Command cmd = {
+      .type = CMD_AI_SET_STATE, .entity = entity, .u8 = {.value = state}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "aiAPI_SetState: CommandBus is full!");
+  }
+}
+
+void aiAPI_SetTarget(CommandBus &bus, Entity entity, Entity target) {
+  Command cmd = {.type = CMD_AI_SET_TARGET,
+                 .entity = entity,
+                 .aiTarget = {.target = target}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "aiAPI_SetTarget: CommandBus is full!");
+  }
+}
+
+uint8_t aiAPI_GetState(const EntityRegistry &reg, Entity entity) {
+  if (!EntityRegistry_IsAlive(reg, entity)) {
+    return AI_STATE_NONE;
+  }
+  return reg.ai_states[entity.id];
+}
+
+Entity aiAPI_GetTarget(const EntityRegistry &reg, Entity entity) {
+  if (!EntityRegistry_IsAlive(reg, entity)) {
+    return ENTITY_INVALID;
+  }
+  return reg.ai_targets[entity.id];
+}
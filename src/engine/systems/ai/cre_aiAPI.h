@@ -0,0 +1,15 @@
+#ifndef CRE_AIAPI_H
+#define CRE_AIAPI_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+struct CommandBus;
+struct EntityRegistry;
+
+void aiAPI_SetState(CommandBus &bus, Entity entity, uint8_t state);
+void aiAPI_SetTarget(CommandBus &bus, Entity entity, Entity target);
+
+uint8_t aiAPI_GetState(const EntityRegistry &reg, Entity entity);
+Entity aiAPI_GetTarget(const EntityRegistry &reg, Entity entity);
+#endif
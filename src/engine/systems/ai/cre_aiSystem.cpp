@@ -0,0 +1,231 @@
+#include "cre_aiSystem.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <assert.h>
+#include <string.h>
+
+static_assert(AI_MAX_STATES <= 256, "ai_states[] is uint8_t");
+static_assert(AI_MAX_TIME_SLICES > 0, "AI needs at least one time slice");
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+static AIStateUpdateFn s_stateTable[AI_MAX_STATES];
+
+// Grouping buffers, rebuilt every frame (counting sort by state id).
+static uint32_t s_dueIds[MAX_ENTITIES];
+static uint32_t s_groupIds[MAX_ENTITIES];
+static uint32_t s_groupStart[AI_MAX_STATES + 1];
+static uint8_t s_nextStates[MAX_ENTITIES];
+
+// Time-slice schedule, the only AI state that outlives a frame
+struct AISchedule {
+  uint32_t frameCounter;
+  uint32_t lastAICount;
+};
+
+static AISchedule s_schedule = {.frameCounter = 0, .lastAICount = 0};
+
+void aiSystem_Init(void) {
+  memset(s_stateTable, 0, sizeof(s_stateTable));
+  memset(s_groupStart, 0, sizeof(s_groupStart));
+  s_schedule.frameCounter = 0;
+  s_schedule.lastAICount = 0;
+  Log(LogLevel::Info, "AI System Initialized ({} states, {} decisions/frame)",
+      AI_MAX_STATES, AI_DECISIONS_PER_FRAME);
+}
+
+bool aiSystem_RegisterState(uint8_t state, AIStateUpdateFn fn) {
+  assert(state != AI_STATE_NONE && "AI_STATE_NONE cannot have a handler");
+  assert(state < AI_MAX_STATES && "AI state id out of range");
+  if (state == AI_STATE_NONE || state >= AI_MAX_STATES)
+    return false;
+
+  s_stateTable[state] = fn;
+  return true;
+}
+
+void aiSystem_ClearStates(void) {
+  memset(s_stateTable, 0, sizeof(s_stateTable));
+}
+
+aiPacket CreateAIPacket(EntityRegistry *reg, CommandBus *bus, float dt) {
+  aiPacket pkt = {
+      .bus = bus,
+      .dt = dt,
+      .max_used_bound = reg->max_used_bound,
+      .read = {.pos = reg->pos,
+               .vel = reg->vel,
+               .component_masks = reg->component_masks,
+               .state_flags = reg->state_flags,
+               .generations = reg->generations,
+               .types = reg->types},
+      .write = {.ai_states = reg->ai_states,
+                .ai_timers = reg->ai_timers,
+                .ai_targets = reg->ai_targets},
+  };
+  return pkt;
+}
+
+// ============================================================================
+// Command Processing
+// ============================================================================
+
+void aiSystem_ProcessCommands(aiPacket *packet) {
+  // UNPACKING THE PACKET
+  CommandBus &bus = *packet->bus;
+  const uint64_t *masks = packet->read.component_masks;
+  const uint64_t *flags = packet->read.state_flags;
+  const uint32_t *generations = packet->read.generations;
+  uint8_t *ai_states = packet->write.ai_states;
+  float *ai_timers = packet->write.ai_timers;
+  Entity *ai_targets = packet->write.ai_targets;
+
+  CommandIterator iter = CommandBus_GetIterator(bus);
+  const Command *cmd;
+
+  while (CommandBus_Next(bus, &iter, &cmd)) {
+    if ((cmd->type & CMD_DOMAIN_MASK) != CMD_DOMAIN_AI)
+      continue;
+    if (!EntityRegistry_IsAlive(flags, generations, cmd->entity))
+      continue;
+    const uint32_t id = cmd->entity.id;
+    if (!(masks[id] & COMP_AI))
+      continue;
+
+    switch (cmd->type) {
+    case CMD_AI_SET_STATE: {
+      const uint8_t state = cmd->u8.value;
+      assert(state < AI_MAX_STATES && "Invalid AI state id");
+      if (state >= AI_MAX_STATES)
+        break;
+      if (ai_states[id] != state) {
+        ai_states[id] = state;
+        ai_timers[id] = 0.0f;
+      }
+      break;
+    }
+    case CMD_AI_SET_TARGET: {
+      ai_targets[id] = cmd->aiTarget.target;
+      break;
+    }
+    default:
+      break;
+    }
+  }
+}
+
+// ============================================================================
+// Update (Group -> Dispatch -> Apply transitions)
+// ============================================================================
+
+void aiSystem_Update(aiPacket *packet) {
+  aiSystem_ProcessCommands(packet);
+
+  // UNPACKING THE PACKET
+  const float dt = packet->dt;
+  const uint32_t max_used_bound = packet->max_used_bound;
+  const uint64_t *restrict masks = packet->read.component_masks;
+  const uint64_t *restrict flags = packet->read.state_flags;
+  uint8_t *restrict ai_states = packet->write.ai_states;
+  float *restrict ai_timers = packet->write.ai_timers;
+
+  // Time-slicing is sized from last frame's population so we only need a
+  // single pass over the registry here.
+  uint32_t slices = (s_schedule.lastAICount + AI_DECISIONS_PER_FRAME - 1) /
+                    AI_DECISIONS_PER_FRAME;
+  if (slices == 0)
+    slices = 1;
+  if (slices > AI_MAX_TIME_SLICES)
+    slices = AI_MAX_TIME_SLICES;
+  const uint32_t slot = s_schedule.frameCounter % slices;
+  s_schedule.frameCounter++;
+
+  uint32_t stateCounts[AI_MAX_STATES] = {};
+  uint32_t aiCount = 0;
+  uint32_t dueCount = 0;
+
+  for (uint32_t i = 0; i < max_used_bound; ++i) {
+    if (!(masks[i] & COMP_AI))
+      continue;
+    if ((flags[i] & (FLAG_ACTIVE | FLAG_CULLED)) != FLAG_ACTIVE)
+      continue;
+
+    aiCount++;
+    ai_timers[i] += dt;
+
+    const uint8_t state = ai_states[i];
+    if (state == AI_STATE_NONE || (i % slices) != slot)
+      continue;
+
+    s_dueIds[dueCount++] = i;
+    stateCounts[state]++;
+  }
+  s_schedule.lastAICount = aiCount;
+
+  if (dueCount == 0)
+    return;
+
+  // Prefix sums -> group start offsets.
+  uint32_t offset = 0;
+  for (uint32_t s = 0; s < AI_MAX_STATES; ++s) {
+    s_groupStart[s] = offset;
+    offset += stateCounts[s];
+  }
+  s_groupStart[AI_MAX_STATES] = offset;
+
+  // Scatter ids into their state groups (stable: ids stay ascending).
+  uint32_t cursor[AI_MAX_STATES];
+  memcpy(cursor, s_groupStart, sizeof(cursor));
+  for (uint32_t n = 0; n < dueCount; ++n) {
+    const uint32_t id = s_dueIds[n];
+    const uint8_t state = ai_states[id];
+    s_groupIds[cursor[state]++] = id;
+    s_nextStates[id] = state;
+  }
+
+  const AIStateContext ctx = {
+      .bus = packet->bus,
+      .dt = dt * static_cast<float>(slices),
+      .pos = packet->read.pos,
+      .vel = packet->read.vel,
+      .state_flags = flags,
+      .generations = packet->read.generations,
+      .types = packet->read.types,
+      .timers = ai_timers,
+      .targets = packet->write.ai_targets,
+      .next_states = s_nextStates,
+  };
+
+  for (uint32_t s = 1; s < AI_MAX_STATES; ++s) {
+    const uint32_t count = stateCounts[s];
+    if (count == 0)
+      continue;
+    const AIStateUpdateFn fn = s_stateTable[s];
+    if (fn == nullptr)
+      continue;
+    fn(&ctx, &s_groupIds[s_groupStart[s]], count);
+  }
+
+  // Apply transitions requested by the handlers.
+  for (uint32_t n = 0; n < dueCount; ++n) {
+    const uint32_t id = s_dueIds[n];
+    const uint8_t next = s_nextStates[id];
+    assert(next < AI_MAX_STATES && "Handler requested invalid AI state");
+    if (next == ai_states[id] || next >= AI_MAX_STATES)
+      continue;
+    ai_states[id] = next;
+    ai_timers[id] = 0.0f;
+  }
+}
+
+void aiSystem_GetSimState(SimStateBlock *out) {
+  *out = {.name = "ai.schedule",
+          .base = &s_schedule,
+          .size = sizeof(s_schedule)};
+}
@@ -0,0 +1,99 @@
+/**
+ * @file cre_aiSystem.h
+ * @brief Data-Driven AI System with Batched Per-State Execution
+ *
+ * Every AI entity carries a compact state record in the registry:
+ *   - ai_states[]  : uint8_t - current state id (AI_STATE_NONE = idle slot)
+ *   - ai_timers[]  : float   - seconds spent in the current state
+ *   - ai_targets[] : Entity  - current target handle
+ *
+ * Each frame the system buckets the entities that are due for a decision by
+ * their state id (counting sort), then calls each registered state handler
+ * once with its whole group. Handlers run tight loops over packed ids and
+ * emit their outputs (movement, animation, audio...) as commands on the bus.
+ *
+ * Large populations are time-sliced: when more than AI_DECISIONS_PER_FRAME
+ * entities own COMP_AI, only every Nth slot decides per frame (N up to
+ * AI_MAX_TIME_SLICES) and handlers receive the matching decision dt.
+ */
+
+#ifndef CRE_AISYSTEM_H
+#define CRE_AISYSTEM_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Forward declarations (dependency injection)
+struct EntityRegistry;
+struct CommandBus;
+struct aiPacket;
+struct SimStateBlock;
+
+/**
+ * @brief Read/write view handed to a state handler for its group.
+ *
+ * Registry columns are read-only except for the AI-owned target column.
+ * Transitions are requested by writing next_states[id]; they are applied
+ * after every group ran, so a frame never processes an entity twice.
+ */
+struct AIStateContext {
+  CommandBus *bus;
+  float dt; //< Decision dt (gameDt * active time slices)
+  const creVec2 *pos;
+  const creVec2 *vel;
+  const uint64_t *state_flags;
+  const uint32_t *generations;
+  const uint16_t *types;
+  const float *timers;
+  Entity *targets;
+  uint8_t *next_states;
+};
+
+/**
+ * @brief State handler. Called once per frame with every due entity in the
+ * state. ids are ascending registry indices.
+ */
+typedef void (*AIStateUpdateFn)(const AIStateContext *ctx,
+                                const uint32_t *ids, uint32_t count);
+
+/**
+ * @brief Clear the state table and grouping buffers.
+ * Call once at engine startup.
+ */
+void aiSystem_Init(void);
+
+/**
+ * @brief Register the handler for a state id.
+ * @param state State id (1..AI_MAX_STATES-1)
+ * @param fn    Handler, nullptr unregisters the state
+ * @return false if the id is out of range
+ */
+bool aiSystem_RegisterState(uint8_t state, AIStateUpdateFn fn);
+
+/**
+ * @brief Remove every registered state handler (scene changes).
+ */
+void aiSystem_ClearStates(void);
+
+aiPacket CreateAIPacket(EntityRegistry *reg, CommandBus *bus, float dt);
+
+/**
+ * @brief Process CMD_AI_SET_STATE / CMD_AI_SET_TARGET from the bus.
+ * Called automatically by aiSystem_Update.
+ */
+void aiSystem_ProcessCommands(aiPacket *packet);
+
+/**
+ * @brief Advance state timers, group due entities by state and dispatch.
+ * Runs after EntitySystem_Update and before physics so emitted commands are
+ * consumed in the same frame.
+ */
+void aiSystem_Update(aiPacket *packet);
+
+/**
+ * @brief Time-slice schedule, for rollback (see cre_simState.h).
+ */
+void aiSystem_GetSimState(SimStateBlock *out);
+
+#endif
@@ -1,5 +1,4 @@
 #include "cre_cameraSystem.h"
-#include "cre_cameraUtils.h"
 #include "engine/core/cre_commandBus.h"
 #include "engine/core/cre_config.h"
 #include "engine/core/cre_logger.h"
@@ -119,6 +118,20 @@ void cameraSystem_ProcessCommands(cameraPacket *packet) {
   }
 }
 
+/**
+ * Smoothly interpolate a position towards a target.
+ * Uses exponential decay for smooth deceleration.
+ * Lives here rather than in cre_cameraUtils (raylib conversions) so the
+ * camera system also builds for the headless server.
+ */
+static creVec2 followLerp(creVec2 current, creVec2 target, float speed,
+                          float dt) {
+  float t = 1.0f - expf(-speed * dt);
+
+  return creVec2{.x = current.x + (target.x - current.x) * t,
+                 .y = current.y + (target.y - current.y) * t};
+}
+
 static void applyFollowLogic(CameraComponent *cam, const cameraPacket *packet,
                              float dt, uint32_t ownerId) {
   if (EntityRegistry_IsAlive(packet->read.state_flags, packet->read.generations,
@@ -130,7 +143,7 @@ static void applyFollowLogic(CameraComponent *cam, const cameraPacket *packet,
 
     creVec2 nextPos = desired;
     if (cam->follow.smoothSpeed > cam_safety_epsilon) {
-      nextPos = cameraUtils_Lerp(current, desired, cam->follow.smoothSpeed, dt);
+      nextPos = followLerp(current, desired, cam->follow.smoothSpeed, dt);
     }
 
     packet->write.pos[ownerId] = nextPos;
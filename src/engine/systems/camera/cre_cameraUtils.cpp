@@ -22,14 +22,6 @@ Camera2D cameraUtils_buildRaylibCam(const CameraComponent *cam,
   return out;
 }
 
-creVec2 cameraUtils_Lerp(creVec2 current, creVec2 target, float speed,
-                         float dt) {
-  float t = 1.0f - expf(-speed * dt);
-
-  return creVec2{.x = current.x + (target.x - current.x) * t,
-                 .y = current.y + (target.y - current.y) * t};
-}
-
 creVec2 cameraUtils_ScreenToWorld(creVec2 screenPos, const EntityRegistry &reg,
                                   const CameraComponent *cam, ViewportSize vp) {
   (void)reg;
@@ -17,20 +17,6 @@ struct EntityRegistry;
 
 Camera2D cameraUtils_buildRaylibCam(const CameraComponent *cam,
                                     ViewportSize vp);
-/**
- * Smoothly interpolate a position towards a target.
- * Uses exponential decay for smooth deceleration.
- *
- * @param current Current position
- * @param target The world position to move towards
- * @param speed  Interpolation speed (higher = faster, typical range: 1.0
- * - 10.0)
- * @param dt     Delta time in seconds
- * @return Interpolated position
- */
-creVec2 cameraUtils_Lerp(creVec2 current, creVec2 target, float speed,
-                         float dt);
-
 /**
  * Convert a screen position to world coordinates.
  * Takes into account camera position, zoom, rotation, and viewport offset.
@@ -0,0 +1,360 @@
+/**
+ * @file cre_debugDraw.cpp
+ * @brief Batched Debug Draw (Frame-Arena Command Buffer)
+ */
+#include "cre_debugDraw.h"
+
+#if CRE_ENABLE_DEBUG_DRAW
+
+#include "engine/memory/cre_arena.h"
+#include "engine/systems/render/cre_textRenderer.h"
+#include "raylib.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ============================================================================
+// Buffers
+// ============================================================================
+
+struct DebugLine {
+  creVec2 a;
+  creVec2 b;
+  creColor color;
+};
+
+struct DebugBox {
+  creRectangle rect;
+  creColor color;
+  bool filled;
+};
+
+struct DebugCircle {
+  creVec2 center;
+  float radius;
+  creColor color;
+  bool filled;
+};
+
+struct DebugText {
+  creVec2 pos;
+  uint32_t offset; // Into textBytes
+  uint32_t length; // 0 = dropped (bytes ran out after the slot was taken)
+  int32_t fontSize;
+  creColor color;
+};
+
+/**
+ * @brief One layer's buffers. Counts are reserved atomically and may run
+ * past capacity; readers clamp.
+ */
+struct DebugLayerBuffer {
+  DebugLine *lines;
+  DebugBox *boxes;
+  DebugCircle *circles;
+  DebugText *texts;
+  char *textBytes;
+  uint32_t lineCount;
+  uint32_t boxCount;
+  uint32_t circleCount;
+  uint32_t textCount;
+  uint32_t textUsed;
+};
+
+static DebugLayerBuffer s_layers[DEBUG_LAYER_COUNT];
+static DebugDrawStats s_frameStats = {};
+static DebugDrawStats s_lastStats = {};
+
+// Unit circle, closed (last == first)
+static float s_circleCos[DEBUG_DRAW_CIRCLE_SEGMENTS + 1];
+static float s_circleSin[DEBUG_DRAW_CIRCLE_SEGMENTS + 1];
+static bool s_circleReady = false;
+
+static inline uint32_t AtomicReserve(uint32_t *counter, uint32_t n) {
+#if defined(_MSC_VER)
+  return static_cast<uint32_t>(_InterlockedExchangeAdd(
+      reinterpret_cast<volatile long *>(counter), static_cast<long>(n)));
+#else
+  return __atomic_fetch_add(counter, n, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline uint32_t Clamp(uint32_t count, uint32_t capacity) {
+  return (count < capacity) ? count : capacity;
+}
+
+/**
+ * @brief Reserve one slot, nullptr if the layer is full or not begun.
+ */
+template <typename T>
+static inline T *Reserve(T *base, uint32_t *count, uint32_t capacity) {
+  if (!base) {
+    AtomicReserve(&s_frameStats.dropped, 1);
+    return nullptr;
+  }
+  const uint32_t slot = AtomicReserve(count, 1);
+  if (slot >= capacity) {
+    AtomicReserve(&s_frameStats.dropped, 1);
+    return nullptr;
+  }
+  AtomicReserve(&s_frameStats.pushed, 1);
+  return &base[slot];
+}
+
+static inline bool Overlaps(creRectangle r, float minX, float minY, float maxX,
+                            float maxY) {
+  return maxX >= r.x && minX <= r.x + r.width && maxY >= r.y &&
+         minY <= r.y + r.height;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void DebugDraw_BeginFrame(Arena *frameArena) {
+  s_lastStats = s_frameStats;
+  s_frameStats = {.pushed = 0, .culled = 0, .dropped = 0, .drawn = 0};
+
+  if (!s_circleReady) {
+    for (uint32_t i = 0; i <= DEBUG_DRAW_CIRCLE_SEGMENTS; i++) {
+      const float angle = (2.0f * PI * static_cast<float>(i)) /
+                          static_cast<float>(DEBUG_DRAW_CIRCLE_SEGMENTS);
+      s_circleCos[i] = cosf(angle);
+      s_circleSin[i] = sinf(angle);
+    }
+    s_circleReady = true;
+  }
+
+  for (uint32_t l = 0; l < DEBUG_LAYER_COUNT; l++) {
+    DebugLayerBuffer &buf = s_layers[l];
+    buf.lines = arena_Push<DebugLine>(frameArena, DEBUG_DRAW_MAX_LINES);
+    buf.boxes = arena_Push<DebugBox>(frameArena, DEBUG_DRAW_MAX_BOXES);
+    buf.circles = arena_Push<DebugCircle>(frameArena, DEBUG_DRAW_MAX_CIRCLES);
+    buf.texts = arena_Push<DebugText>(frameArena, DEBUG_DRAW_MAX_TEXTS);
+    buf.textBytes = arena_Push<char>(frameArena, DEBUG_DRAW_TEXT_BYTES);
+    if (!buf.lines || !buf.boxes || !buf.circles || !buf.texts ||
+        !buf.textBytes) {
+      buf = {}; // Arena exhausted: this frame's pushes are dropped
+    }
+    buf.lineCount = 0;
+    buf.boxCount = 0;
+    buf.circleCount = 0;
+    buf.textCount = 0;
+    buf.textUsed = 0;
+  }
+}
+
+void DebugDraw_Line(DebugDrawLayer layer, creVec2 a, creVec2 b,
+                    creColor color) {
+  DebugLayerBuffer &buf = s_layers[layer];
+  DebugLine *line = Reserve(buf.lines, &buf.lineCount, DEBUG_DRAW_MAX_LINES);
+  if (line) {
+    *line = {.a = a, .b = b, .color = color};
+  }
+}
+
+void DebugDraw_Box(DebugDrawLayer layer, creRectangle rect, creColor color,
+                   bool filled) {
+  DebugLayerBuffer &buf = s_layers[layer];
+  DebugBox *box = Reserve(buf.boxes, &buf.boxCount, DEBUG_DRAW_MAX_BOXES);
+  if (box) {
+    *box = {.rect = rect, .color = color, .filled = filled};
+  }
+}
+
+void DebugDraw_Circle(DebugDrawLayer layer, creVec2 center, float radius,
+                      creColor color, bool filled) {
+  DebugLayerBuffer &buf = s_layers[layer];
+  DebugCircle *circle =
+      Reserve(buf.circles, &buf.circleCount, DEBUG_DRAW_MAX_CIRCLES);
+  if (circle) {
+    *circle = {
+        .center = center, .radius = radius, .color = color, .filled = filled};
+  }
+}
+
+void DebugDraw_Text(DebugDrawLayer layer, creVec2 pos, int fontSize,
+                    creColor color, const char *text) {
+  DebugLayerBuffer &buf = s_layers[layer];
+  DebugText *slot = Reserve(buf.texts, &buf.textCount, DEBUG_DRAW_MAX_TEXTS);
+  if (!slot)
+    return;
+
+  const uint32_t length = static_cast<uint32_t>(strlen(text));
+  const uint32_t offset = AtomicReserve(&buf.textUsed, length + 1);
+  if (offset + length + 1 > DEBUG_DRAW_TEXT_BYTES) {
+    *slot = {.pos = pos, .offset = 0, .length = 0, .fontSize = 0,
+             .color = color};
+    AtomicReserve(&s_frameStats.dropped, 1);
+    return;
+  }
+  memcpy(buf.textBytes + offset, text, length + 1);
+  *slot = {.pos = pos,
+           .offset = offset,
+           .length = length,
+           .fontSize = fontSize,
+           .color = color};
+}
+
+void DebugDraw_TextF(DebugDrawLayer layer, creVec2 pos, int fontSize,
+                     creColor color, const char *fmt, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  va_end(args);
+  DebugDraw_Text(layer, pos, fontSize, color, buffer);
+}
+
+// ============================================================================
+// Flush
+// ============================================================================
+
+static inline void EmitLine(creVec2 a, creVec2 b) {
+  rlVertex2f(a.x, a.y);
+  rlVertex2f(b.x, b.y);
+}
+
+void DebugDraw_Flush(DebugDrawLayer layer, creRectangle cull) {
+  DebugLayerBuffer &buf = s_layers[layer];
+  if (!buf.lines)
+    return;
+
+  const uint32_t lineCount = Clamp(buf.lineCount, DEBUG_DRAW_MAX_LINES);
+  const uint32_t boxCount = Clamp(buf.boxCount, DEBUG_DRAW_MAX_BOXES);
+  const uint32_t circleCount = Clamp(buf.circleCount, DEBUG_DRAW_MAX_CIRCLES);
+  const uint32_t textCount = Clamp(buf.textCount, DEBUG_DRAW_MAX_TEXTS);
+  uint32_t culled = 0;
+  uint32_t drawn = 0;
+
+  // Pass 1: every filled shape in one RL_TRIANGLES batch (under outlines)
+  rlBegin(RL_TRIANGLES);
+  for (uint32_t i = 0; i < boxCount; i++) {
+    const DebugBox &b = buf.boxes[i];
+    if (!b.filled)
+      continue;
+    const creRectangle r = b.rect;
+    if (!Overlaps(cull, r.x, r.y, r.x + r.width, r.y + r.height)) {
+      culled++;
+      continue;
+    }
+    // Counter-clockwise like raylib's quads: TL, BL, BR / TL, BR, TR
+    rlColor4ub(b.color.r, b.color.g, b.color.b, b.color.a);
+    rlVertex2f(r.x, r.y);
+    rlVertex2f(r.x, r.y + r.height);
+    rlVertex2f(r.x + r.width, r.y + r.height);
+    rlVertex2f(r.x, r.y);
+    rlVertex2f(r.x + r.width, r.y + r.height);
+    rlVertex2f(r.x + r.width, r.y);
+    drawn++;
+  }
+  for (uint32_t i = 0; i < circleCount; i++) {
+    const DebugCircle &c = buf.circles[i];
+    if (!c.filled)
+      continue;
+    if (!Overlaps(cull, c.center.x - c.radius, c.center.y - c.radius,
+                  c.center.x + c.radius, c.center.y + c.radius)) {
+      culled++;
+      continue;
+    }
+    rlColor4ub(c.color.r, c.color.g, c.color.b, c.color.a);
+    for (uint32_t s = 0; s < DEBUG_DRAW_CIRCLE_SEGMENTS; s++) {
+      rlVertex2f(c.center.x, c.center.y);
+      rlVertex2f(c.center.x + s_circleCos[s + 1] * c.radius,
+                 c.center.y + s_circleSin[s + 1] * c.radius);
+      rlVertex2f(c.center.x + s_circleCos[s] * c.radius,
+                 c.center.y + s_circleSin[s] * c.radius);
+    }
+    drawn++;
+  }
+  rlEnd();
+
+  // Pass 2: every outline in one RL_LINES batch
+  rlBegin(RL_LINES);
+  for (uint32_t i = 0; i < lineCount; i++) {
+    const DebugLine &l = buf.lines[i];
+    if (!Overlaps(cull, fminf(l.a.x, l.b.x), fminf(l.a.y, l.b.y),
+                  fmaxf(l.a.x, l.b.x), fmaxf(l.a.y, l.b.y))) {
+      culled++;
+      continue;
+    }
+    rlColor4ub(l.color.r, l.color.g, l.color.b, l.color.a);
+    EmitLine(l.a, l.b);
+    drawn++;
+  }
+  for (uint32_t i = 0; i < boxCount; i++) {
+    const DebugBox &b = buf.boxes[i];
+    if (b.filled)
+      continue;
+    const creRectangle r = b.rect;
+    if (!Overlaps(cull, r.x, r.y, r.x + r.width, r.y + r.height)) {
+      culled++;
+      continue;
+    }
+    const creVec2 tl = {r.x, r.y};
+    const creVec2 tr = {r.x + r.width, r.y};
+    const creVec2 br = {r.x + r.width, r.y + r.height};
+    const creVec2 bl = {r.x, r.y + r.height};
+    rlColor4ub(b.color.r, b.color.g, b.color.b, b.color.a);
+    EmitLine(tl, tr);
+    EmitLine(tr, br);
+    EmitLine(br, bl);
+    EmitLine(bl, tl);
+    drawn++;
+  }
+  for (uint32_t i = 0; i < circleCount; i++) {
+    const DebugCircle &c = buf.circles[i];
+    if (c.filled)
+      continue;
+    if (!Overlaps(cull, c.center.x - c.radius, c.center.y - c.radius,
+                  c.center.x + c.radius, c.center.y + c.radius)) {
+      culled++;
+      continue;
+    }
+    rlColor4ub(c.color.r, c.color.g, c.color.b, c.color.a);
+    for (uint32_t s = 0; s < DEBUG_DRAW_CIRCLE_SEGMENTS; s++) {
+      EmitLine({c.center.x + s_circleCos[s] * c.radius,
+                c.center.y + s_circleSin[s] * c.radius},
+               {c.center.x + s_circleCos[s + 1] * c.radius,
+                c.center.y + s_circleSin[s + 1] * c.radius});
+    }
+    drawn++;
+  }
+  rlEnd();
+
+  // Pass 3: text (atlas glyphs, one batch with the sprites)
+  for (uint32_t i = 0; i < textCount; i++) {
+    const DebugText &t = buf.texts[i];
+    if (t.length == 0)
+      continue;
+    const char *text = buf.textBytes + t.offset;
+    const creVec2 size =
+        textRenderer_MeasureString(text, t.length, t.fontSize);
+    if (!Overlaps(cull, t.pos.x, t.pos.y, t.pos.x + size.x,
+                  t.pos.y + size.y)) {
+      culled++;
+      continue;
+    }
+    textRenderer_DrawString(text, t.length, t.pos, t.fontSize, t.color);
+    drawn++;
+  }
+
+  AtomicReserve(&s_frameStats.culled, culled);
+  AtomicReserve(&s_frameStats.drawn, drawn);
+
+  buf.lineCount = 0;
+  buf.boxCount = 0;
+  buf.circleCount = 0;
+  buf.textCount = 0;
+  buf.textUsed = 0;
+}
+
+DebugDrawStats DebugDraw_GetStats(void) { return s_lastStats; }
+
+#endif
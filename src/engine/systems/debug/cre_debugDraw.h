@@ -0,0 +1,136 @@
+/**
+ * @file cre_debugDraw.h
+ * @brief Batched Debug Draw (Frame-Arena Command Buffer)
+ *
+ * Systems push lines, boxes, circles and text during the frame; nothing is
+ * drawn until the owning layer is flushed once per frame:
+ *
+ *   DEBUG_DRAW_BEGIN_FRAME(&frameArena)         engine, before Phase 0
+ *   DEBUG_DRAW_LINE(DEBUG_LAYER_WORLD, a, b, c)  anywhere, any thread
+ *   DEBUG_DRAW_FLUSH(DEBUG_LAYER_WORLD, cull)    inside BeginWorldMode
+ *   DEBUG_DRAW_FLUSH(DEBUG_LAYER_SCREEN, cull)   after EndWorldMode
+ *
+ * Pushes reserve their slot with an atomic add, so worker threads may push
+ * concurrently; flushing must happen on the render thread after they are
+ * done. The flush culls every primitive against the given rectangle and
+ * emits all line geometry in one rlgl batch and all filled geometry in
+ * another. Text is culled and capped (DEBUG_DRAW_MAX_TEXTS per layer).
+ *
+ * Buffers live in the frame arena, so the data is gone after
+ * arena_Clear(&frameArena). Pushes beyond capacity are dropped and counted.
+ *
+ * Building with CRE_ENABLE_DEBUG_DRAW 0 compiles every macro to nothing:
+ * arguments (including TEXTF formatting) are not evaluated.
+ */
+#ifndef CRE_DEBUGDRAW_H
+#define CRE_DEBUGDRAW_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef CRE_ENABLE_DEBUG_DRAW
+#define CRE_ENABLE_DEBUG_DRAW 1
+#endif
+
+enum DebugDrawLayer : uint8_t {
+  DEBUG_LAYER_WORLD = 0, ///< World units, flushed inside the camera
+  DEBUG_LAYER_SCREEN,    ///< Pixels, flushed after the camera
+  DEBUG_LAYER_COUNT
+};
+
+constexpr uint32_t DEBUG_DRAW_MAX_LINES = 32768;
+constexpr uint32_t DEBUG_DRAW_MAX_BOXES = 16384;
+constexpr uint32_t DEBUG_DRAW_MAX_CIRCLES = 8192;
+constexpr uint32_t DEBUG_DRAW_MAX_TEXTS = 512;
+constexpr uint32_t DEBUG_DRAW_TEXT_BYTES = 32 * 1024; // Per layer
+constexpr uint32_t DEBUG_DRAW_CIRCLE_SEGMENTS = 16;
+
+struct DebugDrawStats {
+  uint32_t pushed;  ///< Primitives accepted this frame (both layers)
+  uint32_t culled;  ///< Outside the flush rectangle
+  uint32_t dropped; ///< Buffer full (or no BeginFrame)
+  uint32_t drawn;   ///< Primitives emitted by the flushes
+};
+
+/**
+ * @brief Allocate this frame's buffers from the frame arena.
+ * Until the first call every push is dropped.
+ */
+void DebugDraw_BeginFrame(Arena *frameArena);
+
+void DebugDraw_Line(DebugDrawLayer layer, creVec2 a, creVec2 b,
+                    creColor color);
+void DebugDraw_Box(DebugDrawLayer layer, creRectangle rect, creColor color,
+                   bool filled);
+void DebugDraw_Circle(DebugDrawLayer layer, creVec2 center, float radius,
+                      creColor color, bool filled);
+
+/**
+ * @brief Queue text (copied into the frame buffer). pos is the top-left.
+ */
+void DebugDraw_Text(DebugDrawLayer layer, creVec2 pos, int fontSize,
+                    creColor color, const char *text);
+
+/**
+ * @brief printf-style DebugDraw_Text.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((format(printf, 5, 6)))
+#endif
+void DebugDraw_TextF(DebugDrawLayer layer, creVec2 pos, int fontSize,
+                     creColor color, const char *fmt, ...);
+
+/**
+ * @brief Draw and clear one layer. Primitives outside cull are skipped.
+ */
+void DebugDraw_Flush(DebugDrawLayer layer, creRectangle cull);
+
+#if CRE_ENABLE_DEBUG_DRAW
+
+/**
+ * @brief Counters of the previous frame (stable while the current one
+ * is being built).
+ */
+DebugDrawStats DebugDraw_GetStats(void);
+
+#define DEBUG_DRAW_BEGIN_FRAME(arena) DebugDraw_BeginFrame((arena))
+#define DEBUG_DRAW_LINE(layer, a, b, color)                                    \
+  DebugDraw_Line((layer), (a), (b), (color))
+#define DEBUG_DRAW_BOX(layer, rect, color, filled)                             \
+  DebugDraw_Box((layer), (rect), (color), (filled))
+#define DEBUG_DRAW_CIRCLE(layer, center, radius, color, filled)                \
+  DebugDraw_Circle((layer), (center), (radius), (color), (filled))
+#define DEBUG_DRAW_TEXT(layer, pos, size, color, text)                         \
+  DebugDraw_Text((layer), (pos), (size), (color), (text))
+#define DEBUG_DRAW_TEXTF(...) DebugDraw_TextF(__VA_ARGS__)
+#define DEBUG_DRAW_FLUSH(layer, cull) DebugDraw_Flush((layer), (cull))
+
+#else
+
+// The call sits in an unevaluated sizeof: arguments are still type-checked
+// (and count as used) but generate no code and the functions need no body.
+#define DEBUG_DRAW_DISCARD(call) ((void)sizeof((call), 0))
+
+#define DEBUG_DRAW_BEGIN_FRAME(arena)                                          \
+  DEBUG_DRAW_DISCARD(DebugDraw_BeginFrame((arena)))
+#define DEBUG_DRAW_LINE(layer, a, b, color)                                    \
+  DEBUG_DRAW_DISCARD(DebugDraw_Line((layer), (a), (b), (color)))
+#define DEBUG_DRAW_BOX(layer, rect, color, filled)                             \
+  DEBUG_DRAW_DISCARD(DebugDraw_Box((layer), (rect), (color), (filled)))
+#define DEBUG_DRAW_CIRCLE(layer, center, radius, color, filled)                \
+  DEBUG_DRAW_DISCARD(                                                          \
+      DebugDraw_Circle((layer), (center), (radius), (color), (filled)))
+#define DEBUG_DRAW_TEXT(layer, pos, size, color, text)                         \
+  DEBUG_DRAW_DISCARD(DebugDraw_Text((layer), (pos), (size), (color), (text)))
+#define DEBUG_DRAW_TEXTF(...) DEBUG_DRAW_DISCARD(DebugDraw_TextF(__VA_ARGS__))
+#define DEBUG_DRAW_FLUSH(layer, cull)                                          \
+  DEBUG_DRAW_DISCARD(DebugDraw_Flush((layer), (cull)))
+
+static inline DebugDrawStats DebugDraw_GetStats(void) {
+  return DebugDrawStats{.pushed = 0, .culled = 0, .dropped = 0, .drawn = 0};
+}
+
+#endif
+
+#endif
@@ -5,12 +5,17 @@
 #include "cre_debugSystem.h"
 #include "engine/core/cre_colors.h"
 #include "engine/core/cre_config.h"
+#include "engine/core/cre_engineStats.h"
 #include "engine/core/cre_logger.h"
 #include "engine/core/cre_types.h"
 #include "engine/core/cre_typesMacro.h"
 #include "engine/ecs/cre_entityRegistry.h"
+#include "engine/platform/cre_input.h"
 #include "engine/platform/cre_viewport.h"
+#include "engine/systems/debug/cre_debugDraw.h"
 #include "engine/systems/camera/cre_cameraUtils.h"
+#include "engine/systems/physics/cre_physicsSystem.h"
+#include "engine/systems/physics/cre_spatialHash.h"
 #include "raylib.h"
 #include <assert.h>
 #include <math.h>
@@ -20,7 +25,7 @@
 // Static State
 // ============================================================================
 
-static bool s_debugEnabled = false;
+static DebugVisualizationMode s_mode = DEBUG_MODE_OFF;
 static bool s_statsHudEnabled = true;
 
 // Frame timing for stats
@@ -32,27 +37,32 @@ static double s_avgFrameTime = 0.0;
 // ============================================================================
 
 static void DebugSystem_RenderAlarms(EntityRegistry &reg);
+static void DebugSystem_RenderHeatmap(EntityRegistry &reg);
 
 // ============================================================================
 // Public API Implementation
 // ============================================================================
 
 void DebugSystem_Init(void) {
-  s_debugEnabled = false;
+  DebugSystem_SetMode(DEBUG_MODE_OFF);
   s_statsHudEnabled = true;
   Log(LogLevel::Info,
-      "Debug System Initialized - Press F1 to toggle alarms, TAB for stats");
+      "Debug System Initialized - Press F1 to cycle overlays, TAB for stats");
 }
 
 void DebugSystem_HandleInput(EntityRegistry &reg) {
   (void)reg;
 
-  if (IsKeyPressed(KEY_F1)) {
-    s_debugEnabled = !s_debugEnabled;
-    Log(LogLevel::Info, "Debug Overlay: {}", s_debugEnabled ? "ON" : "OFF");
+  if (Input_IsPressed(ACTION_DEBUG_OVERLAY)) {
+    static const char *const names[DEBUG_MODE_COUNT] = {"OFF", "ALARMS",
+                                                        "HEATMAP"};
+    const DebugVisualizationMode next = static_cast<DebugVisualizationMode>(
+        (s_mode + 1) % DEBUG_MODE_COUNT);
+    DebugSystem_SetMode(next);
+    Log(LogLevel::Info, "Debug Overlay: {}", names[next]);
   }
 
-  if (IsKeyPressed(KEY_TAB)) {
+  if (Input_IsPressed(ACTION_DEBUG_STATS)) {
     s_statsHudEnabled = !s_statsHudEnabled;
   }
 }
@@ -63,10 +73,13 @@ uint32_t DebugSystem_GetActiveCount(EntityRegistry &reg) {
 
 void DebugSystem_RenderWorldSpace(EntityRegistry &reg) {
 
-  if (!s_debugEnabled) {
+  if (s_mode == DEBUG_MODE_OFF) {
     return;
   }
 
+  if (s_mode == DEBUG_MODE_HEATMAP) {
+    DebugSystem_RenderHeatmap(reg);
+  }
   DebugSystem_RenderAlarms(reg);
 }
 
@@ -89,113 +102,208 @@ void DebugSystem_RenderStatsHUD(EntityRegistry &reg) {
   s_lastFrameTime = currentTime;
   s_avgFrameTime = s_avgFrameTime * 0.95 + frameTime * 0.05;
 
-  // Count entity states
-  uint32_t activeCount = 0;
-  uint32_t sleepingCount = 0;
-  uint32_t staticCount = 0;
-  uint32_t culledCount = 0;
-  uint32_t physicsCount = 0;
-  uint32_t awakeCount = 0;
-
-  const uint32_t bound = reg.max_used_bound;
-  for (uint32_t i = 0; i < bound; i++) {
-    const uint64_t flags = reg.state_flags[i];
-    const uint64_t comps = reg.component_masks[i];
-
-    if (!(flags & FLAG_ACTIVE)) {
-      continue;
-    }
-    activeCount++;
-
-    if (flags & FLAG_SLEEPING) {
-      sleepingCount++;
-    }
-    if (flags & FLAG_STATIC) {
-      staticCount++;
-    }
-    if (flags & FLAG_CULLED) {
-      culledCount++;
-    }
-    if (comps & COMP_PHYSICS) {
-      physicsCount++;
-    }
-
-    // Awake = active AND not sleeping AND not culled
-    if (!(flags & (FLAG_SLEEPING | FLAG_CULLED))) {
-      awakeCount++;
-    }
-  }
+  // Maintained incrementally by the systems that change the flags
+  const EngineStats stats = EngineStats_Get(reg);
 
-  // Draw HUD background
-  const int hudX = 10;
-  const int hudY = 10;
-  const int hudWidth = 280;
-  const int hudHeight = 180;
+  // Queue HUD (screen layer, flushed by the caller after the world pass)
+  constexpr float hudX = 10.0f;
+  constexpr float hudY = 10.0f;
+  constexpr float hudWidth = 280.0f;
+  const bool showHash = (s_mode == DEBUG_MODE_HEATMAP);
+  const float hudHeight = showHash ? 306.0f : 234.0f;
+  constexpr DebugDrawLayer layer = DEBUG_LAYER_SCREEN;
 
-  DrawRectangle(hudX, hudY, hudWidth, hudHeight, Color{20, 20, 30, 220});
-  DrawRectangleLines(hudX, hudY, hudWidth, hudHeight, Color{80, 80, 100, 255});
+  DEBUG_DRAW_BOX(layer, (creRectangle{hudX, hudY, hudWidth, hudHeight}),
+                 (creColor{20, 20, 30, 220}), true);
+  DEBUG_DRAW_BOX(layer, (creRectangle{hudX, hudY, hudWidth, hudHeight}),
+                 (creColor{80, 80, 100, 255}), false);
 
   // Title
-  DrawText("PHYSICS INSIGHT", hudX + 10, hudY + 8, 16,
-           Color{100, 200, 255, 255});
-  DrawLine(hudX + 5, hudY + 28, hudX + hudWidth - 5, hudY + 28,
-           Color{60, 60, 80, 255});
-
-  int rowY = hudY + 35;
-  constexpr int rowSpacing = 18;
+  DEBUG_DRAW_TEXT(layer, (creVec2{hudX + 10.0f, hudY + 8.0f}), 16,
+                  (creColor{100, 200, 255, 255}), "PHYSICS INSIGHT");
+  DEBUG_DRAW_LINE(layer, (creVec2{hudX + 5.0f, hudY + 28.0f}),
+                  (creVec2{hudX + hudWidth - 5.0f, hudY + 28.0f}),
+                  (creColor{60, 60, 80, 255}));
 
-  char buffer[128];
+  constexpr float rowX = hudX + 10.0f;
+  constexpr float rowSpacing = 18.0f;
+  float rowY = hudY + 35.0f;
 
   const creColor fpsColor = (s_avgFrameTime < 16.67) ? creColor{0, 228, 48, 255}
                             : (s_avgFrameTime < 33.33)
                                 ? creColor{253, 249, 0, 255}
                                 : creColor{230, 41, 55, 255};
 
-  snprintf(buffer, sizeof(buffer), "Frame: %.2f ms (%.0f FPS)", s_avgFrameTime,
-           1000.0 / s_avgFrameTime);
-  DrawText(buffer, hudX + 10, rowY, 14,
-           Color{fpsColor.r, fpsColor.g, fpsColor.b, fpsColor.a});
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, fpsColor,
+                   "Frame: %.2f ms (%.0f FPS)", s_avgFrameTime,
+                   1000.0 / s_avgFrameTime);
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14,
+                   (creColor{255, 255, 255, 255}), "Entities: %u / %u",
+                   stats.active, MAX_ENTITIES);
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14,
+                   (creColor{150, 200, 255, 255}), "Physics:  %u",
+                   stats.physics);
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14,
+                   (creColor{0, 228, 48, 255}), "Awake:    %u", stats.awake);
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14,
+                   (creColor{253, 249, 0, 255}), "Sleeping: %u",
+                   stats.sleeping);
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14,
+                   (creColor{0, 121, 241, 255}), "Static:   %u",
+                   stats.statics);
   rowY += rowSpacing;
 
-  snprintf(buffer, sizeof(buffer), "Entities: %u / %u", activeCount,
-           MAX_ENTITIES);
-  DrawText(buffer, hudX + 10, rowY, 14, WHITE);
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14,
+                   (creColor{230, 41, 55, 255}), "Culled:   %u",
+                   stats.culled);
   rowY += rowSpacing;
 
-  snprintf(buffer, sizeof(buffer), "Physics:  %u", physicsCount);
-  DrawText(buffer, hudX + 10, rowY, 14, Color{150, 200, 255, 255});
+  const creColor infoColor = {200, 200, 200, 255};
+  const PhysicsSolverStats solver = PhysicsSystem_GetSolverStats();
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, infoColor,
+                   "Contacts: %u  Joints: %u (%u bodies)", solver.contacts,
+                   solver.joints, solver.bodies);
   rowY += rowSpacing;
 
-  snprintf(buffer, sizeof(buffer), "Awake:    %u", awakeCount);
-  DrawText(buffer, hudX + 10, rowY, 14, GREEN);
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, infoColor,
+                   "Solver lines: %u / %u reg", solver.compactLines,
+                   solver.registryLines);
   rowY += rowSpacing;
 
-  snprintf(buffer, sizeof(buffer), "Sleeping: %u", sleepingCount);
-  DrawText(buffer, hudX + 10, rowY, 14, YELLOW);
+  const DebugDrawStats draw = DebugDraw_GetStats();
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, infoColor,
+                   "Debug draw: %u drawn, %u culled, %u drop", draw.drawn,
+                   draw.culled, draw.dropped);
   rowY += rowSpacing;
 
-  snprintf(buffer, sizeof(buffer), "Static:   %u", staticCount);
-  DrawText(buffer, hudX + 10, rowY, 14, BLUE);
+  if (!showHash) {
+    return;
+  }
+
+  const SpatialHashStats hash = SpatialHash_GetStats();
+  const creColor hashColor = {255, 161, 0, 255};
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, hashColor,
+                   "Hash: %u nodes, %u/%u buckets", hash.nodes,
+                   hash.usedBuckets, SPATIAL_HASH_SIZE);
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, hashColor,
+                   "Chain: max %u  avg %.2f", hash.maxChain,
+                   static_cast<double>(hash.avgChain));
+  rowY += rowSpacing;
+
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, hashColor,
+                   "Collided: %u buckets (+%u cells)", hash.collidedBuckets,
+                   hash.collidedCells);
   rowY += rowSpacing;
 
-  snprintf(buffer, sizeof(buffer), "Culled:   %u", culledCount);
-  DrawText(buffer, hudX + 10, rowY, 14, RED);
+  const creColor capColor =
+      (solver.truncatedQueries > 0 || hash.overflowBodies > 0)
+          ? creColor{230, 41, 55, 255}
+          : hashColor;
+  DEBUG_DRAW_TEXTF(layer, (creVec2{rowX, rowY}), 14, capColor,
+                   "Capped: %u queries  Overflow: %u bodies",
+                   solver.truncatedQueries, hash.overflowBodies);
 }
 
 DebugVisualizationMode DebugSystem_GetMode(void) {
-  return s_debugEnabled ? DEBUG_MODE_ALARMS : DEBUG_MODE_OFF;
+  return s_mode;
 }
 
 void DebugSystem_SetMode(DebugVisualizationMode mode) {
-  s_debugEnabled = (mode != DEBUG_MODE_OFF);
+  s_mode = (mode < DEBUG_MODE_COUNT) ? mode : DEBUG_MODE_OFF;
+  // Contact binning costs a clear per rebuild, only pay for it when shown
+  SpatialHash_SetInstrumentation(s_mode == DEBUG_MODE_HEATMAP);
 }
 
-bool DebugSystem_IsEnabled(void) { return s_debugEnabled; }
+bool DebugSystem_IsEnabled(void) { return s_mode != DEBUG_MODE_OFF; }
 
 void DebugSystem_Draw(void) {
   // Legacy placeholder - use DebugSystem_RenderPhysicsInsight instead
 }
 
+// ============================================================================
+// World-Space Spatial Hash Heatmap
+// ============================================================================
+
+// Chain length drawn fully red. A query walks the whole chain of every
+// cell it overlaps, so this is roughly the per-cell broad-phase cost.
+static constexpr uint32_t HEATMAP_HOT_CHAIN = 64;
+// Larger views are not drawn (one GetCellLoad per cell)
+static constexpr int HEATMAP_MAX_CELLS = 4096;
+
+static void DebugSystem_RenderHeatmap(EntityRegistry &reg) {
+  const ViewportSize vp = Viewport_Get();
+  const Camera2D cam = cameraUtils_GetActiveRaylib(reg, vp);
+  constexpr DebugDrawLayer layer = DEBUG_LAYER_WORLD;
+  constexpr float cellSize = static_cast<float>(SPATIAL_GRID_SIZE);
+
+  const float left = cam.target.x - cam.offset.x / cam.zoom;
+  const float top = cam.target.y - cam.offset.y / cam.zoom;
+  const int minX = static_cast<int>(floorf(left / cellSize));
+  const int minY = static_cast<int>(floorf(top / cellSize));
+  const int maxX =
+      static_cast<int>(floorf((left + vp.width / cam.zoom) / cellSize));
+  const int maxY =
+      static_cast<int>(floorf((top + vp.height / cam.zoom) / cellSize));
+
+  if ((maxX - minX + 1) * (maxY - minY + 1) > HEATMAP_MAX_CELLS) {
+    DEBUG_DRAW_TEXT(layer, (creVec2{cam.target.x - 80.0f, top + 10.0f}), 16,
+                    (creColor{255, 255, 255, 255}),
+                    "Heatmap: zoom in to view");
+    return;
+  }
+
+  // Labels only when a cell is big enough on screen to read them
+  const bool labels = (cellSize * cam.zoom) >= 64.0f;
+  const creColor collidedColor = {255, 0, 255, 255};
+
+  for (int cy = minY; cy <= maxY; cy++) {
+    for (int cx = minX; cx <= maxX; cx++) {
+      const SpatialCellLoad load = SpatialHash_GetCellLoad(cx, cy);
+      if (load.bucketNodes == 0 && load.contacts == 0)
+        continue;
+
+      // Green (short chain) -> yellow -> red (HEATMAP_HOT_CHAIN or more)
+      const uint32_t chain = (load.bucketNodes < HEATMAP_HOT_CHAIN)
+                                 ? load.bucketNodes
+                                 : HEATMAP_HOT_CHAIN;
+      const float heat = static_cast<float>(chain) /
+                         static_cast<float>(HEATMAP_HOT_CHAIN);
+      const creColor color = {
+          static_cast<uint8_t>(fminf(1.0f, heat * 2.0f) * 255.0f),
+          static_cast<uint8_t>(fminf(1.0f, (1.0f - heat) * 2.0f) * 255.0f),
+          0, 90};
+
+      const creRectangle cell = {static_cast<float>(cx) * cellSize,
+                                 static_cast<float>(cy) * cellSize, cellSize,
+                                 cellSize};
+      DEBUG_DRAW_BOX(layer, cell, color, true);
+
+      // Another cell shares this bucket: its nodes are walked for nothing
+      if (load.bucketNodes > load.cellNodes) {
+        DEBUG_DRAW_BOX(layer, cell, collidedColor, false);
+      }
+
+      if (labels) {
+        DEBUG_DRAW_TEXTF(layer, (creVec2{cell.x + 4.0f, cell.y + 4.0f}), 10,
+                         (creColor{255, 255, 255, 255}), "%u/%u c%u",
+                         load.cellNodes, load.bucketNodes, load.contacts);
+      }
+    }
+  }
+}
+
 // ============================================================================
 // World-Space Alarm Overlay
 // ============================================================================
@@ -210,6 +318,11 @@ static void DebugSystem_RenderAlarms(EntityRegistry &reg) {
 
   const ViewportSize vp = Viewport_Get();
   const Camera2D cam = cameraUtils_GetActiveRaylib(reg, vp);
+  const creVec2 camPos = {cam.target.x, cam.target.y};
+  constexpr DebugDrawLayer layer = DEBUG_LAYER_WORLD;
+
+  uint32_t nanCount = 0;
+  uint32_t nanFirst = 0;
 
   for (uint32_t i = 0; i < bound; i++) {
     const uint64_t flags = reg.state_flags[i];
@@ -220,33 +333,18 @@ static void DebugSystem_RenderAlarms(EntityRegistry &reg) {
     const float px = reg.pos[i].x;
     const float py = reg.pos[i].y;
 
-    // Data corruption alarm: NaN/Inf transform values.
+    // Data corruption alarm: NaN/Inf transform values. Every corrupt
+    // entity would land on the same spot, so only the first is labelled.
     if (isnan(px) || isnan(py) || isinf(px) || isinf(py)) {
-      const creVec2 camPos = {cam.target.x, cam.target.y};
-      constexpr float boxSize = 100.0f;
-      const float halfBoxSize = boxSize * 0.5f;
-
-      DrawRectangle(static_cast<int>(camPos.x - halfBoxSize),
-                    static_cast<int>(camPos.y - halfBoxSize),
-                    static_cast<int>(boxSize), static_cast<int>(boxSize),
-                    Color{255, 0, 0, 100});
-
-      DrawRectangleLines(static_cast<int>(camPos.x - halfBoxSize),
-                         static_cast<int>(camPos.y - halfBoxSize),
-                         static_cast<int>(boxSize), static_cast<int>(boxSize),
-                         R_COL(colorNaN));
-
-      char nanStr[64];
-      snprintf(nanStr, sizeof(nanStr), "NaN ERROR [ID:%u]", i);
-      DrawText(nanStr, static_cast<int>(camPos.x - 60.0f),
-               static_cast<int>(camPos.y - 10.0f), 16, R_COL(colorNaN));
+      if (nanCount++ == 0) {
+        nanFirst = i;
+      }
       continue;
     }
 
     // Orphan alarm: entity is far outside expected world bounds.
     if (px < -ORPHAN_THRESHOLD || px > ORPHAN_THRESHOLD ||
         py < -ORPHAN_THRESHOLD || py > ORPHAN_THRESHOLD) {
-      const creVec2 camPos = {cam.target.x, cam.target.y};
       const float dx = px - camPos.x;
       const float dy = py - camPos.y;
       const float dist = sqrtf(dx * dx + dy * dy);
@@ -258,18 +356,33 @@ static void DebugSystem_RenderAlarms(EntityRegistry &reg) {
         const float edgeX = camPos.x + nx * (vp.width / cam.zoom / 2.5f);
         const float edgeY = camPos.y + ny * (vp.height / cam.zoom / 2.5f);
 
-        DrawCircle(static_cast<int>(edgeX), static_cast<int>(edgeY), 8.0f,
-                   R_COL(colorOrphan));
-        DrawLine(static_cast<int>(edgeX), static_cast<int>(edgeY),
-                 static_cast<int>(edgeX + nx * 20.0f),
-                 static_cast<int>(edgeY + ny * 20.0f), R_COL(colorOrphan));
-
-        char orphanStr[64];
-        snprintf(orphanStr, sizeof(orphanStr), "ORPHAN [ID:%u] @%.0f,%.0f", i,
-                 static_cast<double>(px), static_cast<double>(py));
-        DrawText(orphanStr, static_cast<int>(edgeX - 50.0f),
-                 static_cast<int>(edgeY - 25.0f), 10, R_COL(colorOrphan));
+        DEBUG_DRAW_CIRCLE(layer, (creVec2{edgeX, edgeY}), 8.0f, colorOrphan,
+                          true);
+        DEBUG_DRAW_LINE(layer, (creVec2{edgeX, edgeY}),
+                        (creVec2{edgeX + nx * 20.0f, edgeY + ny * 20.0f}),
+                        colorOrphan);
+        DEBUG_DRAW_TEXTF(layer, (creVec2{edgeX - 50.0f, edgeY - 25.0f}), 10,
+                         colorOrphan, "ORPHAN [ID:%u] @%.0f,%.0f", i,
+                         static_cast<double>(px), static_cast<double>(py));
       }
     }
   }
+
+  if (nanCount > 0) {
+    constexpr float boxSize = 100.0f;
+    const float halfBoxSize = boxSize * 0.5f;
+    const creRectangle box = {camPos.x - halfBoxSize, camPos.y - halfBoxSize,
+                              boxSize, boxSize};
+
+    DEBUG_DRAW_BOX(layer, box, (creColor{255, 0, 0, 100}), true);
+    DEBUG_DRAW_BOX(layer, box, colorNaN, false);
+    if (nanCount == 1) {
+      DEBUG_DRAW_TEXTF(layer, (creVec2{camPos.x - 60.0f, camPos.y - 10.0f}),
+                       16, colorNaN, "NaN ERROR [ID:%u]", nanFirst);
+    } else {
+      DEBUG_DRAW_TEXTF(layer, (creVec2{camPos.x - 60.0f, camPos.y - 10.0f}),
+                       16, colorNaN, "NaN ERROR [ID:%u] +%u", nanFirst,
+                       nanCount - 1);
+    }
+  }
 }
@@ -7,10 +7,11 @@
  *
  * Visualization:
  *   1. Alarm Overlay - Data corruption and orphan entity detection
- *   2. Stats HUD     - Real-time ECS and frame telemetry
+ *   2. Heatmap       - Spatial hash chain length / collisions / contacts
+ *   3. Stats HUD     - Real-time ECS and frame telemetry
  *
  * Controls:
- *   F1        - Toggle debug overlay on/off
+ *   F1        - Cycle debug overlay: off -> alarms -> heatmap
  *   TAB       - Toggle stats HUD (always available)
  */
 #ifndef DEBUGSYSTEM_H
@@ -29,6 +30,7 @@ struct CommandBus;
 typedef enum {
   DEBUG_MODE_OFF = 0,
   DEBUG_MODE_ALARMS,
+  DEBUG_MODE_HEATMAP, ///< Alarms + broad-phase heatmap (instrumented hash)
   DEBUG_MODE_COUNT
 } DebugVisualizationMode;
 
@@ -45,7 +47,7 @@ void DebugSystem_Init(void);
  * @brief Handle debug input.
  *
  * Key bindings:
- *   F1      - Toggle debug overlay
+ *   F1      - Cycle debug overlay mode
  *   TAB     - Toggle stats HUD
  *
  * @param reg Entity registry
@@ -63,7 +65,8 @@ uint32_t DebugSystem_GetActiveCount(EntityRegistry &reg);
  * @brief Render world-space debug visualizations.
  *
  * Call this INSIDE BeginWorldMode/EndWorldMode for proper camera transform.
- * Renders: alarm overlay (NaN/Inf and orphan detection).
+ * Renders: alarm overlay (NaN/Inf and orphan detection), plus the spatial
+ * hash heatmap in DEBUG_MODE_HEATMAP.
  *
  * @param reg Entity registry (read-only access)
  */
@@ -92,7 +95,8 @@ void DebugSystem_RenderPhysicsInsight(EntityRegistry &reg);
 /**
  * @brief Render stats HUD overlay (can be called independently).
  *
- * Shows: Entity counts, physics timing, memory usage.
+ * Shows: Entity counts, physics timing, memory usage, and broad-phase
+ * load in DEBUG_MODE_HEATMAP.
  *
  * @param reg Entity registry
  */
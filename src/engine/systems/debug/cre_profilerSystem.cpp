@@ -2,7 +2,9 @@
 
 #if CRE_ENABLE_PROFILER
 
-#include "raylib.h"
+#include "engine/core/cre_engineStats.h"
+#include "engine/platform/cre_framePacer.h"
+#include "engine/platform/cre_sys.h"
 #include <assert.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -13,7 +15,11 @@ struct ProfilerState {
   uint32_t sample_count[PROF_MAX_BUCKETS];
   bool is_open[PROF_MAX_BUCKETS];
   double print_accumulator_seconds;
-  char line_buffer[256];
+  EngineStats stats;
+  uint32_t phys_sub_steps;  // Last physics update
+  uint32_t phys_iterations; // Summed over its sub-steps
+  FramePacerStats pacing;
+  char line_buffer[384];
 };
 
 static ProfilerState s_profiler = {};
@@ -32,7 +38,7 @@ void Profiler_StartBucket(ProfilerBucket bucket) {
          "PROFILE_START called before PROFILE_END");
 #endif
 
-  s_profiler.start_time[bucket] = GetTime();
+  s_profiler.start_time[bucket] = Platform_GetTime();
   s_profiler.is_open[bucket] = true;
 }
 
@@ -53,7 +59,7 @@ void Profiler_EndBucket(ProfilerBucket bucket) {
     return;
   }
 
-  now = GetTime();
+  now = Platform_GetTime();
   elapsed = now - s_profiler.start_time[bucket];
 
   if (elapsed < 0.0) {
@@ -69,6 +75,19 @@ static double GetBucketAvgMs(ProfilerBucket bucket) {
   const double divisor = static_cast<double>(count > 0 ? count : 1U);
   return (s_profiler.sum_seconds[bucket] / divisor) * 1000.0;
 }
+void Profiler_SetEngineStats(const EngineStats &stats) {
+  s_profiler.stats = stats;
+}
+
+void Profiler_SetPhysicsSteps(uint32_t subSteps, uint32_t iterations) {
+  s_profiler.phys_sub_steps = subSteps;
+  s_profiler.phys_iterations = iterations;
+}
+
+void Profiler_SetFramePacing(const FramePacerStats &stats) {
+  s_profiler.pacing = stats;
+}
+
 void Profiler_UpdateAndPrint(float dt) {
   s_profiler.print_accumulator_seconds += static_cast<double>(dt);
 
@@ -78,16 +97,46 @@ void Profiler_UpdateAndPrint(float dt) {
   const double actv = GetBucketAvgMs(PROF_TOTAL_ACTIVE);
   const double scn = GetBucketAvgMs(PROF_SCENE);
   const double ecs = GetBucketAvgMs(PROF_ECS_SYS);
+  const double vis = GetBucketAvgMs(PROF_VISION);
+  const double ai = GetBucketAvgMs(PROF_AI);
   const double phy = GetBucketAvgMs(PROF_PHYSICS);
   const double ani = GetBucketAvgMs(PROF_ANIMATION);
+  const double twn = GetBucketAvgMs(PROF_TWEEN);
+  const double xfm = GetBucketAvgMs(PROF_TRANSFORM);
+  const double lit = GetBucketAvgMs(PROF_LIGHT);
   const double cam = GetBucketAvgMs(PROF_CAMERA);
   const double ren = GetBucketAvgMs(PROF_RENDER);
+  const double uiLayout = GetBucketAvgMs(PROF_UI_LAYOUT);
+  const double uiDraw = GetBucketAvgMs(PROF_UI_DRAW);
   const double cln = GetBucketAvgMs(PROF_CLEANUP);
-
-  snprintf(s_profiler.line_buffer, sizeof(s_profiler.line_buffer),
-           "\r[PROF] Actv: %.2f | Scn: %.2f | ECS: %.2f | Phy: %.2f | "
-           "Ani: %.2f | Cam: %.2f | Ren: %.2f | Cln: %.2f     ",
-           actv, scn, ecs, phy, ani, cam, ren, cln);
+  const uint32_t steps = s_profiler.phys_sub_steps;
+  const double itersPerStep =
+      static_cast<double>(s_profiler.phys_iterations) /
+      static_cast<double>(steps > 0 ? steps : 1U);
+
+  char *line = s_profiler.line_buffer;
+  const size_t size = sizeof(s_profiler.line_buffer);
+  int len = snprintf(
+      line, size,
+      "\r[PROF] Actv: %.2f | Scn: %.2f | ECS: %.2f | Vis: %.2f | "
+      "AI: %.2f | Phy: %.2f (%ux%.1f it) | Ani: %.2f | Twn: %.2f | "
+      "Xfm: %.2f | Lit: %.2f | Cam: %.2f | Ren: %.2f | UI: %.2f+%.2f | "
+      "Cln: %.2f | Ent: %u awake / %u",
+      actv, scn, ecs, vis, ai, phy, steps, itersPerStep, ani, twn, xfm, lit,
+      cam, ren, uiLayout, uiDraw, cln, s_profiler.stats.awake,
+      s_profiler.stats.active);
+  // Input-to-present estimate, only where a frame pacer runs (client)
+  const FramePacerStats &pacing = s_profiler.pacing;
+  if (len > 0 && static_cast<size_t>(len) < size && pacing.frames > 0) {
+    len += snprintf(line + len, size - static_cast<size_t>(len),
+                    " | Lat: %.1f (%.1f max, cost %.2f, wait %.2f)",
+                    static_cast<double>(pacing.latencyMs),
+                    static_cast<double>(pacing.latencyMaxMs),
+                    static_cast<double>(pacing.costMs),
+                    static_cast<double>(pacing.waitMs));
+  }
+  if (len > 0 && static_cast<size_t>(len) < size)
+    snprintf(line + len, size - static_cast<size_t>(len), "     ");
 
   fputs(s_profiler.line_buffer, stdout);
   fflush(stdout);
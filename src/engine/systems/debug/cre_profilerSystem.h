@@ -3,16 +3,26 @@
 
 #include <stdint.h>
 
+struct EngineStats;
+struct FramePacerStats;
+
 #define CRE_ENABLE_PROFILER 1
 
 typedef enum {
   PROF_TOTAL_ACTIVE = 0,
   PROF_SCENE,
   PROF_ECS_SYS,
+  PROF_VISION,
+  PROF_AI,
   PROF_PHYSICS,
   PROF_ANIMATION,
+  PROF_TWEEN,
+  PROF_TRANSFORM,
+  PROF_LIGHT,
   PROF_CAMERA,
   PROF_RENDER,
+  PROF_UI_LAYOUT,
+  PROF_UI_DRAW,
   PROF_CLEANUP,
   PROF_MAX_BUCKETS
 } ProfilerBucket;
@@ -21,6 +31,9 @@ typedef enum {
 void Profiler_StartBucket(ProfilerBucket bucket);
 void Profiler_EndBucket(ProfilerBucket bucket);
 void Profiler_UpdateAndPrint(float dt);
+void Profiler_SetEngineStats(const EngineStats &stats); // Printed with the line
+void Profiler_SetPhysicsSteps(uint32_t subSteps, uint32_t iterations);
+void Profiler_SetFramePacing(const FramePacerStats &stats);
 
 #define PROFILE_START(bucket) Profiler_StartBucket((bucket))
 #define PROFILE_END(bucket) Profiler_EndBucket((bucket))
@@ -29,6 +42,17 @@ void Profiler_UpdateAndPrint(float dt);
 #define PROFILE_END(bucket) ((void)0)
 
 static inline void Profiler_UpdateAndPrint(float dt) { (void)dt; }
+static inline void Profiler_SetEngineStats(const EngineStats &stats) {
+  (void)stats;
+}
+static inline void Profiler_SetPhysicsSteps(uint32_t subSteps,
+                                            uint32_t iterations) {
+  (void)subSteps;
+  (void)iterations;
+}
+static inline void Profiler_SetFramePacing(const FramePacerStats &stats) {
+  (void)stats;
+}
 #endif
 
 #endif
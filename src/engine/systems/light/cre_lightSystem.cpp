@@ -0,0 +1,504 @@
+#include "cre_lightSystem.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include "engine/memory/cre_arena.h"
+#include "engine/systems/physics/cre_staticGeometry.h"
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr uint16_t LIGHT_NIL = 0xFFFF;
+static constexpr size_t LIGHT_ALIGNMENT = 64;
+// A flood of radius r stays within r - 1 steps of its cell
+static constexpr uint32_t LIGHT_BOX_SIDE = 2 * LIGHT_MAX_RADIUS - 1;
+static constexpr uint32_t LIGHT_BOX_CELLS = LIGHT_BOX_SIDE * LIGHT_BOX_SIDE;
+
+static_assert(LIGHT_MAX_LIGHTS < LIGHT_NIL,
+              "Light indices must fit below LIGHT_NIL");
+static_assert(LIGHT_MAX_RADIUS > 0 && LIGHT_MAX_RADIUS < 0xFF,
+              "Radii are stored as uint8");
+static_assert(LIGHT_BOX_CELLS <= 0xFFFF, "Flood boxes use uint16 indices");
+
+enum LightCellBits : uint8_t {
+  LIGHT_CELL_STATIC = 1 << 0,      // Covered by compiled static geometry
+  LIGHT_CELL_WALL = 1 << 1,        // Set with LightSystem_SetWall
+  LIGHT_CELL_STATIC_NEXT = 1 << 2, // Scratch while resyncing the static bits
+};
+
+static constexpr uint8_t LIGHT_CELL_SOLID =
+    LIGHT_CELL_STATIC | LIGHT_CELL_WALL;
+
+enum LightFlags : uint8_t {
+  LIGHT_FLAG_ALIVE = 1 << 0,
+  LIGHT_FLAG_APPLIED = 1 << 1, // Its flood is in the map at cellX/cellY
+};
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Summed light of one cell. Interleaved: floods and samples always
+ * touch all three channels.
+ */
+struct LightAccum {
+  uint32_t r;
+  uint32_t g;
+  uint32_t b;
+};
+
+struct LightGrid {
+  uint8_t *cells; // LightCellBits
+  LightAccum *accum;
+  int32_t width;
+  int32_t height;
+  size_t bytes;
+  uint32_t staticRevision; // Of the static geometry the bits mirror
+  creColor ambient;
+  bool enabled;
+};
+
+struct LightPool {
+  Entity entity[LIGHT_MAX_LIGHTS];
+  creColor color[LIGHT_MAX_LIGHTS];
+  int32_t cellX[LIGHT_MAX_LIGHTS]; // Where the applied flood starts
+  int32_t cellY[LIGHT_MAX_LIGHTS];
+  uint16_t gen[LIGHT_MAX_LIGHTS];
+  uint16_t nextFree[LIGHT_MAX_LIGHTS];
+  uint8_t radius[LIGHT_MAX_LIGHTS];
+  uint8_t flags[LIGHT_MAX_LIGHTS];
+  uint16_t freeHead;
+  uint32_t bound; // Highest slot ever used + 1
+  uint32_t alive;
+};
+
+static LightGrid s_grid = {};
+static LightPool s_lights = {};
+static LightStats s_stats = {};
+static uint32_t s_wallChanges = 0; // Solid <-> open since the last update
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+static size_t AlignUp(size_t bytes) {
+  return (bytes + LIGHT_ALIGNMENT - 1) & ~(LIGHT_ALIGNMENT - 1);
+}
+
+size_t LightSystem_MemorySize(uint32_t width, uint32_t height) {
+  const size_t n = static_cast<size_t>(width) * height;
+  return AlignUp(sizeof(uint8_t) * n) + AlignUp(sizeof(LightAccum) * n);
+}
+
+static void ResetLights(void) {
+  for (uint32_t i = 0; i < LIGHT_MAX_LIGHTS; i++) {
+    s_lights.gen[i]++; // Live handles become stale
+    s_lights.flags[i] = 0;
+    s_lights.nextFree[i] =
+        (i + 1 < LIGHT_MAX_LIGHTS) ? static_cast<uint16_t>(i + 1) : LIGHT_NIL;
+  }
+  s_lights.freeHead = 0;
+  s_lights.bound = 0;
+  s_lights.alive = 0;
+}
+
+bool LightSystem_Init(Arena *arena, uint32_t width, uint32_t height) {
+  const size_t bytes = LightSystem_MemorySize(width, height);
+  if (width == 0 || height == 0 || width > INT32_MAX / height ||
+      arena_Remaining(arena) < bytes + LIGHT_ALIGNMENT) {
+    Log(LogLevel::Error, "LightSystem_Init: Arena too small for {}x{} cells",
+        width, height);
+    s_grid = {};
+    return false;
+  }
+
+  uint8_t *cursor = static_cast<uint8_t *>(
+      arena_PushAligned(arena, bytes, LIGHT_ALIGNMENT));
+  const size_t n = static_cast<size_t>(width) * height;
+  s_grid.cells = cursor;
+  s_grid.accum = reinterpret_cast<LightAccum *>(cursor + AlignUp(n));
+  s_grid.width = static_cast<int32_t>(width);
+  s_grid.height = static_cast<int32_t>(height);
+  s_grid.bytes = bytes;
+  LightSystem_Clear();
+
+  Log(LogLevel::Info, "Light System Initialized ({}x{} cells, {} KB)", width,
+      height, bytes / 1024);
+  return true;
+}
+
+void LightSystem_Clear(void) {
+  ResetLights();
+  s_stats = {};
+  s_wallChanges = 0;
+  if (!s_grid.cells)
+    return;
+  memset(s_grid.cells, 0, s_grid.bytes);
+  // Mirror the static geometry again on the next update
+  s_grid.staticRevision = StaticGeometry_GetRevision() - 1;
+  s_grid.ambient = creColor{0, 0, 0, 255};
+  s_grid.enabled = false;
+}
+
+void LightSystem_SetEnabled(bool enabled) {
+  s_grid.enabled = enabled && s_grid.cells;
+}
+
+bool LightSystem_IsEnabled(void) { return s_grid.enabled; }
+
+void LightSystem_SetAmbient(creColor ambient) { s_grid.ambient = ambient; }
+
+// ============================================================================
+// Flood Fill
+// ============================================================================
+
+static inline bool InGrid(int32_t x, int32_t y) {
+  return x >= 0 && y >= 0 && x < s_grid.width && y < s_grid.height;
+}
+
+static inline uint32_t CellIndex(int32_t x, int32_t y) {
+  return static_cast<uint32_t>(y * s_grid.width + x);
+}
+
+/**
+ * @brief Breadth-first fill from the light's cell, adding (or subtracting)
+ * its falloff to every cell reached. Walls receive light but are not
+ * expanded. Subtraction over the same occupancy visits the same cells with
+ * the same distances, so it cancels the add exactly.
+ */
+static void Flood(uint32_t l, bool add) {
+  const int32_t cx = s_lights.cellX[l];
+  const int32_t cy = s_lights.cellY[l];
+  if (!InGrid(cx, cy))
+    return;
+
+  const int32_t r = s_lights.radius[l];
+  const creColor color = s_lights.color[l];
+  uint32_t falloff[LIGHT_MAX_RADIUS][3];
+  for (int32_t d = 0; d < r; d++) {
+    const uint32_t level = static_cast<uint32_t>(r - d);
+    const uint32_t div = static_cast<uint32_t>(r);
+    falloff[d][0] = color.r * level / div;
+    falloff[d][1] = color.g * level / div;
+    falloff[d][2] = color.b * level / div;
+  }
+
+  // Local box around the light, center at (r - 1, r - 1). Cells of the box
+  // outside the grid start visited, so the fill needs no bounds checks.
+  const int32_t side = 2 * r - 1;
+  const int32_t originX = cx - (r - 1);
+  const int32_t originY = cy - (r - 1);
+  uint8_t visited[LIGHT_BOX_CELLS];
+  uint16_t queueLocal[LIGHT_BOX_CELLS];
+  uint32_t queueCell[LIGHT_BOX_CELLS];
+  memset(visited, 0, static_cast<size_t>(side * side));
+  if (originX < 0 || originY < 0 || originX + side > s_grid.width ||
+      originY + side > s_grid.height) {
+    for (int32_t ly = 0; ly < side; ly++) {
+      for (int32_t lx = 0; lx < side; lx++) {
+        visited[ly * side + lx] = !InGrid(originX + lx, originY + ly);
+      }
+    }
+  }
+
+  const int32_t localStep[4] = {1, -1, side, -side};
+  const int32_t cellStep[4] = {1, -1, s_grid.width, -s_grid.width};
+  const int32_t start = (r - 1) * side + (r - 1);
+  visited[start] = 1;
+  queueLocal[0] = static_cast<uint16_t>(start);
+  queueCell[0] = CellIndex(cx, cy);
+  uint32_t head = 0;
+  uint32_t tail = 1;
+  uint32_t layerEnd = 1;
+  int32_t d = 0;
+  LightAccum *const accum = s_grid.accum;
+  const uint8_t *const cells = s_grid.cells;
+
+  while (head < tail) {
+    if (head == layerEnd) {
+      d++;
+      layerEnd = tail;
+    }
+    const int32_t local = queueLocal[head];
+    const uint32_t index = queueCell[head];
+    head++;
+    LightAccum &cell = accum[index];
+    if (add) {
+      cell.r += falloff[d][0];
+      cell.g += falloff[d][1];
+      cell.b += falloff[d][2];
+    } else {
+      cell.r -= falloff[d][0];
+      cell.g -= falloff[d][1];
+      cell.b -= falloff[d][2];
+    }
+
+    // Neighbours of cells closer than r - 1 never leave the box
+    if (d + 1 >= r || (cells[index] & LIGHT_CELL_SOLID))
+      continue;
+    for (uint32_t k = 0; k < 4; k++) {
+      const int32_t next = local + localStep[k];
+      if (visited[next])
+        continue;
+      visited[next] = 1;
+      queueLocal[tail] = static_cast<uint16_t>(next);
+      queueCell[tail] = static_cast<uint32_t>(static_cast<int32_t>(index) +
+                                              cellStep[k]);
+      tail++;
+    }
+  }
+  s_stats.floods++;
+  s_stats.cells += tail;
+}
+
+static void Unapply(uint32_t l) {
+  if (!(s_lights.flags[l] & LIGHT_FLAG_APPLIED))
+    return;
+  Flood(l, false);
+  s_lights.flags[l] &= static_cast<uint8_t>(~LIGHT_FLAG_APPLIED);
+}
+
+/**
+ * @brief Change a cell's occupancy. Lights that can reach it are removed
+ * first, over the occupancy they were added with; Update re-adds them.
+ */
+static void SetCellBits(int32_t x, int32_t y, uint8_t bits) {
+  uint8_t &cell = s_grid.cells[CellIndex(x, y)];
+  if ((cell ^ bits) & LIGHT_CELL_SOLID) {
+    if (((cell & LIGHT_CELL_SOLID) != 0) != ((bits & LIGHT_CELL_SOLID) != 0)) {
+      for (uint32_t l = 0; l < s_lights.bound; l++) {
+        if (!(s_lights.flags[l] & LIGHT_FLAG_APPLIED))
+          continue;
+        const int32_t dx = abs(s_lights.cellX[l] - x);
+        const int32_t dy = abs(s_lights.cellY[l] - y);
+        if (dx + dy < s_lights.radius[l]) {
+          Unapply(l);
+        }
+      }
+      s_wallChanges++;
+    }
+  }
+  cell = bits;
+}
+
+/**
+ * @brief Mirror the compiled static colliders into the STATIC bits: raster
+ * into the scratch bit, then apply only the cells that differ.
+ */
+static void SyncStatic(void) {
+  const uint32_t count = StaticGeometry_Count();
+  for (uint32_t i = 0; i < count; i++) {
+    const StaticCellRange range = StaticGeometry_GetCellRange(
+        *StaticGeometry_Get(i), LIGHT_CELL_SIZE, s_grid.width, s_grid.height);
+    for (int32_t y = range.minY; y <= range.maxY; y++) {
+      for (int32_t x = range.minX; x <= range.maxX; x++) {
+        s_grid.cells[CellIndex(x, y)] |= LIGHT_CELL_STATIC_NEXT;
+      }
+    }
+  }
+
+  for (int32_t y = 0; y < s_grid.height; y++) {
+    for (int32_t x = 0; x < s_grid.width; x++) {
+      const uint8_t cell = s_grid.cells[CellIndex(x, y)];
+      const bool next = (cell & LIGHT_CELL_STATIC_NEXT) != 0;
+      uint8_t bits = cell & static_cast<uint8_t>(~(LIGHT_CELL_STATIC |
+                                                   LIGHT_CELL_STATIC_NEXT));
+      bits = next ? static_cast<uint8_t>(bits | LIGHT_CELL_STATIC) : bits;
+      SetCellBits(x, y, bits);
+    }
+  }
+  s_grid.staticRevision = StaticGeometry_GetRevision();
+}
+
+// ============================================================================
+// Lights
+// ============================================================================
+
+static bool LightSystem_IsHandleValid(LightID light) {
+  return light.index < LIGHT_MAX_LIGHTS &&
+         (s_lights.flags[light.index] & LIGHT_FLAG_ALIVE) &&
+         s_lights.gen[light.index] == light.gen;
+}
+
+static uint8_t ClampRadius(uint32_t radius) {
+  return static_cast<uint8_t>(
+      std::min(std::max(radius, 1u), LIGHT_MAX_RADIUS));
+}
+
+LightID LightSystem_Create(Entity entity, creColor color, uint32_t radius) {
+  if (!s_grid.cells || s_lights.freeHead == LIGHT_NIL) {
+    Log(LogLevel::Warning, "LightSystem_Create: No free light");
+    return LIGHT_INVALID;
+  }
+  const uint16_t l = s_lights.freeHead;
+  s_lights.freeHead = s_lights.nextFree[l];
+  s_lights.entity[l] = entity;
+  s_lights.color[l] = color;
+  s_lights.radius[l] = ClampRadius(radius);
+  s_lights.flags[l] = LIGHT_FLAG_ALIVE; // Flooded by the next update
+  s_lights.bound = std::max(s_lights.bound, static_cast<uint32_t>(l) + 1);
+  s_lights.alive++;
+  return LightID{.index = l, .gen = s_lights.gen[l]};
+}
+
+static void Release(uint32_t l) {
+  Unapply(l);
+  s_lights.gen[l]++;
+  s_lights.flags[l] = 0;
+  s_lights.nextFree[l] = s_lights.freeHead;
+  s_lights.freeHead = static_cast<uint16_t>(l);
+  s_lights.alive--;
+}
+
+void LightSystem_Destroy(LightID light) {
+  if (LightSystem_IsHandleValid(light)) {
+    Release(light.index);
+  }
+}
+
+void LightSystem_Set(LightID light, creColor color, uint32_t radius) {
+  if (!LightSystem_IsHandleValid(light))
+    return;
+  const uint32_t l = light.index;
+  const creColor old = s_lights.color[l];
+  const uint8_t r = ClampRadius(radius);
+  if (old.r == color.r && old.g == color.g && old.b == color.b &&
+      s_lights.radius[l] == r)
+    return;
+  Unapply(l); // With the old color and radius
+  s_lights.color[l] = color;
+  s_lights.radius[l] = r;
+}
+
+void LightSystem_SetWall(int32_t cellX, int32_t cellY, bool solid) {
+  if (!s_grid.cells || !InGrid(cellX, cellY))
+    return;
+  const uint8_t cell = s_grid.cells[CellIndex(cellX, cellY)];
+  SetCellBits(cellX, cellY,
+              solid ? static_cast<uint8_t>(cell | LIGHT_CELL_WALL)
+                    : static_cast<uint8_t>(cell & ~LIGHT_CELL_WALL));
+}
+
+bool LightSystem_IsWall(int32_t cellX, int32_t cellY) {
+  return s_grid.cells && InGrid(cellX, cellY) &&
+         (s_grid.cells[CellIndex(cellX, cellY)] & LIGHT_CELL_SOLID);
+}
+
+// ============================================================================
+// Update
+// ============================================================================
+
+void LightSystem_Update(const EntityRegistry &reg) {
+  if (!s_grid.cells)
+    return;
+  s_stats.floods = 0;
+  s_stats.cells = 0;
+  if (s_grid.staticRevision != StaticGeometry_GetRevision()) {
+    SyncStatic();
+  }
+
+  const float inv = 1.0f / LIGHT_CELL_SIZE;
+  for (uint32_t l = 0; l < s_lights.bound; l++) {
+    const uint8_t flags = s_lights.flags[l];
+    if (!(flags & LIGHT_FLAG_ALIVE))
+      continue;
+    const Entity entity = s_lights.entity[l];
+    if (!EntityRegistry_IsAlive(reg, entity)) {
+      Release(l);
+      continue;
+    }
+    const creVec2 pos = reg.pos[entity.id];
+    const int32_t x = static_cast<int32_t>(floorf(pos.x * inv));
+    const int32_t y = static_cast<int32_t>(floorf(pos.y * inv));
+    if ((flags & LIGHT_FLAG_APPLIED) && x == s_lights.cellX[l] &&
+        y == s_lights.cellY[l])
+      continue;
+    Unapply(l);
+    s_lights.cellX[l] = x;
+    s_lights.cellY[l] = y;
+    Flood(l, true);
+    s_lights.flags[l] |= LIGHT_FLAG_APPLIED;
+  }
+  s_stats.walls = s_wallChanges;
+  s_wallChanges = 0;
+}
+
+void LightSystem_Invalidate(void) {
+  if (!s_grid.cells)
+    return;
+  const size_t n = static_cast<size_t>(s_grid.width) *
+                   static_cast<size_t>(s_grid.height);
+  memset(s_grid.accum, 0, sizeof(LightAccum) * n);
+  for (uint32_t l = 0; l < s_lights.bound; l++) {
+    s_lights.flags[l] &= static_cast<uint8_t>(~LIGHT_FLAG_APPLIED);
+  }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+static inline uint8_t Saturate(uint32_t ambient, uint32_t light) {
+  const uint32_t sum = ambient + light;
+  return static_cast<uint8_t>(sum < 255 ? sum : 255);
+}
+
+static inline creColor CellAt(const creColor &a, int32_t x, int32_t y) {
+  const LightAccum &c = s_grid.accum[CellIndex(x, y)];
+  return creColor{Saturate(a.r, c.r), Saturate(a.g, c.g), Saturate(a.b, c.b),
+                  255};
+}
+
+creColor LightSystem_GetCell(int32_t cellX, int32_t cellY) {
+  const creColor a = s_grid.ambient;
+  if (!s_grid.cells || !InGrid(cellX, cellY))
+    return creColor{a.r, a.g, a.b, 255};
+  return CellAt(a, cellX, cellY);
+}
+
+creColor LightSystem_Sample(creVec2 worldPos) {
+  const float fx = worldPos.x * (1.0f / LIGHT_CELL_SIZE) - 0.5f;
+  const float fy = worldPos.y * (1.0f / LIGHT_CELL_SIZE) - 0.5f;
+  const float x0 = floorf(fx);
+  const float y0 = floorf(fy);
+  const float tx = fx - x0;
+  const float ty = fy - y0;
+  const int32_t x = static_cast<int32_t>(x0);
+  const int32_t y = static_cast<int32_t>(y0);
+
+  creColor c00, c10, c01, c11;
+  const creColor a = s_grid.ambient;
+  if (s_grid.cells && x >= 0 && y >= 0 && x + 1 < s_grid.width &&
+      y + 1 < s_grid.height) {
+    c00 = CellAt(a, x, y);
+    c10 = CellAt(a, x + 1, y);
+    c01 = CellAt(a, x, y + 1);
+    c11 = CellAt(a, x + 1, y + 1);
+  } else {
+    c00 = LightSystem_GetCell(x, y);
+    c10 = LightSystem_GetCell(x + 1, y);
+    c01 = LightSystem_GetCell(x, y + 1);
+    c11 = LightSystem_GetCell(x + 1, y + 1);
+  }
+  const float w00 = (1.0f - tx) * (1.0f - ty);
+  const float w10 = tx * (1.0f - ty);
+  const float w01 = (1.0f - tx) * ty;
+  const float w11 = tx * ty;
+  const auto mix = [&](uint8_t p00, uint8_t p10, uint8_t p01, uint8_t p11) {
+    const float v =
+        static_cast<float>(p00) * w00 + static_cast<float>(p10) * w10 +
+        static_cast<float>(p01) * w01 + static_cast<float>(p11) * w11;
+    return static_cast<uint8_t>(v + 0.5f);
+  };
+  return creColor{mix(c00.r, c10.r, c01.r, c11.r),
+                  mix(c00.g, c10.g, c01.g, c11.g),
+                  mix(c00.b, c10.b, c01.b, c11.b), 255};
+}
+
+LightStats LightSystem_GetStats(void) {
+  LightStats stats = s_stats;
+  stats.lights = s_lights.alive;
+  return stats;
+}
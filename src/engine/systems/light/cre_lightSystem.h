@@ -0,0 +1,121 @@
+/**
+ * @file cre_lightSystem.h
+ * @brief CPU Tile Light Map (Flood Fill, Incremental Updates)
+ *
+ * A fixed grid of LIGHT_CELL_SIZE cells (origin at world 0,0) holds, per
+ * cell, whether it blocks light and the summed RGB of every light reaching
+ * it. A light is attached to an entity and floods outwards from the
+ * entity's cell: a breadth-first fill over open cells (4-connected, up to
+ * `radius` steps), each reached cell receiving color * (radius - d) /
+ * radius. Walls are lit but do not pass light on.
+ *
+ * Contributions are integer sums, so a light is removed exactly by
+ * flooding it again over the same occupancy and subtracting. Updates only
+ * touch what changed:
+ *   - A light whose entity entered another cell (or whose color/radius
+ *     changed) is subtracted at its old cell and added at the new one.
+ *   - A wall change first subtracts every light whose flood box covers the
+ *     cell (with the old occupancy), then re-adds them on the next update.
+ *   - Occupancy comes from the compiled static geometry (resynced when its
+ *     revision changes, cell by cell through the wall path) plus walls set
+ *     with LightSystem_SetWall (doors, destructible tiles).
+ *
+ * The map is presentation state: it is derived from positions and static
+ * geometry, never saved, and has no renderer dependency (the server links
+ * it). The sprite batch samples it per vertex when it is enabled.
+ */
+
+#ifndef CRE_LIGHTSYSTEM_H
+#define CRE_LIGHTSYSTEM_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Forward declarations (dependency injection)
+struct Arena;
+struct EntityRegistry;
+
+struct LightStats {
+  uint32_t lights; ///< Live lights
+  uint32_t floods; ///< Floods (adds + removals) run by the last update
+  uint32_t cells;  ///< Cells written by those floods
+  uint32_t walls;  ///< Cells that turned solid or open since the previous
+                   ///< update (static resync included)
+};
+
+/**
+ * @brief Bytes LightSystem_Init pushes for a grid size.
+ */
+size_t LightSystem_MemorySize(uint32_t width, uint32_t height);
+
+/**
+ * @brief Carve the grid out of arena and reset it (dark, no walls).
+ * @return false if the arena is too small (lighting stays unavailable)
+ */
+bool LightSystem_Init(Arena *arena, uint32_t width, uint32_t height);
+
+/**
+ * @brief Remove every light and wall, disable sampling (scene changes).
+ */
+void LightSystem_Clear(void);
+
+/**
+ * @brief Sprites are shaded by the map only while enabled (default off).
+ */
+void LightSystem_SetEnabled(bool enabled);
+bool LightSystem_IsEnabled(void);
+
+/**
+ * @brief Light every cell receives before the lights are added.
+ */
+void LightSystem_SetAmbient(creColor ambient);
+
+/**
+ * @brief Attach a light to an entity. It follows the entity's position and
+ * is removed when the entity dies.
+ * @param radius Reach in cells, clamped to [1, LIGHT_MAX_RADIUS]
+ * @return Handle, or LIGHT_INVALID if every light is in use
+ */
+LightID LightSystem_Create(Entity entity, creColor color, uint32_t radius);
+
+/**
+ * @brief Remove a light. Stale handles are ignored.
+ */
+void LightSystem_Destroy(LightID light);
+
+void LightSystem_Set(LightID light, creColor color, uint32_t radius);
+
+/**
+ * @brief Block (or open) one cell on top of the static geometry.
+ */
+void LightSystem_SetWall(int32_t cellX, int32_t cellY, bool solid);
+
+bool LightSystem_IsWall(int32_t cellX, int32_t cellY);
+
+/**
+ * @brief Follow the lights' entities and static geometry changes, and
+ * flood whatever moved. Cheap when nothing did.
+ */
+void LightSystem_Update(const EntityRegistry &reg);
+
+/**
+ * @brief Drop the map and flood every light again on the next update.
+ */
+void LightSystem_Invalidate(void);
+
+/**
+ * @brief Light of one cell (ambient included, saturated); ambient outside
+ * the grid.
+ */
+creColor LightSystem_GetCell(int32_t cellX, int32_t cellY);
+
+/**
+ * @brief Light at a world position, bilinear between cell centers.
+ */
+creColor LightSystem_Sample(creVec2 worldPos);
+
+LightStats LightSystem_GetStats(void);
+
+#endif
@@ -1,4 +1,5 @@
 #include "cre_physicsAPI.h"
+#include "cre_physicsConstraints.h"
 #include "cre_physics_defs.h"
 #include "engine/core/cre_commandBus.h"
 #include "engine/core/cre_logger.h"
@@ -121,6 +122,56 @@ void physicsAPI_ResetWorld(CommandBus &bus) {
   CommandBus_Push(bus, cmd);
 }
 
+static PhysJointID physicsAPI_PushJoint(CommandBus &bus, PhysJointType type,
+                                        Entity a, Entity b, creVec2 anchor,
+                                        float length) {
+  const PhysJointID joint = PhysicsConstraints_AllocateID();
+  if (joint.index == PHYS_JOINT_INVALID.index) {
+    return PHYS_JOINT_INVALID;
+  }
+
+  Command cmd = {.type = CMD_PHYS_JOINT_CREATE,
+                 .entity = a,
+                 .physJoint = {.joint = joint,
+                               .other = b,
+                               .anchor = anchor,
+                               .length = length,
+                               .type = static_cast<uint8_t>(type)}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "physicsAPI_CreateJoint: CommandBus is full!");
+    PhysicsConstraints_ReleaseID(joint);
+    return PHYS_JOINT_INVALID;
+  }
+  return joint;
+}
+
+PhysJointID physicsAPI_CreateJoint(CommandBus &bus, PhysJointType type,
+                                   Entity a, Entity b, float length) {
+  return physicsAPI_PushJoint(bus, type, a, b, creVec2{0.0f, 0.0f}, length);
+}
+
+PhysJointID physicsAPI_CreateWorldJoint(CommandBus &bus, PhysJointType type,
+                                        Entity a, creVec2 anchor,
+                                        float length) {
+  return physicsAPI_PushJoint(bus, type, a, ENTITY_INVALID, anchor, length);
+}
+
+void physicsAPI_DestroyJoint(CommandBus &bus, PhysJointID joint) {
+
+  Command cmd = {.type = CMD_PHYS_JOINT_DESTROY,
+                 .entity = ENTITY_INVALID,
+                 .physJoint = {.joint = joint,
+                               .other = ENTITY_INVALID,
+                               .anchor = creVec2{0.0f, 0.0f},
+                               .length = 0.0f,
+                               .type = 0}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "physicsAPI_DestroyJoint: CommandBus is full!");
+  }
+}
+
 creVec2 physicsAPI_GetVelocity(const EntityRegistry &reg, Entity entity) {
   if (!EntityRegistry_IsAlive(reg, entity)) {
     return creVec2{0.0f, 0.0f};
@@ -1,6 +1,7 @@
 #ifndef CRE_PHYSICSAPI_H
 #define CRE_PHYSICSAPI_H
 
+#include "cre_physics_defs.h"
 #include "engine/core/cre_types.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -22,6 +23,14 @@ void physicsAPI_SetGlobalGravity(CommandBus &bus, float x, float y);
 void physicsAPI_LoadStaticGeometry(CommandBus &bus);
 void physicsAPI_ResetWorld(CommandBus &bus);
 
+// Joints. Anchors are body centers; length <= 0 uses the current distance.
+PhysJointID physicsAPI_CreateJoint(CommandBus &bus, PhysJointType type,
+                                   Entity a, Entity b, float length);
+PhysJointID physicsAPI_CreateWorldJoint(CommandBus &bus, PhysJointType type,
+                                        Entity a, creVec2 anchor,
+                                        float length);
+void physicsAPI_DestroyJoint(CommandBus &bus, PhysJointID joint);
+
 creVec2 physicsAPI_GetVelocity(const EntityRegistry &reg, Entity entity);
 bool physicsAPI_IsSleeping(const EntityRegistry &reg, Entity entity);
 uint8_t physicsAPI_GetMaterial(const EntityRegistry &reg, Entity entity);
@@ -0,0 +1,497 @@
+#include "cre_physicsConstraints.h"
+#include "cre_physicsSolver.h"
+#include "cre_physics_defs.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <assert.h>
+#include <bit>
+#include <math.h>
+#include <string.h>
+
+static_assert(PHYS_MAX_JOINTS < 0xFFFF, "Joint handles use 16-bit indices");
+
+// Rows of one color never share a dynamic body. The last color is the
+// overflow bucket and must stay serial if colors ever run out.
+static constexpr uint32_t JOINT_MAX_COLORS = 64;
+
+static constexpr uint8_t JOINT_SLOT_FREE = 0xFF;
+static constexpr uint8_t JOINT_SLOT_RESERVED = 0xFE;
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Persistent joint storage, one pool per type (SoA, dense).
+ */
+struct JointPool {
+  alignas(64) Entity a[PHYS_MAX_JOINTS];
+  alignas(64) Entity b[PHYS_MAX_JOINTS]; // ENTITY_INVALID = world anchor
+  alignas(64) creVec2 offsetA[PHYS_MAX_JOINTS]; // Anchor relative to A pos
+  alignas(64) creVec2 offsetB[PHYS_MAX_JOINTS]; // Relative to B, or world
+  alignas(64) creVec2 param[PHYS_MAX_JOINTS];   // Length (x) / weld delta
+  alignas(64) uint16_t handle[PHYS_MAX_JOINTS]; // Back-reference for removal
+  uint32_t count;
+};
+
+/**
+ * @brief Per sub-step solver rows, stored color by color.
+ */
+struct JointRows {
+  alignas(64) uint32_t bodyA[PHYS_MAX_JOINTS]; // Solver-local slot
+  alignas(64) uint32_t bodyB[PHYS_MAX_JOINTS]; // Solver-local slot
+  alignas(64) float invMassA[PHYS_MAX_JOINTS];
+  alignas(64) float invMassB[PHYS_MAX_JOINTS];
+  alignas(64) float effMass[PHYS_MAX_JOINTS]; // 1 / (invMassA + invMassB)
+  alignas(64) creVec2 offsetA[PHYS_MAX_JOINTS];
+  alignas(64) creVec2 offsetB[PHYS_MAX_JOINTS];
+  alignas(64) creVec2 param[PHYS_MAX_JOINTS];
+  uint32_t colorStart[JOINT_MAX_COLORS + 1];
+  uint32_t count;
+};
+
+/**
+ * @brief Pools + handle table: everything that outlives a step (rollback
+ * saves it as one simulation state block).
+ */
+struct JointStore {
+  JointPool pools[PHYS_JOINT_TYPE_COUNT];
+  uint16_t gen[PHYS_MAX_JOINTS];
+  uint8_t type[PHYS_MAX_JOINTS]; // Type, FREE or RESERVED
+  uint16_t dense[PHYS_MAX_JOINTS];
+  uint16_t freeIDs[PHYS_MAX_JOINTS];
+  int32_t freeTop;
+};
+
+static JointStore s_joints = {.pools = {},
+                              .gen = {},
+                              .type = {},
+                              .dense = {},
+                              .freeIDs = {},
+                              .freeTop = -1};
+static JointRows s_rows[PHYS_JOINT_TYPE_COUNT];
+
+// Graph coloring scratch (per solver slot, stamp-validated)
+static uint64_t s_slotColors[MAX_ENTITIES + 1];
+static uint32_t s_slotColorStamp[MAX_ENTITIES + 1];
+static uint32_t s_colorStamp = 0;
+
+// Prepare scratch
+static uint16_t s_candidate[PHYS_MAX_JOINTS];
+static uint32_t s_candidateA[PHYS_MAX_JOINTS];
+static uint32_t s_candidateB[PHYS_MAX_JOINTS];
+static float s_candidateInvA[PHYS_MAX_JOINTS];
+static float s_candidateInvB[PHYS_MAX_JOINTS];
+static uint8_t s_candidateColor[PHYS_MAX_JOINTS];
+
+static uint32_t s_rowCount = 0;
+
+// ============================================================================
+// Handle Table
+// ============================================================================
+
+void PhysicsConstraints_Init(void) {
+  memset(s_joints.gen, 0, sizeof(s_joints.gen));
+  PhysicsConstraints_Clear();
+}
+
+void PhysicsConstraints_Clear(void) {
+  for (uint32_t t = 0; t < PHYS_JOINT_TYPE_COUNT; t++) {
+    s_joints.pools[t].count = 0;
+    s_rows[t].count = 0;
+  }
+
+  // Bump every generation so reserved and live handles become stale.
+  s_joints.freeTop = -1;
+  for (int32_t i = static_cast<int32_t>(PHYS_MAX_JOINTS) - 1; i >= 0; --i) {
+    s_joints.gen[i]++;
+    s_joints.type[i] = JOINT_SLOT_FREE;
+    s_joints.freeIDs[++s_joints.freeTop] = static_cast<uint16_t>(i);
+  }
+  s_rowCount = 0;
+}
+
+PhysJointID PhysicsConstraints_AllocateID(void) {
+  if (s_joints.freeTop < 0) {
+    Log(LogLevel::Error, "[PHYSICS] Joint pool exhausted! No free slots.");
+    return PHYS_JOINT_INVALID;
+  }
+  const uint16_t index = s_joints.freeIDs[s_joints.freeTop--];
+  s_joints.type[index] = JOINT_SLOT_RESERVED;
+  return PhysJointID{.index = index, .gen = s_joints.gen[index]};
+}
+
+static bool PhysicsConstraints_IsHandleValid(PhysJointID joint) {
+  return joint.index < PHYS_MAX_JOINTS &&
+         s_joints.gen[joint.index] == joint.gen;
+}
+
+static void PhysicsConstraints_FreeSlot(uint16_t index) {
+  s_joints.gen[index]++;
+  s_joints.type[index] = JOINT_SLOT_FREE;
+  s_joints.freeIDs[++s_joints.freeTop] = index;
+}
+
+void PhysicsConstraints_ReleaseID(PhysJointID joint) {
+  if (!PhysicsConstraints_IsHandleValid(joint))
+    return;
+  if (s_joints.type[joint.index] != JOINT_SLOT_RESERVED)
+    return;
+  PhysicsConstraints_FreeSlot(joint.index);
+}
+
+// ============================================================================
+// Create / Destroy
+// ============================================================================
+
+static void PhysicsConstraints_RemoveDense(uint8_t type, uint32_t dense) {
+  JointPool &pool = s_joints.pools[type];
+  assert(dense < pool.count);
+
+  PhysicsConstraints_FreeSlot(pool.handle[dense]);
+
+  // Swap-remove, keep the moved joint's handle pointing at its new index.
+  const uint32_t last = --pool.count;
+  if (dense != last) {
+    pool.a[dense] = pool.a[last];
+    pool.b[dense] = pool.b[last];
+    pool.offsetA[dense] = pool.offsetA[last];
+    pool.offsetB[dense] = pool.offsetB[last];
+    pool.param[dense] = pool.param[last];
+    pool.handle[dense] = pool.handle[last];
+    s_joints.dense[pool.handle[dense]] = static_cast<uint16_t>(dense);
+  }
+}
+
+bool PhysicsConstraints_Create(const physicsPacket *packet, PhysJointID joint,
+                               uint8_t type, Entity a, Entity b,
+                               creVec2 anchor, float length) {
+  if (!PhysicsConstraints_IsHandleValid(joint) ||
+      s_joints.type[joint.index] != JOINT_SLOT_RESERVED)
+    return false;
+
+  const uint64_t *flags = packet->write.state_flags;
+  const uint32_t *generations = packet->read.generations;
+  const uint64_t *masks = packet->read.component_masks;
+  const creVec2 *pos = packet->write.pos;
+  const creVec2 *size = packet->read.size;
+
+  bool valid = type < PHYS_JOINT_TYPE_COUNT &&
+               EntityRegistry_IsAlive(flags, generations, a) &&
+               (masks[a.id] & COMP_PHYSICS);
+  const bool hasB = ENTITY_IS_VALID(b);
+  if (valid && hasB) {
+    valid = EntityRegistry_IsAlive(flags, generations, b) &&
+            (masks[b.id] & COMP_PHYSICS) && b.id != a.id;
+  }
+  if (valid && !hasB) {
+    valid = isfinite(anchor.x) && isfinite(anchor.y);
+  }
+  if (!valid) {
+    Log(LogLevel::Warning, "PhysicsConstraints_Create: invalid joint bodies");
+    PhysicsConstraints_FreeSlot(joint.index);
+    return false;
+  }
+
+  // Anchors are body centers
+  const creVec2 offsetA = size[a.id] * 0.5f;
+  const creVec2 offsetB = hasB ? size[b.id] * 0.5f : anchor;
+  const creVec2 anchorA = pos[a.id] + offsetA;
+  const creVec2 anchorB = hasB ? pos[b.id] + offsetB : anchor;
+  const creVec2 delta = anchorB - anchorA;
+
+  creVec2 param = {0.0f, 0.0f};
+  if (type == PHYS_JOINT_WELD) {
+    param = delta;
+  } else {
+    const float current = sqrtf(delta.x * delta.x + delta.y * delta.y);
+    param.x = (isfinite(length) && length > 0.0f) ? length : current;
+  }
+
+  JointPool &pool = s_joints.pools[type];
+  assert(pool.count < PHYS_MAX_JOINTS);
+  const uint32_t dense = pool.count++;
+  pool.a[dense] = a;
+  pool.b[dense] = hasB ? b : ENTITY_INVALID;
+  pool.offsetA[dense] = offsetA;
+  pool.offsetB[dense] = offsetB;
+  pool.param[dense] = param;
+  pool.handle[dense] = joint.index;
+
+  s_joints.type[joint.index] = type;
+  s_joints.dense[joint.index] = static_cast<uint16_t>(dense);
+  return true;
+}
+
+void PhysicsConstraints_Destroy(PhysJointID joint) {
+  if (!PhysicsConstraints_IsHandleValid(joint))
+    return;
+  const uint8_t type = s_joints.type[joint.index];
+  if (type == JOINT_SLOT_RESERVED) {
+    PhysicsConstraints_FreeSlot(joint.index);
+    return;
+  }
+  if (type >= PHYS_JOINT_TYPE_COUNT)
+    return;
+  PhysicsConstraints_RemoveDense(type, s_joints.dense[joint.index]);
+}
+
+uint32_t PhysicsConstraints_Count(void) {
+  uint32_t total = 0;
+  for (uint32_t t = 0; t < PHYS_JOINT_TYPE_COUNT; t++)
+    total += s_joints.pools[t].count;
+  return total;
+}
+
+uint32_t PhysicsConstraints_RowCount(void) { return s_rowCount; }
+
+// ============================================================================
+// Prepare (validate -> gather -> color -> rows)
+// ============================================================================
+
+static inline uint64_t SlotColors(uint32_t slot) {
+  if (slot == SOLVER_STATIC_SLOT || s_slotColorStamp[slot] != s_colorStamp)
+    return 0;
+  return s_slotColors[slot];
+}
+
+static inline void MarkSlotColor(uint32_t slot, uint64_t bit) {
+  if (slot == SOLVER_STATIC_SLOT)
+    return; // Infinite mass, never written
+  if (s_slotColorStamp[slot] != s_colorStamp) {
+    s_slotColorStamp[slot] = s_colorStamp;
+    s_slotColors[slot] = 0;
+  }
+  s_slotColors[slot] |= bit;
+}
+
+static void PhysicsConstraints_PrepareType(physicsPacket *packet,
+                                           uint8_t type) {
+  JointPool &pool = s_joints.pools[type];
+  JointRows &rows = s_rows[type];
+  rows.count = 0;
+  if (pool.count == 0)
+    return;
+
+  const creVec2 *pos = packet->write.pos;
+  const creVec2 *vel = packet->write.vel;
+  uint64_t *flags = packet->write.state_flags;
+  EntityCounters *counters = packet->write.counters;
+  const float *inv_mass = packet->write.inv_mass;
+  const uint32_t *generations = packet->read.generations;
+
+  s_colorStamp++;
+  if (s_colorStamp == 0) {
+    memset(s_slotColorStamp, 0, sizeof(s_slotColorStamp));
+    s_colorStamp = 1;
+  }
+
+  uint32_t colorCounts[JOINT_MAX_COLORS] = {};
+  uint32_t candidates = 0;
+
+  uint32_t j = 0;
+  while (j < pool.count) {
+    const Entity a = pool.a[j];
+    const Entity b = pool.b[j];
+    const bool hasB = ENTITY_IS_VALID(b);
+
+    // Drop joints whose bodies died (index is reused by the swapped joint)
+    if (!EntityRegistry_IsAlive(flags, generations, a) ||
+        (hasB && !EntityRegistry_IsAlive(flags, generations, b))) {
+      PhysicsConstraints_RemoveDense(type, j);
+      continue;
+    }
+
+    const uint64_t flagsA = flags[a.id];
+    const uint64_t flagsB = hasB ? flags[b.id] : FLAG_STATIC;
+    const float invMassA = (flagsA & FLAG_STATIC) ? 0.0f : inv_mass[a.id];
+    const float invMassB =
+        (hasB && !(flagsB & FLAG_STATIC)) ? inv_mass[b.id] : 0.0f;
+    const bool awakeA = invMassA > 0.0f && !(flagsA & FLAG_SLEEPING);
+    const bool awakeB = invMassB > 0.0f && !(flagsB & FLAG_SLEEPING);
+
+    // Both asleep (or immovable): nothing to solve
+    if ((!awakeA && !awakeB) || (invMassA + invMassB) <= 0.0001f) {
+      j++;
+      continue;
+    }
+
+    // One side awake wakes the other
+    EntityRegistry_ClearFlags(counters, &flags[a.id], FLAG_SLEEPING);
+    if (hasB)
+      EntityRegistry_ClearFlags(counters, &flags[b.id], FLAG_SLEEPING);
+
+    const uint32_t slotA = PhysicsSolver_GatherBody(a.id, pos, vel);
+    const uint32_t slotB =
+        hasB ? PhysicsSolver_GatherBody(b.id, pos, vel) : SOLVER_STATIC_SLOT;
+
+    // Greedy coloring: lowest color unused by both bodies
+    const uint64_t used = SlotColors(slotA) | SlotColors(slotB);
+    uint32_t color = JOINT_MAX_COLORS - 1;
+    if (~used != 0) {
+      color = static_cast<uint32_t>(std::countr_zero(~used));
+    }
+    const uint64_t bit = 1ULL << color;
+    MarkSlotColor(slotA, bit);
+    MarkSlotColor(slotB, bit);
+
+    s_candidate[candidates] = static_cast<uint16_t>(j);
+    s_candidateA[candidates] = slotA;
+    s_candidateB[candidates] = slotB;
+    s_candidateInvA[candidates] = invMassA;
+    s_candidateInvB[candidates] = invMassB;
+    s_candidateColor[candidates] = static_cast<uint8_t>(color);
+    colorCounts[color]++;
+    candidates++;
+    j++;
+  }
+
+  // Prefix sums -> color ranges
+  uint32_t offset = 0;
+  for (uint32_t c = 0; c < JOINT_MAX_COLORS; c++) {
+    rows.colorStart[c] = offset;
+    offset += colorCounts[c];
+  }
+  rows.colorStart[JOINT_MAX_COLORS] = offset;
+
+  uint32_t cursor[JOINT_MAX_COLORS];
+  memcpy(cursor, rows.colorStart, sizeof(cursor));
+  for (uint32_t n = 0; n < candidates; n++) {
+    const uint32_t r = cursor[s_candidateColor[n]]++;
+    const uint32_t dense = s_candidate[n];
+    const float invMassA = s_candidateInvA[n];
+    const float invMassB = s_candidateInvB[n];
+    rows.bodyA[r] = s_candidateA[n];
+    rows.bodyB[r] = s_candidateB[n];
+    rows.invMassA[r] = invMassA;
+    rows.invMassB[r] = invMassB;
+    rows.effMass[r] = 1.0f / (invMassA + invMassB);
+    rows.offsetA[r] = pool.offsetA[dense];
+    rows.offsetB[r] = pool.offsetB[dense];
+    rows.param[r] = pool.param[dense];
+  }
+  rows.count = candidates;
+}
+
+void PhysicsConstraints_Prepare(physicsPacket *packet) {
+  s_rowCount = 0;
+  for (uint8_t t = 0; t < PHYS_JOINT_TYPE_COUNT; t++) {
+    PhysicsConstraints_PrepareType(packet, t);
+    s_rowCount += s_rows[t].count;
+  }
+}
+
+// ============================================================================
+// Batched Solvers
+// ============================================================================
+
+/**
+ * @brief Distance (rigid) and rope (max length) rows.
+ *
+ * Position projection along the anchor axis, then removes the relative
+ * velocity along it. Ropes only act while taut and separating.
+ */
+static float SolveDistanceRows(const JointRows &rows, creVec2 *restrict pos,
+                               creVec2 *restrict vel, bool isRope) {
+  float maxCorrection = 0.0f;
+  for (uint32_t r = 0; r < rows.count; r++) {
+    const uint32_t idA = rows.bodyA[r];
+    const uint32_t idB = rows.bodyB[r];
+    const float invMassA = rows.invMassA[r];
+    const float invMassB = rows.invMassB[r];
+    const float effMass = rows.effMass[r];
+
+    const float dx = (pos[idB].x + rows.offsetB[r].x) -
+                     (pos[idA].x + rows.offsetA[r].x);
+    const float dy = (pos[idB].y + rows.offsetB[r].y) -
+                     (pos[idA].y + rows.offsetA[r].y);
+    const float lenSq = dx * dx + dy * dy;
+    if (lenSq < 0.00000001f)
+      continue;
+
+    const float len = sqrtf(lenSq);
+    const float error = len - rows.param[r].x;
+    if (isRope && error <= 0.0f)
+      continue; // Slack
+
+    const float invLen = 1.0f / len;
+    const float nx = dx * invLen;
+    const float ny = dy * invLen;
+
+    // Position correction (pull A towards B when stretched)
+    const float corr = error * PHYS_JOINT_CORRECTION_PERCENT * effMass;
+    maxCorrection =
+        fmaxf(maxCorrection, fabsf(error) * PHYS_JOINT_CORRECTION_PERCENT);
+    pos[idA].x += nx * corr * invMassA;
+    pos[idA].y += ny * corr * invMassA;
+    pos[idB].x -= nx * corr * invMassB;
+    pos[idB].y -= ny * corr * invMassB;
+
+    // Velocity: cancel relative motion along the axis
+    const float relVel =
+        (vel[idB].x - vel[idA].x) * nx + (vel[idB].y - vel[idA].y) * ny;
+    if (isRope && relVel <= 0.0f)
+      continue; // Approaching, rope does not push
+
+    const float lambda = relVel * effMass;
+    vel[idA].x += nx * lambda * invMassA;
+    vel[idA].y += ny * lambda * invMassA;
+    vel[idB].x -= nx * lambda * invMassB;
+    vel[idB].y -= ny * lambda * invMassB;
+  }
+  return maxCorrection;
+}
+
+/**
+ * @brief Weld rows: keep the anchor delta fixed on both axes.
+ */
+static float SolveWeldRows(const JointRows &rows, creVec2 *restrict pos,
+                           creVec2 *restrict vel) {
+  float maxCorrection = 0.0f;
+  for (uint32_t r = 0; r < rows.count; r++) {
+    const uint32_t idA = rows.bodyA[r];
+    const uint32_t idB = rows.bodyB[r];
+    const float invMassA = rows.invMassA[r];
+    const float invMassB = rows.invMassB[r];
+    const float effMass = rows.effMass[r];
+
+    const float errX = (pos[idB].x + rows.offsetB[r].x) -
+                       (pos[idA].x + rows.offsetA[r].x) - rows.param[r].x;
+    const float errY = (pos[idB].y + rows.offsetB[r].y) -
+                       (pos[idA].y + rows.offsetA[r].y) - rows.param[r].y;
+
+    const float corr = PHYS_JOINT_CORRECTION_PERCENT * effMass;
+    maxCorrection = fmaxf(maxCorrection, (fabsf(errX) + fabsf(errY)) *
+                                             PHYS_JOINT_CORRECTION_PERCENT);
+    pos[idA].x += errX * corr * invMassA;
+    pos[idA].y += errY * corr * invMassA;
+    pos[idB].x -= errX * corr * invMassB;
+    pos[idB].y -= errY * corr * invMassB;
+
+    const float relVelX = (vel[idB].x - vel[idA].x) * effMass;
+    const float relVelY = (vel[idB].y - vel[idA].y) * effMass;
+    vel[idA].x += relVelX * invMassA;
+    vel[idA].y += relVelY * invMassA;
+    vel[idB].x -= relVelX * invMassB;
+    vel[idB].y -= relVelY * invMassB;
+  }
+  return maxCorrection;
+}
+
+float PhysicsConstraints_Solve(creVec2 *pos, creVec2 *vel) {
+  if (s_rowCount == 0)
+    return 0.0f;
+  const float distance =
+      SolveDistanceRows(s_rows[PHYS_JOINT_DISTANCE], pos, vel, false);
+  const float rope = SolveDistanceRows(s_rows[PHYS_JOINT_ROPE], pos, vel, true);
+  const float weld = SolveWeldRows(s_rows[PHYS_JOINT_WELD], pos, vel);
+  return fmaxf(distance, fmaxf(rope, weld));
+}
+
+void PhysicsConstraints_GetSimState(SimStateBlock *out) {
+  *out = {
+      .name = "physics.joints", .base = &s_joints, .size = sizeof(s_joints)};
+}
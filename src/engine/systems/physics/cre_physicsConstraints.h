@@ -0,0 +1,99 @@
+/**
+ * @file cre_physicsConstraints.h
+ * @brief Joint Constraints (Distance, Rope, Weld)
+ *
+ * Joints live in one SoA pool per type and are addressed by generational
+ * PhysJointID handles. Handles are allocated synchronously by the API, the
+ * joint itself is created when CMD_PHYS_JOINT_CREATE is processed.
+ *
+ * Per sub-step, after contact detection, every joint is validated and turned
+ * into a solver row referencing the shared solver body slots
+ * (cre_physicsSolver.h). Rows are graph-colored and stored color by color:
+ * rows of one color never share a dynamic body, so a color range can be
+ * solved in parallel without changing results. Each type has its own
+ * batched solver, called from the same iteration loop as contacts.
+ *
+ * Anchors are body centers. A joint without a second body is anchored to a
+ * fixed world point (solver static slot).
+ */
+
+#ifndef CRE_PHYSICSCONSTRAINTS_H
+#define CRE_PHYSICSCONSTRAINTS_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+struct physicsPacket;
+struct SimStateBlock;
+
+/**
+ * @brief Reset pools and handle table. Called by PhysicsSystem_Init.
+ */
+void PhysicsConstraints_Init(void);
+
+/**
+ * @brief Destroy every joint and invalidate all handles (CMD_PHYS_RESET).
+ */
+void PhysicsConstraints_Clear(void);
+
+/**
+ * @brief Reserve a joint handle (synchronous, used by the API).
+ * @return Handle, or PHYS_JOINT_INVALID if the table is full
+ */
+PhysJointID PhysicsConstraints_AllocateID(void);
+
+/**
+ * @brief Return a reserved handle that never got a create command.
+ */
+void PhysicsConstraints_ReleaseID(PhysJointID joint);
+
+/**
+ * @brief Create a joint for a reserved handle (CMD_PHYS_JOINT_CREATE).
+ *
+ * @param type   PhysJointType
+ * @param b      Second body, ENTITY_INVALID = anchored to the world point
+ * @param anchor World anchor (only used without a second body)
+ * @param length Rest/max length, <= 0 = current anchor distance
+ * @return false if the handle or one of the bodies is invalid
+ */
+bool PhysicsConstraints_Create(const physicsPacket *packet, PhysJointID joint,
+                               uint8_t type, Entity a, Entity b,
+                               creVec2 anchor, float length);
+
+/**
+ * @brief Destroy a joint (CMD_PHYS_JOINT_DESTROY). Stale handles are ignored.
+ */
+void PhysicsConstraints_Destroy(PhysJointID joint);
+
+/**
+ * @brief Build solver rows for this sub-step.
+ *
+ * Drops joints whose bodies died, skips joints whose bodies are both asleep,
+ * wakes the other body of a joint if one side is awake, and gathers the
+ * bodies into the solver arrays. Call after contact detection.
+ */
+void PhysicsConstraints_Prepare(physicsPacket *packet);
+
+/**
+ * @brief One solver iteration over every joint row, type by type.
+ * @return Largest position correction applied (px), for the early-out
+ */
+float PhysicsConstraints_Solve(creVec2 *pos, creVec2 *vel);
+
+/**
+ * @brief Number of live joints (all types).
+ */
+uint32_t PhysicsConstraints_Count(void);
+
+/**
+ * @brief Number of joint rows solved in the last sub-step.
+ */
+uint32_t PhysicsConstraints_RowCount(void);
+
+/**
+ * @brief Joint pools + handle table, for rollback (see cre_simState.h).
+ */
+void PhysicsConstraints_GetSimState(SimStateBlock *out);
+
+#endif
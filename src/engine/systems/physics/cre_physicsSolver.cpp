@@ -0,0 +1,84 @@
+#include "cre_physicsSolver.h"
+#include "engine/core/cre_config.h"
+#include <assert.h>
+#include <string.h>
+
+#define MAX_SOLVER_BODIES (MAX_ENTITIES + 1)
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+struct SolverBodies {
+  alignas(64) uint32_t entity[MAX_SOLVER_BODIES]; // Registry index per slot
+  alignas(64) creVec2 pos[MAX_SOLVER_BODIES];
+  alignas(64) creVec2 vel[MAX_SOLVER_BODIES];
+};
+
+static SolverBodies s_bodies;
+static uint32_t s_bodyCount = 1;
+
+// Entity -> solver slot map, validated by stamp (no clearing per sub-step)
+static uint32_t s_slotOf[MAX_ENTITIES];
+static uint32_t s_slotStamp[MAX_ENTITIES];
+// Registry cache lines (pos) covered by gathered bodies, for stats
+static uint32_t s_lineStamp[(MAX_ENTITIES * sizeof(creVec2) + 63) / 64];
+static uint32_t s_stamp = 0;
+static uint32_t s_registryLines = 0;
+
+void PhysicsSolver_BeginGather(void) {
+  s_bodyCount = 1; // Slot 0 = static body
+  s_registryLines = 0;
+  s_bodies.entity[SOLVER_STATIC_SLOT] = ENTITY_INVALID.id;
+  s_bodies.pos[SOLVER_STATIC_SLOT] = creVec2{0.0f, 0.0f};
+  s_bodies.vel[SOLVER_STATIC_SLOT] = creVec2{0.0f, 0.0f};
+
+  s_stamp++;
+  if (s_stamp == 0) {
+    // Wrapped: invalidate every stamp once
+    memset(s_slotStamp, 0, sizeof(s_slotStamp));
+    memset(s_lineStamp, 0, sizeof(s_lineStamp));
+    s_stamp = 1;
+  }
+}
+
+uint32_t PhysicsSolver_GatherBody(uint32_t id, const creVec2 *pos,
+                                  const creVec2 *vel) {
+  assert(id < MAX_ENTITIES);
+  if (s_slotStamp[id] == s_stamp)
+    return s_slotOf[id];
+
+  const uint32_t slot = s_bodyCount++;
+  s_slotStamp[id] = s_stamp;
+  s_slotOf[id] = slot;
+  s_bodies.entity[slot] = id;
+  s_bodies.pos[slot] = pos[id];
+  s_bodies.vel[slot] = vel[id];
+
+  const uint32_t line = static_cast<uint32_t>((id * sizeof(creVec2)) / 64);
+  if (s_lineStamp[line] != s_stamp) {
+    s_lineStamp[line] = s_stamp;
+    s_registryLines++;
+  }
+  return slot;
+}
+
+creVec2 *PhysicsSolver_Positions(void) { return s_bodies.pos; }
+
+creVec2 *PhysicsSolver_Velocities(void) { return s_bodies.vel; }
+
+uint32_t PhysicsSolver_BodyCount(void) { return s_bodyCount; }
+
+uint32_t PhysicsSolver_RegistryLines(void) { return s_registryLines; }
+
+void PhysicsSolver_Scatter(creVec2 *pos, creVec2 *vel) {
+  const uint32_t *restrict const entity = s_bodies.entity;
+  const creVec2 *restrict const bodyPos = s_bodies.pos;
+  const creVec2 *restrict const bodyVel = s_bodies.vel;
+
+  for (uint32_t slot = 1; slot < s_bodyCount; slot++) {
+    const uint32_t id = entity[slot];
+    pos[id] = bodyPos[slot];
+    vel[id] = bodyVel[slot];
+  }
+}
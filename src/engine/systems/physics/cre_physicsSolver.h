@@ -0,0 +1,51 @@
+/**
+ * @file cre_physicsSolver.h
+ * @brief Solver-Local Body Arrays (Gather -> Solve -> Scatter)
+ *
+ * Every body referenced by a contact or joint row in the current sub-step is
+ * copied into compact pos/vel arrays. All solver iterations run on those
+ * arrays; the result is scattered back to the registry once per sub-step.
+ *
+ * Slot 0 is the shared static body (zero position/velocity, infinite mass).
+ * Rows that reference it must carry invMass = 0 for that side.
+ */
+
+#ifndef CRE_PHYSICSSOLVER_H
+#define CRE_PHYSICSSOLVER_H
+
+#include "engine/core/cre_types.h"
+#include <stdint.h>
+
+constexpr uint32_t SOLVER_STATIC_SLOT = 0;
+
+/**
+ * @brief Drop every gathered body. Call once per sub-step before detection.
+ */
+void PhysicsSolver_BeginGather(void);
+
+/**
+ * @brief Map a registry body to its solver slot, copying it on first use.
+ * @return Solver-local slot (stable until the next BeginGather)
+ */
+uint32_t PhysicsSolver_GatherBody(uint32_t id, const creVec2 *pos,
+                                  const creVec2 *vel);
+
+creVec2 *PhysicsSolver_Positions(void);
+creVec2 *PhysicsSolver_Velocities(void);
+
+/**
+ * @brief Number of used slots, including the static slot.
+ */
+uint32_t PhysicsSolver_BodyCount(void);
+
+/**
+ * @brief Registry pos cache lines spanned by the gathered bodies (stats).
+ */
+uint32_t PhysicsSolver_RegistryLines(void);
+
+/**
+ * @brief Write every gathered body (except slot 0) back to the registry.
+ */
+void PhysicsSolver_Scatter(creVec2 *pos, creVec2 *vel);
+
+#endif
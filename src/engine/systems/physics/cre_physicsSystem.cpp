@@ -8,21 +8,27 @@
  * Design Principles:
  *   - SIMD-safe loops (separate operations, no aliasing)
  *   - Cache-friendly iteration via max_used_bound
- *   - Configurable sub-stepping and solver iterations
+ *   - Adaptive sub-stepping, solver iterations stop once converged
  *   - Material-based collision response (friction, restitution)
  */
 #include "cre_physicsSystem.h"
+#include "cre_physicsConstraints.h"
+#include "cre_physicsSolver.h"
 #include "cre_physics_defs.h"
 #include "cre_spatialHash.h"
+#include "cre_staticGeometry.h"
 #include "engine/core/cre_commandBus.h"
 #include "engine/core/cre_config.h"
 #include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
 #include "engine/core/cre_systemPackets.h"
 #include "engine/core/cre_types.h"
 #include "engine/ecs/cre_entityRegistry.h"
+#include "engine/platform/cre_sys.h"
 #include <assert.h>
 #include <cstdint>
 #include <math.h>
+#include <string.h>
 
 // ============================================================================
 // Clamp coordinates to safe numbers
@@ -109,23 +115,45 @@ PhysicsSystem_ValidatePhysicsTarget(const uint64_t *state_flags,
 // Static Configuration
 // ============================================================================
 
-/** Global gravity vector */
-static float g_gravity_x = PHYS_GRAVITY_DEF_X;
-static float g_gravity_y = PHYS_GRAVITY_DEF_Y;
-
 /**
- * Material lookup table.
- * Index by reg.material_id[entity] to get friction/restitution.
+ * @brief Persistent world configuration (gravity + materials).
+ *
+ * Grouped so rollback saves it as one simulation state block; everything
+ * else in this file is rebuilt every step.
  */
-static PhysMaterial g_materials[PHYS_MAX_MATERIALS] = {
-    {.density = 2.0f, .friction = 0.5f, .restitution = 0.2f},  // MAT_DEFAULT
-    {.density = 0.0f, .friction = 0.5f, .restitution = 0.0f},  // static
-    {.density = 1.0f, .friction = 0.3f, .restitution = 0.9f},  // bouncy
-    {.density = 1.0f, .friction = 0.05f, .restitution = 0.0f}, // ice
-    {.density = 1.0f, .friction = 0.5f, .restitution = 0.2f},  // player
-    // Remaining slots zero-initialized
+struct PhysicsWorldState {
+  float gravityX;
+  float gravityY;
+  /** Indexed by reg.material_id[entity] for friction/restitution. */
+  PhysMaterial materials[PHYS_MAX_MATERIALS];
+  /**
+   * Material pair table, built from materials at init.
+   * Resolved once per contact at detection time, never inside the solver.
+   */
+  PhysMaterialPair materialPairs[PHYS_MAX_MATERIALS][PHYS_MAX_MATERIALS];
 };
 
+static PhysicsWorldState g_world = {
+    .gravityX = PHYS_GRAVITY_DEF_X,
+    .gravityY = PHYS_GRAVITY_DEF_Y,
+    .materials = {
+        {.density = 2.0f, .friction = 0.5f, .restitution = 0.2f},  // default
+        {.density = 0.0f, .friction = 0.5f, .restitution = 0.0f},  // static
+        {.density = 1.0f, .friction = 0.3f, .restitution = 0.9f},  // bouncy
+        {.density = 1.0f, .friction = 0.05f, .restitution = 0.0f}, // ice
+        {.density = 1.0f, .friction = 0.5f, .restitution = 0.2f},  // player
+        // Remaining slots zero-initialized
+    },
+    .materialPairs = {},
+};
+
+/**
+ * Packed collision filter per dynamic body: layer (low 16) | mask (high 16).
+ * Written by the broad phase for every body it inserts, so narrow phase
+ * candidates (which all come from the dynamic layer) need one load.
+ */
+static uint32_t g_bodyFilter[MAX_ENTITIES];
+
 // ============================================================================
 // Forward Declarations (Internal Helpers)
 // ============================================================================
@@ -138,7 +166,8 @@ static void PhysicsSystem_LoadStaticGeometry(uint32_t bound,
                                              const float *p_inv_mass);
 static void ConfigureBody(const uint64_t *component_masks, const creVec2 *size,
                           float *inv_mass, uint64_t *state_flags,
-                          uint8_t *material_id, float *drag_values,
+                          EntityCounters *counters, uint8_t *material_id,
+                          float *drag_values,
                           float *gravity_scale, uint32_t id, uint8_t mat_id,
                           float drag, bool is_static);
 static void PhysicsSystem_RecalculateMass(uint64_t *state_flags,
@@ -146,10 +175,12 @@ static void PhysicsSystem_RecalculateMass(uint64_t *state_flags,
                                           const creVec2 *size,
                                           float *inv_mass,
                                           uint8_t *material_id, uint32_t id);
+static void PhysicsSystem_BuildMaterialPairs(void);
 static void Phase1_Integration(physicsPacket *packet);
 static void Phase2_BroadPhase(physicsPacket *packet);
 static void Phase3_DetectContacts(physicsPacket *packet);
-static void Phase3_ResolveContacts(physicsPacket *packet);
+static float Phase3_ResolveContacts(void);
+static void Phase3_ScatterBodies(physicsPacket *packet);
 
 // Collision detection helpers (return true if colliding)
 static bool CheckCircle_Circle(float ax, float ay, float radiusA, float bx,
@@ -164,33 +195,104 @@ static bool CheckCircle_AABB(float cx, float cy, float radius, float bx,
                              float by, float bw, float bh, float *out_overlap,
                              creVec2 *out_normal);
 
-// Collision response
-static void ResolveCollision(creVec2 *pos, creVec2 *vel, uint64_t *state_flags,
-                             float *inv_mass, uint8_t *material_id,
-                             uint32_t idA, uint32_t idB, float overlap,
-                             creVec2 normal);
+static bool CheckAABB_StaticEdges(float ax, float ay, float aw, float ah,
+                                  const StaticCollider *b, float *out_overlap,
+                                  creVec2 *out_normal);
+
+// Collision response (operates on solver-local rows/bodies)
+static float ResolveCollision(creVec2 *restrict pos, creVec2 *restrict vel,
+                              uint32_t row);
+
+#if CRE_DETERMINISTIC
+/**
+ * @brief Sort query results by id (insertion sort, counts are small).
+ *
+ * Hash chains and grid cells return candidates in cell-walk order, which
+ * changes as bodies cross cells. Sorting makes contact order a pure function
+ * of the entity set, so rebuilt or rolled-back states solve identically.
+ */
+static inline void SortNeighbours(uint32_t *restrict ids, int count) {
+  for (int i = 1; i < count; i++) {
+    const uint32_t key = ids[i];
+    int j = i - 1;
+    while (j >= 0 && ids[j] > key) {
+      ids[j + 1] = ids[j];
+      j--;
+    }
+    ids[j + 1] = key;
+  }
+}
+#endif
 
 // ============================================================================
-// #3 Optimization: Contact Stream (Cache-Friendly Collision Resolution)
+// #3 Optimization: Contact Rows (Cache-Friendly Collision Resolution)
 // ============================================================================
 // Instead of detecting + resolving interleaved (cache misses on each pair),
-// collect all contact pairs first, then resolve in a sequential pass.
+// collect all contacts first, then resolve in a sequential pass.
+//
+// Contacts are stored as SoA rows that reference solver-local body slots.
+// Bodies touched by contacts are gathered into compact pos/vel arrays once
+// per sub-step, every solver iteration works on those, and the result is
+// scattered back to the registry after the last iteration. Slot 0 is the
+// shared static body (zero velocity, infinite mass).
 
 #define MAX_CONTACTS 65536
 
 /**
- * @brief Contact pair for deferred resolution.
+ * @brief Contact constraint rows (SoA).
+ *
+ * Everything the solver needs besides pos/vel is resolved at detection time,
+ * so the iteration loop never touches inv_mass, material_id or materials.
+ */
+struct ContactRows {
+  alignas(64) uint32_t bodyA[MAX_CONTACTS]; // Solver-local slot
+  alignas(64) uint32_t bodyB[MAX_CONTACTS]; // Solver-local slot
+  alignas(64) float overlap[MAX_CONTACTS];
+  alignas(64) float normalX[MAX_CONTACTS];
+  alignas(64) float normalY[MAX_CONTACTS];
+  alignas(64) float invMassA[MAX_CONTACTS];
+  alignas(64) float invMassB[MAX_CONTACTS];
+  alignas(64) float effMass[MAX_CONTACTS]; // 1 / (invMassA + invMassB)
+  alignas(64) float mu[MAX_CONTACTS];      // Combined friction
+  alignas(64) float e[MAX_CONTACTS];       // Combined restitution
+};
+
+static ContactRows s_rows;
+static uint32_t contactCount = 0;
+
+static PhysicsSolverStats s_solverStats = {};
+static PhysicsStepStats s_stepStats = {};
+static bool s_warnedTruncation = false;
+static double s_timeBudgetSec =
+    static_cast<double>(PHYS_TIME_BUDGET_MS) / 1000.0;
+
+/**
+ * @brief Append a contact row. idB may be a compiled static collider owner;
+ * pass bIsStatic so it maps to the shared static slot.
  */
-typedef struct {
-  uint32_t idA;
-  uint32_t idB;
-  float overlap;
-  float normalX;
-  float normalY;
-} ContactPair;
+static inline void PushContact(uint32_t idA, uint32_t idB, bool bIsStatic,
+                               float overlap, creVec2 normal, float invMassA,
+                               float invMassB, uint8_t matA, uint8_t matB,
+                               const creVec2 *pos, const creVec2 *vel) {
+  const float invMassSum = invMassA + invMassB;
+  // Both static = no response needed
+  if (invMassSum <= 0.0001f || contactCount >= MAX_CONTACTS)
+    return;
 
-static ContactPair contactStream[MAX_CONTACTS];
-static int contactCount = 0;
+  const PhysMaterialPair &pair = g_world.materialPairs[matA][matB];
+  const uint32_t row = contactCount++;
+  s_rows.bodyA[row] = PhysicsSolver_GatherBody(idA, pos, vel);
+  s_rows.bodyB[row] =
+      bIsStatic ? SOLVER_STATIC_SLOT : PhysicsSolver_GatherBody(idB, pos, vel);
+  s_rows.overlap[row] = overlap;
+  s_rows.normalX[row] = normal.x;
+  s_rows.normalY[row] = normal.y;
+  s_rows.invMassA[row] = invMassA;
+  s_rows.invMassB[row] = invMassB;
+  s_rows.effMass[row] = 1.0f / invMassSum;
+  s_rows.mu[row] = pair.friction;
+  s_rows.e[row] = pair.restitution;
+}
 
 // ============================================================================
 // Public API Implementation
@@ -211,37 +313,139 @@ physicsPacket CreatePhysicsPacket(EntityRegistry *reg, CommandBus *bus,
                                  .inv_mass = reg->inv_mass,
                                  .drag = reg->drag,
                                  .gravity_scale = reg->gravity_scale,
-                                 .material_id = reg->material_id}};
+                                 .material_id = reg->material_id,
+                                 .counters = &reg->counters}};
   return pkt;
 }
 
 void PhysicsSystem_Init(void) {
-  // Clear all spatial hash layers
+  // Clear all spatial hash layers and compiled static colliders
   SpatialHash_ClearAll();
+  StaticGeometry_Clear();
+  PhysicsConstraints_Init();
 
   // Reset gravity to defaults
-  g_gravity_x = PHYS_GRAVITY_DEF_X;
-  g_gravity_y = PHYS_GRAVITY_DEF_Y;
+  g_world.gravityX = PHYS_GRAVITY_DEF_X;
+  g_world.gravityY = PHYS_GRAVITY_DEF_Y;
+
+  PhysicsSystem_BuildMaterialPairs();
 
   Log(LogLevel::Info,
-      "Physics System Initialized (SubSteps={}, SolverIters={})",
-      PHYS_SUB_STEPS, PHYS_SOLVER_ITERATIONS);
+      "Physics System Initialized (SubSteps={}-{}, SolverIters={}-{}, "
+      "Budget={} ms)",
+      PHYS_MIN_SUB_STEPS, PHYS_MAX_SUB_STEPS, PHYS_MIN_SOLVER_ITERATIONS,
+      PHYS_SOLVER_ITERATIONS, s_timeBudgetSec * 1000.0);
+}
+
+PhysicsSolverStats PhysicsSystem_GetSolverStats(void) {
+  return s_solverStats;
+}
+
+PhysicsStepStats PhysicsSystem_GetStepStats(void) { return s_stepStats; }
+
+void PhysicsSystem_SetTimeBudget(float ms) {
+  s_timeBudgetSec =
+      (isfinite(ms) && ms > 0.0f) ? static_cast<double>(ms) / 1000.0 : 0.0;
+}
+
+void PhysicsSystem_GetSimState(SimStateBlock *out) {
+  *out = {.name = "physics.world", .base = &g_world, .size = sizeof(g_world)};
+}
+
+void PhysicsSystem_SetMaterialPair(uint8_t matA, uint8_t matB, float friction,
+                                   float restitution) {
+  const float mu = isfinite(friction) ? fmaxf(0.0f, friction) : 0.0f;
+  const float e =
+      isfinite(restitution) ? fmaxf(0.0f, fminf(1.0f, restitution)) : 0.0f;
+  g_world.materialPairs[matA][matB] = PhysMaterialPair{mu, e};
+  g_world.materialPairs[matB][matA] = PhysMaterialPair{mu, e};
+}
+
+static void PhysicsSystem_BuildMaterialPairs(void) {
+  for (uint32_t a = 0; a < PHYS_MAX_MATERIALS; a++) {
+    for (uint32_t b = 0; b < PHYS_MAX_MATERIALS; b++) {
+      // Mix: multiply for friction, max for restitution
+      g_world.materialPairs[a][b].friction =
+          g_world.materials[a].friction * g_world.materials[b].friction;
+      g_world.materialPairs[a][b].restitution =
+          fmaxf(g_world.materials[a].restitution,
+                g_world.materials[b].restitution);
+    }
+  }
+}
+
+/**
+ * @brief Pick the sub-step count so no awake body travels more than
+ * PHYS_SUB_STEP_TRAVEL of the smallest collider per sub-step.
+ *
+ * Speeds are read after command processing (impulses included); gravity
+ * added during the frame is not predicted.
+ */
+static int ChooseSubSteps(const physicsPacket *packet) {
+  const uint32_t bound = packet->max_used_bound;
+  const creVec2 *restrict const vel = packet->write.vel;
+  const creVec2 *restrict const size = packet->read.size;
+  const uint64_t *restrict const comps = packet->read.component_masks;
+  const uint64_t *restrict const flags = packet->write.state_flags;
+
+  float maxSpeedSq = 0.0f;
+  float minSize = PHYS_SIZE_MAX;
+  for (uint32_t i = 0; i < bound; i++) {
+    if (!(flags[i] & FLAG_ACTIVE) || !(comps[i] & COMP_PHYSICS))
+      continue;
+    minSize = fminf(minSize, fminf(size[i].x, size[i].y));
+    if (flags[i] & (FLAG_STATIC | FLAG_SLEEPING))
+      continue;
+    maxSpeedSq =
+        fmaxf(maxSpeedSq, vel[i].x * vel[i].x + vel[i].y * vel[i].y);
+  }
+
+  const float maxSpeed = sqrtf(maxSpeedSq);
+  minSize = fmaxf(minSize, 1.0f);
+  s_stepStats.maxSpeed = maxSpeed;
+  s_stepStats.minSize = minSize;
+
+  // Finite by construction: speeds are clamped to PHYS_VEL_MAX
+  const float travel = maxSpeed * packet->fixedDt;
+  const int steps =
+      static_cast<int>(ceilf(travel / (minSize * PHYS_SUB_STEP_TRAVEL)));
+  return (steps < PHYS_MIN_SUB_STEPS)   ? PHYS_MIN_SUB_STEPS
+         : (steps > PHYS_MAX_SUB_STEPS) ? PHYS_MAX_SUB_STEPS
+                                        : steps;
 }
 
 void PhysicsSystem_Update(physicsPacket *packet) {
+  const double start = Platform_GetTime();
+
   // -------------------------------------------------------------------------
   // Phase 0: Process Commands (runs once per frame, outside sub-step loop)
   // -------------------------------------------------------------------------
   PhysicsSystem_ProcessCommands(packet);
 
-  const float subDt = packet->fixedDt / static_cast<float>(PHYS_SUB_STEPS);
+  int subSteps = ChooseSubSteps(packet);
   physicsPacket stepPacket = *packet;
-  stepPacket.fixedDt = subDt;
+  stepPacket.fixedDt = packet->fixedDt / static_cast<float>(subSteps);
+
+  s_stepStats.subSteps = 0;
+  s_stepStats.iterations = 0;
+  s_stepStats.budgetCuts = 0;
+  s_stepStats.residual = 0.0f;
 
   // -------------------------------------------------------------------------
   // Sub-Step Loop
   // -------------------------------------------------------------------------
-  for (int step = 0; step < PHYS_SUB_STEPS; step++) {
+  int maxIterations = PHYS_SOLVER_ITERATIONS;
+  for (int step = 0; step < subSteps; step++) {
+    // Over budget: simulate whatever time is left in one cheap step
+    if (s_timeBudgetSec > 0.0 && step > 0 && step + 1 < subSteps &&
+        Platform_GetTime() - start > s_timeBudgetSec) {
+      const int remaining = subSteps - step;
+      stepPacket.fixedDt *= static_cast<float>(remaining);
+      s_stepStats.budgetCuts += static_cast<uint32_t>(remaining - 1);
+      subSteps = step + 1;
+      maxIterations = PHYS_MIN_SOLVER_ITERATIONS;
+    }
+
     // Phase 1: Integration (gravity, drag, movement)
     Phase1_Integration(&stepPacket);
 
@@ -249,11 +453,26 @@ void PhysicsSystem_Update(physicsPacket *packet) {
     Phase2_BroadPhase(&stepPacket);
 
     Phase3_DetectContacts(&stepPacket); // Build contact stream.
+    PhysicsConstraints_Prepare(&stepPacket); // Build joint rows.
     // Phase 3: Collision Solver (split for cache efficiency)
-    // Multiple iterations for stability
-    for (int iter = 0; iter < PHYS_SOLVER_ITERATIONS; iter++) {
-      Phase3_ResolveContacts(&stepPacket); // Resolve all contacts sequentially
+    // Iterate until no row moves a body by more than the tolerance
+    float residual = 0.0f;
+    int iter = 0;
+    while (iter < maxIterations) {
+      const float contacts = Phase3_ResolveContacts();
+      const float joints = PhysicsConstraints_Solve(
+          PhysicsSolver_Positions(), PhysicsSolver_Velocities());
+      residual = fmaxf(contacts, joints);
+      iter++;
+      if (iter >= PHYS_MIN_SOLVER_ITERATIONS &&
+          residual < PHYS_SOLVER_TOLERANCE)
+        break;
     }
+    Phase3_ScatterBodies(&stepPacket); // Write solved bodies back once
+
+    s_stepStats.subSteps++;
+    s_stepStats.iterations += static_cast<uint32_t>(iter);
+    s_stepStats.residual = residual;
   }
 }
 
@@ -266,11 +485,15 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
   creVec2 *restrict const pos = packet->write.pos;
   creVec2 *restrict const vel = packet->write.vel;
   uint64_t *restrict const state_flags = packet->write.state_flags;
+  EntityCounters *const counters = packet->write.counters;
   float *restrict const inv_mass = packet->write.inv_mass;
   float *restrict const drag = packet->write.drag;
   float *restrict const gravity_scale = packet->write.gravity_scale;
   uint8_t *restrict const material_id = packet->write.material_id;
 
+  // Static colliders are recompiled once after the whole batch.
+  bool staticDirty = false;
+
   CommandIterator iter = CommandBus_GetIterator(bus);
   const Command *cmd;
 
@@ -290,8 +513,9 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
       const uint8_t mat_id =
           PhysicsSystem_SanitizeMaterialID(cmd->physDef.material_id);
       const float dDrag = PhysicsSystem_SanitizeDrag(cmd->physDef.drag, drag[id]);
-      ConfigureBody(component_masks, size, inv_mass, state_flags, material_id,
-                    drag, gravity_scale, id, mat_id, dDrag, isStatic);
+      ConfigureBody(component_masks, size, inv_mass, state_flags, counters,
+                    material_id, drag, gravity_scale, id, mat_id, dDrag,
+                    isStatic);
       break;
     }
 
@@ -317,12 +541,13 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
 
       pos[id] = creVec2{newX, newY};
       vel[id] = creVec2{0.0f, 0.0f};
-      state_flags[id] &= ~FLAG_SLEEPING;
+      EntityRegistry_ClearFlags(counters, &state_flags[id], FLAG_SLEEPING);
 
       if (state_flags[id] & FLAG_STATIC) {
         SpatialHash_AddStatic(id, static_cast<int>(newX),
                               static_cast<int>(newY), static_cast<int>(width),
                               static_cast<int>(height));
+        staticDirty = true;
       }
       break;
     }
@@ -338,7 +563,7 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
       const float vy =
           PhysicsSystem_SanitizeVelocity(cmd->vec2.value.y, vel[id].y);
       vel[id] = creVec2{vx, vy};
-      state_flags[id] &= ~FLAG_SLEEPING;
+      EntityRegistry_ClearFlags(counters, &state_flags[id], FLAG_SLEEPING);
       break;
     }
 
@@ -354,7 +579,7 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
       const float jy = PhysicsSystem_SanitizeImpulse(cmd->vec2.value.y);
       vel[id].x += jx * inv_mass[id];
       vel[id].y += jy * inv_mass[id];
-      state_flags[id] &= ~FLAG_SLEEPING;
+      EntityRegistry_ClearFlags(counters, &state_flags[id], FLAG_SLEEPING);
       break;
     }
 
@@ -390,10 +615,10 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
     }
 
     case CMD_PHYS_SET_GRAVITY: {
-      g_gravity_x =
-          PhysicsSystem_SanitizeGravity(cmd->vec2.value.x, g_gravity_x);
-      g_gravity_y =
-          PhysicsSystem_SanitizeGravity(cmd->vec2.value.y, g_gravity_y);
+      g_world.gravityX =
+          PhysicsSystem_SanitizeGravity(cmd->vec2.value.x, g_world.gravityX);
+      g_world.gravityY =
+          PhysicsSystem_SanitizeGravity(cmd->vec2.value.y, g_world.gravityY);
       break;
     }
 
@@ -401,12 +626,29 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
       SpatialHash_ClearAll();
       PhysicsSystem_LoadStaticGeometry(max_used_bound, pos, size, state_flags,
                                        component_masks, inv_mass);
+      staticDirty = true;
+      break;
+    }
+
+    case CMD_PHYS_JOINT_CREATE: {
+      PhysicsConstraints_Create(packet, cmd->physJoint.joint,
+                                cmd->physJoint.type, entity,
+                                cmd->physJoint.other, cmd->physJoint.anchor,
+                                cmd->physJoint.length);
+      break;
+    }
+
+    case CMD_PHYS_JOINT_DESTROY: {
+      PhysicsConstraints_Destroy(cmd->physJoint.joint);
       break;
     }
 
     case CMD_PHYS_RESET: {
       // Clear all spatial hashes (e.g., on scene unload)
       SpatialHash_ClearAll();
+      StaticGeometry_Clear();
+      PhysicsConstraints_Clear();
+      staticDirty = false;
       break;
     }
 
@@ -415,6 +657,10 @@ void PhysicsSystem_ProcessCommands(physicsPacket *packet) {
       break;
     }
   }
+
+  if (staticDirty) {
+    StaticGeometry_Build(packet);
+  }
 }
 
 static void PhysicsSystem_LoadStaticGeometry(uint32_t bound,
@@ -475,7 +721,8 @@ static void PhysicsSystem_LoadStaticGeometry(uint32_t bound,
  */
 static void ConfigureBody(const uint64_t *component_masks, const creVec2 *size,
                           float *inv_mass, uint64_t *state_flags,
-                          uint8_t *material_id, float *drag_values,
+                          EntityCounters *counters, uint8_t *material_id,
+                          float *drag_values,
                           float *gravity_scale, uint32_t id, uint8_t mat_id,
                           float drag, bool is_static) {
   // Bounds check: prevent OOB array access
@@ -485,7 +732,7 @@ static void ConfigureBody(const uint64_t *component_masks, const creVec2 *size,
     return;
   }
 
-  const float density = g_materials[mat_id].density;
+  const float density = g_world.materials[mat_id].density;
   const uint64_t comps = component_masks[id];
 
   // Calculate area based on collision shape
@@ -502,12 +749,12 @@ static void ConfigureBody(const uint64_t *component_masks, const creVec2 *size,
   // Configure mass and static flag
   if (is_static) {
     inv_mass[id] = 0.0f; // Infinite mass
-    state_flags[id] |= FLAG_STATIC;
+    EntityRegistry_SetFlags(counters, &state_flags[id], FLAG_STATIC);
   } else {
     const float mass = area * density;
     // default mass = 1.0f
     inv_mass[id] = (mass > 0.0001f) ? (1.0f / mass) : 1.0f;
-    state_flags[id] &= ~FLAG_STATIC;
+    EntityRegistry_ClearFlags(counters, &state_flags[id], FLAG_STATIC);
   }
 
   // Store material ID and drag for solver
@@ -531,7 +778,7 @@ static void PhysicsSystem_RecalculateMass(uint64_t *state_flags,
   const uint8_t safeMat = PhysicsSystem_SanitizeMaterialID(material_id[id]);
   material_id[id] = safeMat;
 
-  float density = g_materials[safeMat].density;
+  float density = g_world.materials[safeMat].density;
   if (!isfinite(density) || density < 0.00001f)
     density = 0.0f;
 
@@ -578,6 +825,7 @@ static void Phase1_Integration(physicsPacket *packet) {
   const float *restrict const drag = packet->write.drag;
   const uint64_t *restrict const comps = packet->read.component_masks;
   uint64_t *restrict const flags = packet->write.state_flags;
+  EntityCounters *const counters = packet->write.counters;
 
   // Required component mask for physics processing
   const uint64_t reqComps = COMP_PHYSICS;
@@ -596,8 +844,8 @@ static void Phase1_Integration(physicsPacket *packet) {
       continue;
 
     // Gravity
-    vel[i].x += g_gravity_x * gravity_scale[i] * dt;
-    vel[i].x += g_gravity_y * gravity_scale[i] * dt;
+    vel[i].x += g_world.gravityX * gravity_scale[i] * dt;
+    vel[i].y += g_world.gravityY * gravity_scale[i] * dt;
 
     // Apply Drag (clamped to prevent sign flip)
     const float dragFactor = 1.0f - (drag[i] * dt);
@@ -613,7 +861,7 @@ static void Phase1_Integration(physicsPacket *packet) {
     bool isSlow = (speedSq < sleepThresholdSq);
     bool canSleep = !(flags[i] & FLAG_ALWAYS_AWAKE);
     if (isSlow && canSleep) {
-      flags[i] |= FLAG_SLEEPING;
+      EntityRegistry_SetFlags(counters, &flags[i], FLAG_SLEEPING);
     }
   }
 }
@@ -661,6 +909,9 @@ static void Phase2_BroadPhase(physicsPacket *packet) {
     SpatialHash_AddDynamic(
         i, static_cast<int>(clampedX), static_cast<int>(clampedY),
         static_cast<int>(clampedW), static_cast<int>(clampedH));
+
+    g_bodyFilter[i] = static_cast<uint32_t>(GET_LAYER(flags)) |
+                      (static_cast<uint32_t>(GET_MASK(flags)) << 16);
   }
 }
 
@@ -674,7 +925,8 @@ static void Phase2_BroadPhase(physicsPacket *packet) {
  * For each dynamic entity:
  *   1. Query spatial hash for nearby entities
  *   2. Dispatch to appropriate collision check (Circle/AABB)
- *   3. Store contact pair (no resolution yet)
+ *   3. Store contact pair with resolved inverse masses and material
+ *      coefficients (no resolution yet), and wake both bodies
  *
  * Duplicate prevention: For dynamic-dynamic pairs, only process if idA < idB.
  *
@@ -691,10 +943,18 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
   const creVec2 *restrict const p_size = packet->read.size;
   float *restrict const p_inv_mass = packet->write.inv_mass;
   uint64_t *restrict const p_flags = packet->write.state_flags;
+  EntityCounters *const counters = packet->write.counters;
   const uint64_t *restrict const p_comps = packet->read.component_masks;
+  const uint8_t *restrict const p_material = packet->write.material_id;
 
-  // Reset contact stream
+  const creVec2 *restrict const p_vel = packet->write.vel;
+
+  // Reset contact rows and solver body slots
   contactCount = 0;
+  PhysicsSolver_BeginGather();
+
+  const uint32_t truncatedBefore = SpatialHash_GetTruncatedTotal();
+  const bool heatmap = SpatialHash_IsInstrumented();
 
   for (uint32_t i = 0; i < bound; i++) {
     const uint64_t flagsA = p_flags[i];
@@ -712,14 +972,29 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
     const float clampedW = PhysicsSystem_ClampSize(p_size[i].x);
     const float clampedH = PhysicsSystem_ClampSize(p_size[i].y);
 
-    // Query spatial hash for potential colliders
-    const int count = SpatialHash_Query(
+    // Query dynamic layer for potential colliders (static bodies are
+    // handled below through the compiled static colliders)
+    const int count = SpatialHash_QueryDynamic(
         static_cast<int>(clampedX), static_cast<int>(clampedY),
         static_cast<int>(clampedW), static_cast<int>(clampedH), neighbours,
         PHYS_MAX_NEIGHBOURS);
-    // Collision Layer/Mask Check
-    const uint32_t layerA = GET_LAYER(flagsA);
-    const uint32_t maskA = GET_MASK(flagsA);
+#if CRE_DETERMINISTIC
+    SortNeighbours(neighbours, count);
+#endif
+    const uint32_t contactsBefore = contactCount;
+
+    // Per-body values hoisted out of the candidate loops. A culled body
+    // skipped the broad phase, so its filter comes from its own flags.
+    const uint32_t layerA = static_cast<uint32_t>(GET_LAYER(flagsA));
+    const uint32_t maskA = static_cast<uint32_t>(GET_MASK(flagsA));
+    const float invMassA = p_inv_mass[i];
+    const uint8_t matA = p_material[i];
+
+    const bool aIsCircle = (compsA & COMP_COLLISION_Circle) != 0;
+    const bool aIsAABB = (compsA & COMP_COLLISION_AABB) != 0;
+    const float radiusA = p_size[i].x * 0.5f;
+    const float centerAX = p_pos[i].x + radiusA;
+    const float centerAY = p_pos[i].y + radiusA;
 
     // Check against each potential collider
     for (int k = 0; k < count; k++) {
@@ -730,7 +1005,6 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
         continue;
 
       const uint64_t flagsB = p_flags[j];
-      const uint64_t compsB = p_comps[j];
 
       // Must be active
       if (!(flagsB & FLAG_ACTIVE))
@@ -747,36 +1021,30 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
       }
 
       // ----------------------------------------------------------------
-      // Collision Layer/Mask Check
+      // Collision Layer/Mask Check (bidirectional, packed filter)
       // ----------------------------------------------------------------
-      const uint32_t layerB = GET_LAYER(flagsB);
-      const uint32_t maskB = GET_MASK(flagsB);
-
-      // Check if they should collide (bidirectional mask check)
-      if (!((maskA & layerB) || (maskB & layerA)))
+      const uint32_t filterB = g_bodyFilter[j];
+      if (!((maskA & filterB) || ((filterB >> 16) & layerA)))
         continue;
 
       // ----------------------------------------------------------------
       // Dispatch Collision Detection Based on Shape Types
       // ----------------------------------------------------------------
+      const uint64_t compsB = p_comps[j];
       float overlap = 0.0f;
       creVec2 normal = {0.0f, 0.0f};
       bool collided = false;
 
-      const bool aIsCircle = (compsA & COMP_COLLISION_Circle) != 0;
       const bool bIsCircle = (compsB & COMP_COLLISION_Circle) != 0;
-      const bool aIsAABB = (compsA & COMP_COLLISION_AABB) != 0;
       const bool bIsAABB = (compsB & COMP_COLLISION_AABB) != 0;
 
-      float radiusA = p_size[i].x * 0.5f;
-      float radiusB = p_size[j].x * 0.5f;
+      const float radiusB = p_size[j].x * 0.5f;
 
       if (aIsCircle && bIsCircle) {
         // Circle vs Circle
         collided = CheckCircle_Circle(
-            p_pos[i].x + radiusA, p_pos[i].y + radiusA, radiusA,
-            p_pos[j].x + radiusB, p_pos[j].y + radiusB, radiusB, &overlap,
-            &normal);
+            centerAX, centerAY, radiusA, p_pos[j].x + radiusB,
+            p_pos[j].y + radiusB, radiusB, &overlap, &normal);
       } else if (aIsAABB && bIsAABB) {
         // AABB vs AABB
         collided = CheckAABB_AABB(p_pos[i].x, p_pos[i].y, p_size[i].x,
@@ -784,9 +1052,9 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
                                   p_size[j].x, p_size[j].y, &overlap, &normal);
       } else if (aIsCircle && bIsAABB) {
         // Circle (A) vs AABB (B)
-        collided = CheckCircle_AABB(
-            p_pos[i].x + radiusA, p_pos[i].y + radiusA, radiusA, p_pos[j].x,
-            p_pos[j].y, p_size[j].x, p_size[j].y, &overlap, &normal);
+        collided = CheckCircle_AABB(centerAX, centerAY, radiusA, p_pos[j].x,
+                                    p_pos[j].y, p_size[j].x, p_size[j].y,
+                                    &overlap, &normal);
       } else if (aIsAABB && bIsCircle) {
         // AABB (A) vs Circle (B) - swap and invert normal
         collided = CheckCircle_AABB(
@@ -801,17 +1069,82 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
       // Store Contact if Collision Detected
       // ----------------------------------------------------------------
       if (collided && overlap > 0.0f) {
-        if (contactCount < MAX_CONTACTS) {
-          contactStream[contactCount].idA = i;
-          contactStream[contactCount].idB = j;
-          contactStream[contactCount].overlap = overlap;
-          contactStream[contactCount].normalX = normal.x;
-          contactStream[contactCount].normalY = normal.y;
-          contactCount++;
+        // Wake both once here instead of every solver iteration
+        EntityRegistry_ClearFlags(counters, &p_flags[i], FLAG_SLEEPING);
+        EntityRegistry_ClearFlags(counters, &p_flags[j], FLAG_SLEEPING);
+        PushContact(i, j, false, overlap, normal, invMassA, p_inv_mass[j],
+                    matA, p_material[j], p_pos, p_vel);
+      }
+    }
+
+    // ------------------------------------------------------------------
+    // Compiled Static Colliders (merged rectangles + edge chains)
+    // ------------------------------------------------------------------
+    const int staticCount = StaticGeometry_Query(
+        static_cast<int>(clampedX), static_cast<int>(clampedY),
+        static_cast<int>(clampedW), static_cast<int>(clampedH), neighbours,
+        PHYS_MAX_NEIGHBOURS);
+#if CRE_DETERMINISTIC
+    SortNeighbours(neighbours, staticCount);
+#endif
+
+    for (int k = 0; k < staticCount; k++) {
+      const StaticCollider *sc = StaticGeometry_Get(neighbours[k]);
+
+      if (!((maskA & sc->layer) || (sc->mask & layerA)))
+        continue;
+
+      float overlap = 0.0f;
+      creVec2 normal = {0.0f, 0.0f};
+      bool collided = false;
+
+      if (sc->isCircle) {
+        const float radiusB = sc->w * 0.5f;
+        if (aIsCircle) {
+          collided = CheckCircle_Circle(centerAX, centerAY, radiusA,
+                                        sc->x + radiusB, sc->y + radiusB,
+                                        radiusB, &overlap, &normal);
+        } else if (aIsAABB) {
+          collided = CheckCircle_AABB(sc->x + radiusB, sc->y + radiusB,
+                                      radiusB, p_pos[i].x, p_pos[i].y,
+                                      p_size[i].x, p_size[i].y, &overlap,
+                                      &normal);
+          normal.x = -normal.x;
+          normal.y = -normal.y;
         }
+      } else if (aIsAABB) {
+        collided = CheckAABB_StaticEdges(p_pos[i].x, p_pos[i].y, p_size[i].x,
+                                         p_size[i].y, sc, &overlap, &normal);
+      } else if (aIsCircle) {
+        collided = CheckCircle_AABB(centerAX, centerAY, radiusA, sc->x, sc->y,
+                                    sc->w, sc->h, &overlap, &normal);
       }
+
+      if (collided && overlap > 0.0f) {
+        EntityRegistry_ClearFlags(counters, &p_flags[i], FLAG_SLEEPING);
+        // Static side has infinite mass
+        PushContact(i, sc->ownerID, true, overlap, normal, invMassA, 0.0f,
+                    matA, sc->material, p_pos, p_vel);
+      }
+    }
+
+    if (heatmap) {
+      SpatialHash_AddContacts(static_cast<int>(clampedX),
+                              static_cast<int>(clampedY),
+                              contactCount - contactsBefore);
     }
   }
+
+  // Candidates past PHYS_MAX_NEIGHBOURS were never tested: missed contacts
+  const uint32_t truncated = SpatialHash_GetTruncatedTotal() - truncatedBefore;
+  s_solverStats.truncatedQueries = truncated;
+  if (truncated > 0 && !s_warnedTruncation) {
+    Log(LogLevel::Warning,
+        "Phase3: {} bodies hit PHYS_MAX_NEIGHBOURS ({}), contacts missed "
+        "(reported once, see PhysicsSolverStats::truncatedQueries)",
+        truncated, PHYS_MAX_NEIGHBOURS);
+    s_warnedTruncation = true;
+  }
 }
 
 // ============================================================================
@@ -821,24 +1154,44 @@ static void Phase3_DetectContacts(physicsPacket *packet) {
 /**
  * @brief Resolve all collected contacts sequentially.
  *
- * Iterates over contact stream and applies collision response.
- * Sequential access pattern is cache-friendly.
+ * Iterates over the contact rows and applies collision response to the
+ * compact solver bodies. Rows are streamed, bodies stay hot in cache.
  *
- * @param reg  Entity registry
+ * @return Largest position correction of this pass (pixels)
  */
-static void Phase3_ResolveContacts(physicsPacket *packet) {
-  creVec2 *restrict const pos = packet->write.pos;
-  creVec2 *restrict const vel = packet->write.vel;
-  uint64_t *restrict const state_flags = packet->write.state_flags;
-  float *restrict const inv_mass = packet->write.inv_mass;
-  uint8_t *restrict const material_id = packet->write.material_id;
+static float Phase3_ResolveContacts(void) {
+  creVec2 *restrict const pos = PhysicsSolver_Positions();
+  creVec2 *restrict const vel = PhysicsSolver_Velocities();
 
-  for (int i = 0; i < contactCount; i++) {
-    const ContactPair *c = &contactStream[i];
-    creVec2 normal = {c->normalX, c->normalY};
-    ResolveCollision(pos, vel, state_flags, inv_mass, material_id, c->idA,
-                     c->idB, c->overlap, normal);
+  float maxCorrection = 0.0f;
+  for (uint32_t i = 0; i < contactCount; i++) {
+    maxCorrection = fmaxf(maxCorrection, ResolveCollision(pos, vel, i));
   }
+  return maxCorrection;
+}
+
+/**
+ * @brief Scatter solved bodies back to the registry (once per sub-step).
+ *
+ * Also publishes solver stats: compact vs registry cache lines covered by
+ * the bodies each iteration touches.
+ *
+ * @param packet Physics packet (registry pos/vel)
+ */
+static void Phase3_ScatterBodies(physicsPacket *packet) {
+  PhysicsSolver_Scatter(packet->write.pos, packet->write.vel);
+
+  const uint32_t bodyCount = PhysicsSolver_BodyCount();
+  const uint32_t bodyBytes =
+      static_cast<uint32_t>(bodyCount * sizeof(creVec2));
+  s_solverStats.contacts = contactCount;
+  s_solverStats.joints = PhysicsConstraints_RowCount();
+  s_solverStats.bodies = bodyCount - 1;
+  s_solverStats.rowBytes = static_cast<uint32_t>(
+      contactCount * (sizeof(uint32_t) * 2 + sizeof(float) * 8));
+  s_solverStats.compactLines = ((bodyBytes + 63) / 64) * 2; // pos + vel
+  s_solverStats.registryLines =
+      PhysicsSolver_RegistryLines() * 2; // pos + vel
 }
 
 // ============================================================================
@@ -936,6 +1289,55 @@ static bool CheckAABB_AABB(float ax, float ay, float aw, float ah, float bx,
   return true;
 }
 
+/**
+ * @brief AABB vs compiled static rectangle, honouring its edge chain.
+ *
+ * Same MTV test as CheckAABB_AABB, but a face that is shared with another
+ * static collider is never chosen as the separation axis. This removes the
+ * classic "snag on the seam between two tiles" when sliding along a wall.
+ * If both candidate faces are internal (deep penetration) the plain MTV is
+ * used so the body can still escape.
+ */
+static bool CheckAABB_StaticEdges(float ax, float ay, float aw, float ah,
+                                  const StaticCollider *b, float *out_overlap,
+                                  creVec2 *out_normal) {
+  const float halfAW = aw * 0.5f;
+  const float halfAH = ah * 0.5f;
+  const float halfBW = b->w * 0.5f;
+  const float halfBH = b->h * 0.5f;
+
+  const float dx = (b->x + halfBW) - (ax + halfAW);
+  const float dy = (b->y + halfBH) - (ay + halfAH);
+
+  const float overlapX = (halfAW + halfBW) - fabsf(dx);
+  const float overlapY = (halfAH + halfBH) - fabsf(dy);
+
+  if (overlapX <= 0.0f || overlapY <= 0.0f) {
+    return false;
+  }
+
+  // Normal points from A to B, so A touches B's opposite face.
+  const uint8_t faceX = (dx > 0.0f) ? STATIC_EDGE_LEFT : STATIC_EDGE_RIGHT;
+  const uint8_t faceY = (dy > 0.0f) ? STATIC_EDGE_TOP : STATIC_EDGE_BOTTOM;
+  const bool openX = (b->edgeMask & faceX) != 0;
+  const bool openY = (b->edgeMask & faceY) != 0;
+
+  bool useX = overlapX < overlapY;
+  if (useX && !openX && openY)
+    useX = false;
+  else if (!useX && !openY && openX)
+    useX = true;
+
+  if (useX) {
+    *out_overlap = overlapX;
+    *out_normal = creVec2{(dx > 0.0f) ? 1.0f : -1.0f, 0.0f};
+  } else {
+    *out_overlap = overlapY;
+    *out_normal = creVec2{0.0f, (dy > 0.0f) ? 1.0f : -1.0f};
+  }
+  return true;
+}
+
 /**
  * @brief Check circle-AABB collision.
  *
@@ -996,94 +1398,70 @@ static bool CheckCircle_AABB(float cx, float cy, float radius, float bx,
 // ============================================================================
 
 /**
- * @brief Apply collision response: wake, position correction, impulse,
- * friction.
+ * @brief Apply collision response: position correction, impulse, friction.
  *
  * Response steps:
- *   1. Wake both entities (clear FLAG_SLEEPING)
- *   2. Position correction (Linear Projection with slop)
- *   3. Velocity impulse (Newtonian restitution)
- *   4. Friction impulse (Coulomb model)
+ *   1. Position correction (Linear Projection with slop)
+ *   2. Velocity impulse (Newtonian restitution)
+ *   3. Friction impulse (Coulomb model)
+ *
+ * Inverse masses, effective mass and material coefficients come from the
+ * contact row (resolved in Phase3_DetectContacts, bodies woken there).
  *
- * @param reg     Entity registry
- * @param idA     First entity
- * @param idB     Second entity
- * @param overlap Penetration depth
- * @param normal  Collision normal (from A to B)
+ * @param pos Solver-local positions
+ * @param vel Solver-local velocities
+ * @param row Contact row (normal from A to B)
+ * @return Separation applied along the normal (pixels)
  */
-static void ResolveCollision(creVec2 *pos, creVec2 *vel, uint64_t *state_flags,
-                             float *inv_mass, uint8_t *material_id,
-                             uint32_t idA, uint32_t idB, float overlap,
-                             creVec2 normal) {
+static float ResolveCollision(creVec2 *restrict pos, creVec2 *restrict vel,
+                              uint32_t row) {
   // TODO: [OPTIMIZATION] Stacking Instability / Jitter Detected.
-  // -------------------------------------------------------------------------
-  // Step 1: Wake Both Entities
-  // -------------------------------------------------------------------------
-  state_flags[idA] &= ~FLAG_SLEEPING;
-  state_flags[idB] &= ~FLAG_SLEEPING;
-
-  // -------------------------------------------------------------------------
-  // Get inverse masses (0 = infinite mass / static)
-  // -------------------------------------------------------------------------
-  const float invMassA = inv_mass[idA];
-  const float invMassB = inv_mass[idB];
-  const float invMassSum = invMassA + invMassB;
-
-  // Both static = no response needed (increased epsilon to prevent explosion)
-  if (invMassSum <= 0.0001f)
-    return;
+  const uint32_t idA = s_rows.bodyA[row];
+  const uint32_t idB = s_rows.bodyB[row];
+  const float invMassA = s_rows.invMassA[row];
+  const float invMassB = s_rows.invMassB[row];
+  const float EffectiveMassSum = s_rows.effMass[row];
+  const float overlap = s_rows.overlap[row];
+  const creVec2 normal = {s_rows.normalX[row], s_rows.normalY[row]};
 
   // -------------------------------------------------------------------------
-  // Get material properties (with defensive clamping)
+  // Step 1: Position Correction (Linear Projection)
   // -------------------------------------------------------------------------
-  const uint8_t matA = material_id[idA];
-  const uint8_t matB = material_id[idB];
-
-  // Defensive clamping (material_id could be set externally)
-  const uint8_t safeMatA = matA;
-  const uint8_t safeMatB = matB;
-
-  const float frictionA = g_materials[safeMatA].friction;
-  const float frictionB = g_materials[safeMatB].friction;
-  const float restitutionA = g_materials[safeMatA].restitution;
-  const float restitutionB = g_materials[safeMatB].restitution;
-
-  // Mix: max for restitution, multiply for friction
-  const float e = fmaxf(restitutionA, restitutionB); // e = bigger one.
-  const float mu = frictionA * frictionB;
-
-  // -------------------------------------------------------------------------
-  // Step 2: Position Correction (Linear Projection)
-  // -------------------------------------------------------------------------
-  const float EffectiveMassSum = 1.0f / invMassSum;
-  float correctionMag =
+  float separation =
       ((overlap - PHYS_SLOP) > 0.0f ? (overlap - PHYS_SLOP) : 0.0f) *
-      PHYS_CORRECTION_PERCENT * EffectiveMassSum;
+      PHYS_CORRECTION_PERCENT;
 
-  // Cap maximum correction to prevent teleportation (M4 fix)
+  // Cap maximum correction to prevent teleportation (M4 fix). The cap is in
+  // pixels: capping the mass-weighted magnitude froze heavy pairs at a
+  // fraction of a pixel per iteration.
   const float MAX_CORRECTION = 50.0f; // pixels per frame
-  if (correctionMag > MAX_CORRECTION) {
-    correctionMag = MAX_CORRECTION;
+  if (separation > MAX_CORRECTION) {
+    separation = MAX_CORRECTION;
   }
+  const float correctionMag = separation * EffectiveMassSum;
 
   pos[idA].x -= normal.x * correctionMag * invMassA;
   pos[idA].y -= normal.y * correctionMag * invMassA;
   pos[idB].x += normal.x * correctionMag * invMassB;
   pos[idB].y += normal.y * correctionMag * invMassB;
 
+  // The row remembers how much penetration is left, so later iterations
+  // only correct the remainder and the solver can tell when it converged.
+  s_rows.overlap[row] = overlap - separation;
+
   // -------------------------------------------------------------------------
-  // Step 3: Velocity Impulse (Restitution)
+  // Step 2: Velocity Impulse (Restitution)
   // -------------------------------------------------------------------------
-  const float relVelX = vel[idA].x - vel[idB].y;
+  const float relVelX = vel[idA].x - vel[idB].x;
   const float relVelY = vel[idA].y - vel[idB].y;
   const float velAlongNormal = relVelX * normal.x + relVelY * normal.y;
 
   // Don't resolve if velocities are separating
   if (velAlongNormal < -0.001f)
-    return;
+    return separation;
 
   // Impulse magnitude
-  const float j = -(1.0f + e) * velAlongNormal * EffectiveMassSum;
+  const float j = -(1.0f + s_rows.e[row]) * velAlongNormal * EffectiveMassSum;
 
   // Apply impulse
   vel[idA].x += j * invMassA * normal.x;
@@ -1092,7 +1470,7 @@ static void ResolveCollision(creVec2 *pos, creVec2 *vel, uint64_t *state_flags,
   vel[idB].y -= j * invMassB * normal.y;
 
   // -------------------------------------------------------------------------
-  // Step 4: Friction Impulse (Tangent)
+  // Step 3: Friction Impulse (Tangent)
   // -------------------------------------------------------------------------
   // Recalculate relative velocity after normal impulse
   const float relVelX2 = vel[idA].x - vel[idB].x;
@@ -1104,12 +1482,12 @@ static void ResolveCollision(creVec2 *pos, creVec2 *vel, uint64_t *state_flags,
   const float tangentY =
       relVelY2 - (relVelX2 * normal.x + relVelY2 * normal.y) * normal.y;
   const float tangentLen = sqrtf(tangentX * tangentX + tangentY * tangentY);
-  const float invTangentLen = 1.0f / tangentLen; // Division is expensive.
 
   if (tangentLen < 0.0001f)
-    return; // No tangent velocity
+    return separation; // No tangent velocity
 
   // Normalize tangent
+  const float invTangentLen = 1.0f / tangentLen;
   const float tangentNormX = tangentX * invTangentLen;
   const float tangentNormY = tangentY * invTangentLen;
 
@@ -1118,7 +1496,7 @@ static void ResolveCollision(creVec2 *pos, creVec2 *vel, uint64_t *state_flags,
       -(relVelX2 * tangentNormX + relVelY2 * tangentNormY) * EffectiveMassSum;
 
   // Clamp to Coulomb friction (|jt| <= |j| * mu)
-  const float maxFriction = fabsf(j) * mu;
+  const float maxFriction = fabsf(j) * s_rows.mu[row];
   if (jt < -maxFriction)
     jt = -maxFriction;
   if (jt > maxFriction)
@@ -1129,4 +1507,5 @@ static void ResolveCollision(creVec2 *pos, creVec2 *vel, uint64_t *state_flags,
   vel[idA].y += jt * invMassA * tangentNormY;
   vel[idB].x -= jt * invMassB * tangentNormX;
   vel[idB].y -= jt * invMassB * tangentNormY;
+  return separation;
 }
@@ -6,10 +6,12 @@
  *   Phase 0: Command Processing (CMD_PHYS_DEFINE, CMD_PHYS_LOAD_STATIC, etc.)
  *   Phase 1: Integration (Gravity, Drag, Semi-Implicit Euler)
  *   Phase 2: Broad Phase (Spatial Hash Population)
- *   Phase 3: Narrow Phase + Solver (Collision Detection & Response)
+ *   Phase 3: Narrow Phase + Solver (Contacts and Joints)
  *
  * All phases operate on EntityRegistry SoA arrays for cache efficiency.
- * Sub-stepping is configurable via PHYS_SUB_STEPS in cre_config.h.
+ * Sub-steps adapt to the fastest body (PHYS_MIN/MAX_SUB_STEPS in cre_config.h),
+ * solver iterations stop early once corrections fall under
+ * PHYS_SOLVER_TOLERANCE.
  */
 
 #ifndef CRE_PHYSICSSYSTEM_H
@@ -21,6 +23,36 @@
 struct EntityRegistry;
 struct CommandBus;
 struct physicsPacket;
+struct SimStateBlock;
+
+/**
+ * @brief Solver counters for the last sub-step.
+ *
+ * No hardware counters are available here, so cache behaviour is estimated
+ * by counting 64-byte lines: the lines of the compact solver arrays touched
+ * per iteration vs. the registry lines the same bodies are spread over.
+ */
+typedef struct {
+  uint32_t contacts;         ///< Contact rows solved
+  uint32_t joints;           ///< Joint rows solved
+  uint32_t bodies;           ///< Bodies gathered into the solver arrays
+  uint32_t rowBytes;         ///< Contact row bytes streamed per iteration
+  uint32_t compactLines;     ///< pos/vel lines touched per iteration (compact)
+  uint32_t registryLines;    ///< pos/vel lines the same bodies span in registry
+  uint32_t truncatedQueries; ///< Bodies whose neighbour query hit the cap
+} PhysicsSolverStats;
+
+/**
+ * @brief Step/iteration choice of the last PhysicsSystem_Update.
+ */
+typedef struct {
+  uint32_t subSteps;   ///< Sub-steps run
+  uint32_t iterations; ///< Solver iterations, summed over the sub-steps
+  uint32_t budgetCuts; ///< Sub-steps merged away by the time budget
+  float maxSpeed;      ///< Fastest awake dynamic body (px/s)
+  float minSize;       ///< Smallest collider extent (px)
+  float residual;      ///< Largest correction of the last iteration (px)
+} PhysicsStepStats;
 
 // ============================================================================
 // Core API
@@ -39,12 +71,17 @@ void PhysicsSystem_Init(void);
  *
  * Executes in order:
  *   1. Phase 0: Process physics commands from bus
- *   2. Sub-step loop (PHYS_SUB_STEPS iterations):
+ *   2. Sub-step loop (count chosen from max speed / smallest collider):
  *      a. Phase 1: Integration (gravity, drag, movement)
  *      b. Phase 2: Broad phase (spatial hash build)
- *      c. Phase 3: Solver loop (PHYS_SOLVER_ITERATIONS):
+ *      c. Phase 3: Solver loop (up to PHYS_SOLVER_ITERATIONS, stops early
+ *         once converged):
  *         - Collision detection & response
  *
+ * If the update runs past its time budget (PhysicsSystem_SetTimeBudget),
+ * the remaining sub-steps are merged into one at minimum iterations, so the
+ * full frame time is still simulated.
+ *
  * @param reg    Pointer to the EntityRegistry (SoA data)
  * @param bus    Command bus for physics commands
  * @param dt     Delta time in seconds (clamped to 0.05f max internally)
@@ -62,6 +99,40 @@ void PhysicsSystem_Update(physicsPacket *packet);
  */
 void PhysicsSystem_ProcessCommands(physicsPacket* packet);
 
+/**
+ * @brief Override the combined coefficients for a material pair.
+ *
+ * The pair table is filled from the material table at init (friction
+ * product, max restitution). Use this for special cases such as
+ * "player on ice". The table is symmetric, order of a/b does not matter.
+ */
+void PhysicsSystem_SetMaterialPair(uint8_t matA, uint8_t matB, float friction,
+                                   float restitution);
+
+/**
+ * @brief Get solver counters from the last physics sub-step.
+ */
+PhysicsSolverStats PhysicsSystem_GetSolverStats(void);
+
+/**
+ * @brief Sub-steps and iterations chosen by the last update.
+ */
+PhysicsStepStats PhysicsSystem_GetStepStats(void);
+
+/**
+ * @brief Wall-clock budget of one update in ms, 0 = unlimited.
+ * Defaults to PHYS_TIME_BUDGET_MS. Budget cuts depend on timing: disable it
+ * wherever runs must reproduce bit for bit (rollback, replays).
+ */
+void PhysicsSystem_SetTimeBudget(float ms);
+
+/**
+ * @brief Gravity + material tables, for rollback (see cre_simState.h).
+ * Contact rows and the solver arrays are rebuilt every sub-step and are not
+ * part of the simulation state.
+ */
+void PhysicsSystem_GetSimState(SimStateBlock *out);
+
 physicsPacket CreatePhysicsPacket(EntityRegistry *reg, CommandBus *bus,
                                   float fixedDt);
 
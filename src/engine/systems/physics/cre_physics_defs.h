@@ -11,6 +11,15 @@ typedef struct {
   float restitution; // 0.0 (Mud) -> 1.0 (Superball)
 } PhysMaterial;
 
+/**
+ * Combined coefficients for a material pair, precomputed so contacts never
+ * touch the per-material table. Default mix: friction product, max restitution.
+ */
+typedef struct {
+  float friction;    // Combined Coulomb coefficient (mu)
+  float restitution; // Combined restitution (e)
+} PhysMaterialPair;
+
 typedef enum {
   MAT_DEFAULT = 0,
   MAT_STATIC,
@@ -20,4 +29,11 @@ typedef enum {
   MAT_COUNT
 } MaterialID;
 
+typedef enum : uint8_t {
+  PHYS_JOINT_DISTANCE = 0, // Rigid rod: keeps anchors at a fixed length
+  PHYS_JOINT_ROPE,         // Max length only: slack allowed, pulls when taut
+  PHYS_JOINT_WELD,         // Keeps the relative anchor offset (no rotation)
+  PHYS_JOINT_TYPE_COUNT
+} PhysJointType;
+
 #endif
@@ -0,0 +1,187 @@
+#include "cre_sparseGrid.h"
+#include "engine/core/cre_config.h"
+#include <string.h>
+
+#define SPARSE_NULL_IDX UINT32_MAX
+#define SPARSE_GRID_MASK (SPARSE_GRID_CAPACITY - 1)
+// Keep probe sequences short: refuse new cells past 75% load
+#define SPARSE_GRID_MAX_CELLS ((SPARSE_GRID_CAPACITY / 4) * 3)
+
+#define WORLD_TO_GRID(val) ((val) >> SPATIAL_GRID_SHIFT)
+
+static_assert((SPARSE_GRID_CAPACITY & SPARSE_GRID_MASK) == 0,
+              "SPARSE_GRID_CAPACITY must be a power of 2!");
+
+/**
+ * @brief One cell (or overflow block). Exactly one cache line.
+ */
+struct alignas(64) SparseCell {
+  uint64_t key;        // Packed (cellX, cellY), slots only
+  uint32_t generation; // Live iff == s_generation, slots only
+  uint16_t count;      // Ids used in this slot/block
+  uint16_t _padding;
+  uint32_t next; // Newest overflow block (SPARSE_NULL_IDX = none)
+  uint32_t ids[SPARSE_CELL_INLINE];
+};
+
+static_assert(sizeof(SparseCell) == 64, "SparseCell must be one cache line");
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+static SparseCell s_cells[SPARSE_GRID_CAPACITY];
+static SparseCell s_overflow[SPARSE_GRID_OVERFLOW];
+static uint32_t s_generation = 1; // Zeroed slots (generation 0) are empty
+static SparseGridStats s_stats = {};
+
+// Query deduplication (same timestamp trick as the spatial hash)
+static uint32_t s_lastSeen[MAX_ENTITIES];
+static uint32_t s_queryStamp = 0;
+
+static inline uint64_t PackKey(int cellX, int cellY) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+}
+
+// Fibonacci hashing: the multiply mixes both halves into the top bits
+static inline uint32_t SlotOf(uint64_t key) {
+  return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ULL) >>
+                               (64 - SPARSE_GRID_BITS));
+}
+
+/**
+ * @brief Find the cell's slot, claiming an empty one if insert is set.
+ * @return nullptr if absent (or the table is at its load limit)
+ */
+static SparseCell *FindCell(uint64_t key, bool insert) {
+  uint32_t idx = SlotOf(key);
+  for (uint32_t probe = 0; probe < SPARSE_GRID_CAPACITY; probe++) {
+    SparseCell *cell = &s_cells[idx];
+    if (cell->generation != s_generation) {
+      if (!insert || s_stats.cells >= SPARSE_GRID_MAX_CELLS)
+        return nullptr;
+      cell->key = key;
+      cell->generation = s_generation;
+      cell->count = 0;
+      cell->next = SPARSE_NULL_IDX;
+      s_stats.cells++;
+      if (probe > s_stats.maxProbe) {
+        s_stats.maxProbe = probe;
+      }
+      return cell;
+    }
+    if (cell->key == key)
+      return cell;
+    idx = (idx + 1) & SPARSE_GRID_MASK;
+  }
+  return nullptr;
+}
+
+static inline void CollectIds(const SparseCell *block, uint32_t *results,
+                              int *count, int maxResults, bool *full) {
+  for (uint32_t k = 0; k < block->count; k++) {
+    const uint32_t id = block->ids[k];
+    if (s_lastSeen[id] == s_queryStamp)
+      continue;
+    if (*count >= maxResults) {
+      *full = true;
+      return;
+    }
+    s_lastSeen[id] = s_queryStamp;
+    results[(*count)++] = id;
+  }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void SparseGrid_Clear(void) {
+  s_generation++;
+  if (s_generation == 0) {
+    // Wrapped: old tags could look live again
+    memset(s_cells, 0, sizeof(s_cells));
+    s_generation = 1;
+  }
+  s_stats = {.cells = 0,
+             .ids = 0,
+             .overflowUsed = 0,
+             .dropped = 0,
+             .maxProbe = 0,
+             .truncated = 0};
+}
+
+void SparseGrid_Add(uint32_t entityID, int x, int y, int width, int height) {
+  const int minX = WORLD_TO_GRID(x);
+  const int minY = WORLD_TO_GRID(y);
+  const int maxX = WORLD_TO_GRID(x + width);
+  const int maxY = WORLD_TO_GRID(y + height);
+
+  for (int cy = minY; cy <= maxY; cy++) {
+    for (int cx = minX; cx <= maxX; cx++) {
+      SparseCell *cell = FindCell(PackKey(cx, cy), true);
+      if (!cell) {
+        s_stats.dropped++;
+        continue;
+      }
+
+      SparseCell *block = cell;
+      if (cell->count == SPARSE_CELL_INLINE) {
+        // Inline ids full: append to the newest overflow block
+        block = (cell->next != SPARSE_NULL_IDX) ? &s_overflow[cell->next]
+                                                : nullptr;
+        if (!block || block->count == SPARSE_CELL_INLINE) {
+          if (s_stats.overflowUsed >= SPARSE_GRID_OVERFLOW) {
+            s_stats.dropped++;
+            continue;
+          }
+          const uint32_t blockIdx = s_stats.overflowUsed++;
+          block = &s_overflow[blockIdx];
+          block->count = 0;
+          block->next = cell->next;
+          cell->next = blockIdx;
+        }
+      }
+      block->ids[block->count++] = entityID;
+      s_stats.ids++;
+    }
+  }
+}
+
+int SparseGrid_Query(int x, int y, int width, int height, uint32_t *results,
+                     int maxResults) {
+  s_queryStamp++;
+  if (s_queryStamp == 0) {
+    memset(s_lastSeen, 0, sizeof(s_lastSeen));
+    s_queryStamp = 1;
+  }
+
+  const int minX = WORLD_TO_GRID(x);
+  const int minY = WORLD_TO_GRID(y);
+  const int maxX = WORLD_TO_GRID(x + width);
+  const int maxY = WORLD_TO_GRID(y + height);
+
+  int count = 0;
+  bool full = false;
+  for (int cy = minY; cy <= maxY; cy++) {
+    for (int cx = minX; cx <= maxX; cx++) {
+      const SparseCell *cell = FindCell(PackKey(cx, cy), false);
+      if (!cell)
+        continue;
+
+      CollectIds(cell, results, &count, maxResults, &full);
+      for (uint32_t b = cell->next; b != SPARSE_NULL_IDX && !full;
+           b = s_overflow[b].next) {
+        CollectIds(&s_overflow[b], results, &count, maxResults, &full);
+      }
+      if (full) {
+        s_stats.truncated++;
+        return count;
+      }
+    }
+  }
+  return count;
+}
+
+SparseGridStats SparseGrid_GetStats(void) { return s_stats; }
@@ -0,0 +1,62 @@
+/**
+ * @file cre_sparseGrid.h
+ * @brief Open-Addressed Sparse Grid (alternative dynamic spatial map)
+ *
+ * Same cells as the spatial hash (SPATIAL_GRID_SIZE), but each occupied
+ * cell owns a slot keyed by its full 64-bit packed (cellX, cellY):
+ *
+ *   - Linear probing over SPARSE_GRID_CAPACITY 64-byte slots. A lookup
+ *     stops at the first slot of another generation, so distinct cells
+ *     never share a bucket and queries only read their own ids.
+ *   - SparseGrid_Clear bumps a generation tag instead of clearing memory.
+ *   - Each slot holds SPARSE_CELL_INLINE ids inline; busier cells chain
+ *     extra 64-byte blocks from a per-frame overflow pool.
+ *
+ * The dynamic layer of cre_spatialHash.h stays the physics broad phase;
+ * this is the drop-in candidate for large sparse worlds, where the fixed
+ * SPATIAL_HASH_SIZE buckets alias distant cells. Compare both with
+ * `CRayEngine_Server --grid-bench`.
+ */
+
+#ifndef CRE_SPARSEGRID_H
+#define CRE_SPARSEGRID_H
+
+#include <stdint.h>
+
+constexpr uint32_t SPARSE_GRID_BITS = 16;
+constexpr uint32_t SPARSE_GRID_CAPACITY = 1u << SPARSE_GRID_BITS; // Slots
+constexpr uint32_t SPARSE_GRID_OVERFLOW = 8192;                   // Blocks
+constexpr uint32_t SPARSE_CELL_INLINE = 11; // Ids per slot / block
+
+typedef struct {
+  uint32_t cells;         ///< Occupied cells (slots in use)
+  uint32_t ids;           ///< Ids inserted (one per covered cell)
+  uint32_t overflowUsed;  ///< Overflow blocks in use
+  uint32_t dropped;       ///< Inserts lost (table or overflow pool full)
+  uint32_t maxProbe;      ///< Longest probe sequence of an insert
+  uint32_t truncated;     ///< Queries that stopped at maxResults
+} SparseGridStats;
+
+/**
+ * @brief Forget every cell (O(1), generation bump). Call once per frame.
+ */
+void SparseGrid_Clear(void);
+
+/**
+ * @brief Add an entity to every cell its AABB covers.
+ */
+void SparseGrid_Add(uint32_t entityID, int x, int y, int width, int height);
+
+/**
+ * @brief Collect the unique entities of every cell the area covers.
+ * @return Number of ids written (at most maxResults)
+ */
+int SparseGrid_Query(int x, int y, int width, int height, uint32_t *results,
+                     int maxResults);
+
+/**
+ * @brief Counters since the last SparseGrid_Clear.
+ */
+SparseGridStats SparseGrid_GetStats(void);
+
+#endif
@@ -1,6 +1,7 @@
 #include "cre_spatialHash.h"
 #include "engine/core/cre_config.h"
 #include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
 #include <assert.h>
 #include <cstdint>
 #include <stdbool.h>
@@ -12,7 +13,10 @@
 // ============================================================================
 
 #define SPATIAL_MAX_STATIC 40000
-#define SPATIAL_MAX_DYNAMIC 20000
+// A body no larger than a cell spans at most 2x2 cells, so a registry full
+// of them always fits. Larger bodies past the pool go to the overflow list.
+#define SPATIAL_CELLS_PER_BODY 4
+#define SPATIAL_MAX_DYNAMIC (MAX_ENTITIES * SPATIAL_CELLS_PER_BODY)
 #define SPATIAL_NULL_IDX UINT32_MAX
 
 // #4 Optimization: Power-of-2 bitmask for fast hashing (replaces modulo)
@@ -65,20 +69,50 @@ static inline void AdvanceQueryFrame(void) {
 // Dual-Layer Data Structures
 // ============================================================================
 
-// Bucket head indices (SPATIAL_NULL_IDX = empty)
-static uint32_t staticBuckets[SPATIAL_HASH_SIZE];
-static uint32_t dynamicBuckets[SPATIAL_HASH_SIZE];
+/**
+ * @brief Static layer: persists across steps (rollback saves it as one
+ * simulation state block).
+ */
+struct SpatialStaticLayer {
+  uint32_t buckets[SPATIAL_HASH_SIZE]; // Heads (SPATIAL_NULL_IDX = empty)
+  SpatialNode nodes[SPATIAL_MAX_STATIC];
+  uint32_t poolIdx;  // Allocation counter
+  uint32_t freeHead; // Free-list (for node reuse on removal)
+};
 
-// Separate node pools for each layer
-static SpatialNode staticNodes[SPATIAL_MAX_STATIC];
-static SpatialNode dynamicNodes[SPATIAL_MAX_DYNAMIC];
+static SpatialStaticLayer s_staticLayer = {
+    .buckets = {}, .nodes = {}, .poolIdx = 0, .freeHead = SPATIAL_NULL_IDX};
 
-// Allocation counters
-static uint32_t staticPoolIdx = 0;
+// Dynamic layer: rebuilt every step
+static uint32_t dynamicBuckets[SPATIAL_HASH_SIZE];
+static SpatialNode dynamicNodes[SPATIAL_MAX_DYNAMIC];
 static uint32_t dynamicPoolIdx = 0;
 
-// Static layer free-list (for node reuse on removal)
-static uint32_t staticFreeHead = SPATIAL_NULL_IDX;
+/**
+ * @brief Dynamic body the node pool could not hold. Every query tests its
+ * cell range instead of walking buckets, so it is never missed.
+ */
+struct SpatialOverflow {
+  uint32_t entityID;
+  int32_t minX, minY, maxX, maxY; // Cell range
+};
+
+// Bodies are added once per rebuild, so MAX_ENTITIES entries always fit
+static SpatialOverflow s_overflow[MAX_ENTITIES];
+static uint32_t s_overflowCount = 0;
+static bool s_overflowWarned = false; // Once per run of full rebuilds
+
+// ============================================================================
+// Instrumentation
+// ============================================================================
+
+// Distinct cells tracked per bucket when counting collisions
+#define SPATIAL_STATS_MAX_CELLS 16
+
+static uint32_t s_truncatedQueries = 0; // Since the last dynamic clear
+static uint32_t s_truncatedTotal = 0;   // Never reset
+static bool s_instrumented = false;
+static uint32_t s_bucketContacts[SPATIAL_HASH_SIZE];
 
 // ============================================================================
 // Chipmunk2D's Hashing Algorithm (Optimized with bitmask)
@@ -100,25 +134,25 @@ static inline int GetHashIndex(int cellX, int cellY) {
  */
 static uint32_t PopStaticNode(void) {
   // First try free-list
-  if (staticFreeHead != SPATIAL_NULL_IDX) {
-    uint32_t idx = staticFreeHead;
-    staticFreeHead = staticNodes[idx].nextIdx;
+  if (s_staticLayer.freeHead != SPATIAL_NULL_IDX) {
+    uint32_t idx = s_staticLayer.freeHead;
+    s_staticLayer.freeHead = s_staticLayer.nodes[idx].nextIdx;
     return idx;
   }
   // Otherwise allocate from pool
-  if (staticPoolIdx >= SPATIAL_MAX_STATIC) {
+  if (s_staticLayer.poolIdx >= SPATIAL_MAX_STATIC) {
     Log(LogLevel::Warning , "Static node pool is FULL.");
     return SPATIAL_NULL_IDX;
   }
-  return staticPoolIdx++;
+  return s_staticLayer.poolIdx++;
 }
 
 /**
  * @brief Push a static node index onto the free-list for reuse.
  */
 static void PushStaticFree(uint32_t idx) {
-  staticNodes[idx].nextIdx = staticFreeHead;
-  staticFreeHead = idx;
+  s_staticLayer.nodes[idx].nextIdx = s_staticLayer.freeHead;
+  s_staticLayer.freeHead = idx;
 }
 
 // ============================================================================
@@ -126,15 +160,43 @@ static void PushStaticFree(uint32_t idx) {
 // ============================================================================
 
 /**
- * @brief Allocate a dynamic node from pool.
- * @return Node index, or SPATIAL_NULL_IDX if pool exhausted.
+ * @brief Move a body that does not fit the node pool to the overflow list.
  */
-static uint32_t PopDynamicNode(void) {
-  if (dynamicPoolIdx >= SPATIAL_MAX_DYNAMIC) {
-    // Silently return on overflow as per plan
-    return SPATIAL_NULL_IDX;
+static void AddDynamicOverflow(uint32_t entityID, int minX, int minY,
+                               int maxX, int maxY) {
+  assert(s_overflowCount < MAX_ENTITIES && "Body added twice in a rebuild");
+  if (!s_overflowWarned) {
+    Log(LogLevel::Error,
+        "[SPATIAL] Dynamic node pool full ({} nodes): large bodies fall back "
+        "to brute-force queries",
+        SPATIAL_MAX_DYNAMIC);
+    s_overflowWarned = true;
   }
-  return dynamicPoolIdx++;
+  s_overflow[s_overflowCount++] = SpatialOverflow{
+      .entityID = entityID, .minX = minX, .minY = minY, .maxX = maxX,
+      .maxY = maxY};
+}
+
+/**
+ * @brief Overflowed bodies overlapping the queried cells, deduplicated.
+ * @return New result count
+ */
+static int QueryOverflow(int minX, int minY, int maxX, int maxY,
+                         uint32_t *results, int count, int maxResults) {
+  for (uint32_t k = 0; k < s_overflowCount; k++) {
+    const SpatialOverflow &o = s_overflow[k];
+    if (o.maxX < minX || o.minX > maxX || o.maxY < minY || o.minY > maxY)
+      continue;
+    if (MarkSeen(o.entityID))
+      continue;
+    if (count >= maxResults) {
+      s_truncatedQueries++;
+      s_truncatedTotal++;
+      return count;
+    }
+    results[count++] = o.entityID;
+  }
+  return count;
 }
 
 // ============================================================================
@@ -145,18 +207,26 @@ void SpatialHash_ClearDynamic(void) {
   // 0xFF is -1 in 2's complement, which matches UINT32_MAX
   memset(dynamicBuckets, 0xFF, sizeof(dynamicBuckets));
   dynamicPoolIdx = 0;
+  // Warn again only after a rebuild that fit
+  s_overflowWarned = s_overflowWarned && s_overflowCount > 0;
+  s_overflowCount = 0;
+  s_truncatedQueries = 0;
+  if (s_instrumented) {
+    memset(s_bucketContacts, 0, sizeof(s_bucketContacts));
+  }
 }
 
 void SpatialHash_ClearAll(void) {
   // Clear Buckets (Fast SIMD wipe)
   // 0xFF sets all bits to 1, creating UINT32_MAX
-  memset(staticBuckets, 0xFF, sizeof(staticBuckets));
+  memset(s_staticLayer.buckets, 0xFF, sizeof(s_staticLayer.buckets));
   memset(dynamicBuckets, 0xFF, sizeof(dynamicBuckets));
 
   // Reset pools and free-list
-  staticPoolIdx = 0;
+  s_staticLayer.poolIdx = 0;
   dynamicPoolIdx = 0;
-  staticFreeHead = SPATIAL_NULL_IDX;
+  s_overflowCount = 0;
+  s_staticLayer.freeHead = SPATIAL_NULL_IDX;
 }
 
 // ============================================================================
@@ -178,11 +248,11 @@ void SpatialHash_AddStatic(uint32_t entityID, int x, int y, int width,
       if (nodeIdx == SPATIAL_NULL_IDX)
         return;
 
-      staticNodes[nodeIdx].entityID = entityID;
-      staticNodes[nodeIdx].gridX = cx;
-      staticNodes[nodeIdx].gridY = cy;
-      staticNodes[nodeIdx].nextIdx = staticBuckets[bucketIndex];
-      staticBuckets[bucketIndex] = nodeIdx;
+      s_staticLayer.nodes[nodeIdx].entityID = entityID;
+      s_staticLayer.nodes[nodeIdx].gridX = cx;
+      s_staticLayer.nodes[nodeIdx].gridY = cy;
+      s_staticLayer.nodes[nodeIdx].nextIdx = s_staticLayer.buckets[bucketIndex];
+      s_staticLayer.buckets[bucketIndex] = nodeIdx;
     }
   }
 }
@@ -194,6 +264,14 @@ void SpatialHash_AddDynamic(uint32_t entityID, int x, int y, int width,
   const int maxX = WORLD_TO_GRID(x + width);
   const int maxY = WORLD_TO_GRID(y + height);
 
+  // All cells or none: a partially inserted body would miss some queries
+  const uint32_t cells = static_cast<uint32_t>(maxX - minX + 1) *
+                         static_cast<uint32_t>(maxY - minY + 1);
+  if (cells > SPATIAL_MAX_DYNAMIC - dynamicPoolIdx) {
+    AddDynamicOverflow(entityID, minX, minY, maxX, maxY);
+    return;
+  }
+
   for (int32_t cy = minY; cy <= maxY; cy++) {
     // #4 Optimization: Precompute y-component of hash once per row
     const unsigned int hy = static_cast<unsigned int>(cy) * 19349663;
@@ -203,10 +281,7 @@ void SpatialHash_AddDynamic(uint32_t entityID, int x, int y, int width,
       const unsigned int hx = static_cast<unsigned int>(cx) * 73856093;
       const int bucketIndex = static_cast<int>(((hx ^ hy) & SPATIAL_HASH_MASK));
 
-      uint32_t nodeIdx = PopDynamicNode();
-      if (nodeIdx == SPATIAL_NULL_IDX)
-        return;
-
+      const uint32_t nodeIdx = dynamicPoolIdx++;
       dynamicNodes[nodeIdx].entityID = entityID;
       dynamicNodes[nodeIdx].gridX = cx;
       dynamicNodes[nodeIdx].gridY = cy;
@@ -232,10 +307,10 @@ void SpatialHash_RemoveStatic(uint32_t entityID, int x, int y, int width,
       int bucketIndex = GetHashIndex(cx, cy);
 
       uint32_t prev = SPATIAL_NULL_IDX;
-      uint32_t curr = staticBuckets[bucketIndex];
+      uint32_t curr = s_staticLayer.buckets[bucketIndex];
 
       while (curr != SPATIAL_NULL_IDX) {
-        SpatialNode *node = &staticNodes[curr];
+        SpatialNode *node = &s_staticLayer.nodes[curr];
         uint32_t next = node->nextIdx;
 
         // Match by entityID and cell coordinates
@@ -243,9 +318,9 @@ void SpatialHash_RemoveStatic(uint32_t entityID, int x, int y, int width,
             node->gridY == cy) {
           // Unlink from list
           if (prev == SPATIAL_NULL_IDX) {
-            staticBuckets[bucketIndex] = next;
+            s_staticLayer.buckets[bucketIndex] = next;
           } else {
-            staticNodes[prev].nextIdx = next;
+            s_staticLayer.nodes[prev].nextIdx = next;
           }
           // Recycle node
           PushStaticFree(curr);
@@ -282,14 +357,17 @@ int SpatialHash_Query(int x, int y, int width, int height, uint32_t *results,
       const int bucketIndex = GetHashIndex(cx, cy);
 
       // Query static layer
-      uint32_t curr = staticBuckets[bucketIndex];
+      uint32_t curr = s_staticLayer.buckets[bucketIndex];
       while (curr != SPATIAL_NULL_IDX) {
-        SpatialNode *node = &staticNodes[curr];
+        SpatialNode *node = &s_staticLayer.nodes[curr];
         if (node->gridX == cx && node->gridY == cy) {
           // #1 Optimization: O(1) duplicate check via timestamp
           if (!MarkSeen(node->entityID)) {
-            if (count >= maxResults)
+            if (count >= maxResults) {
+              s_truncatedQueries++;
+              s_truncatedTotal++;
               return count;
+            }
             results[count++] = node->entityID;
           }
         }
@@ -303,8 +381,11 @@ int SpatialHash_Query(int x, int y, int width, int height, uint32_t *results,
         if (node->gridX == cx && node->gridY == cy) {
           // #1 Optimization: O(1) duplicate check via timestamp
           if (!MarkSeen(node->entityID)) {
-            if (count >= maxResults)
+            if (count >= maxResults) {
+              s_truncatedQueries++;
+              s_truncatedTotal++;
               return count;
+            }
             results[count++] = node->entityID;
           }
         }
@@ -313,5 +394,147 @@ int SpatialHash_Query(int x, int y, int width, int height, uint32_t *results,
     }
   }
 
-  return count;
+  return QueryOverflow(minX, minY, maxX, maxY, results, count, maxResults);
+}
+
+int SpatialHash_QueryDynamic(int x, int y, int width, int height,
+                             uint32_t *results, int maxResults) {
+  AdvanceQueryFrame();
+
+  int count = 0;
+
+  const int minX = WORLD_TO_GRID(x);
+  const int minY = WORLD_TO_GRID(y);
+  const int maxX = WORLD_TO_GRID(x + width);
+  const int maxY = WORLD_TO_GRID(y + height);
+
+  for (int cy = minY; cy <= maxY; cy++) {
+    for (int cx = minX; cx <= maxX; cx++) {
+      uint32_t curr = dynamicBuckets[GetHashIndex(cx, cy)];
+      while (curr != SPATIAL_NULL_IDX) {
+        SpatialNode *node = &dynamicNodes[curr];
+        if (node->gridX == cx && node->gridY == cy) {
+          if (!MarkSeen(node->entityID)) {
+            if (count >= maxResults) {
+              s_truncatedQueries++;
+              s_truncatedTotal++;
+              return count;
+            }
+            results[count++] = node->entityID;
+          }
+        }
+        curr = node->nextIdx;
+      }
+    }
+  }
+
+  return QueryOverflow(minX, minY, maxX, maxY, results, count, maxResults);
+}
+
+// ============================================================================
+// Instrumentation
+// ============================================================================
+
+void SpatialHash_SetInstrumentation(bool enabled) {
+  if (enabled && !s_instrumented) {
+    memset(s_bucketContacts, 0, sizeof(s_bucketContacts));
+  }
+  s_instrumented = enabled;
+}
+
+bool SpatialHash_IsInstrumented(void) { return s_instrumented; }
+
+void SpatialHash_AddContacts(int x, int y, uint32_t count) {
+  if (s_instrumented) {
+    s_bucketContacts[GetHashIndex(WORLD_TO_GRID(x), WORLD_TO_GRID(y))] +=
+        count;
+  }
+}
+
+uint32_t SpatialHash_GetTruncatedTotal(void) { return s_truncatedTotal; }
+
+SpatialHashStats SpatialHash_GetStats(void) {
+  SpatialHashStats stats = {.nodes = dynamicPoolIdx,
+                            .overflowBodies = s_overflowCount,
+                            .usedBuckets = 0,
+                            .maxChain = 0,
+                            .avgChain = 0.0f,
+                            .collidedBuckets = 0,
+                            .collidedCells = 0,
+                            .truncatedQueries = s_truncatedQueries,
+                            .maxBucketContacts = 0};
+
+  uint32_t chainSum = 0;
+  for (uint32_t b = 0; b < SPATIAL_HASH_SIZE; b++) {
+    if (s_bucketContacts[b] > stats.maxBucketContacts) {
+      stats.maxBucketContacts = s_bucketContacts[b];
+    }
+
+    uint32_t curr = dynamicBuckets[b];
+    if (curr == SPATIAL_NULL_IDX)
+      continue;
+
+    // Distinct cells, saturating at SPATIAL_STATS_MAX_CELLS
+    int32_t cellX[SPATIAL_STATS_MAX_CELLS];
+    int32_t cellY[SPATIAL_STATS_MAX_CELLS];
+    uint32_t cells = 0;
+    uint32_t chain = 0;
+    while (curr != SPATIAL_NULL_IDX) {
+      const SpatialNode *node = &dynamicNodes[curr];
+      bool known = false;
+      for (uint32_t c = 0; c < cells; c++) {
+        if (cellX[c] == node->gridX && cellY[c] == node->gridY) {
+          known = true;
+          break;
+        }
+      }
+      if (!known && cells < SPATIAL_STATS_MAX_CELLS) {
+        cellX[cells] = node->gridX;
+        cellY[cells] = node->gridY;
+        cells++;
+      }
+      chain++;
+      curr = node->nextIdx;
+    }
+
+    stats.usedBuckets++;
+    chainSum += chain;
+    if (chain > stats.maxChain) {
+      stats.maxChain = chain;
+    }
+    if (cells > 1) {
+      stats.collidedBuckets++;
+      stats.collidedCells += cells - 1;
+    }
+  }
+
+  if (stats.usedBuckets > 0) {
+    stats.avgChain = static_cast<float>(chainSum) /
+                     static_cast<float>(stats.usedBuckets);
+  }
+  return stats;
+}
+
+SpatialCellLoad SpatialHash_GetCellLoad(int cellX, int cellY) {
+  const int bucketIndex = GetHashIndex(cellX, cellY);
+  SpatialCellLoad load = {.cellNodes = 0,
+                          .bucketNodes = 0,
+                          .contacts = s_bucketContacts[bucketIndex]};
+
+  uint32_t curr = dynamicBuckets[bucketIndex];
+  while (curr != SPATIAL_NULL_IDX) {
+    const SpatialNode *node = &dynamicNodes[curr];
+    if (node->gridX == cellX && node->gridY == cellY) {
+      load.cellNodes++;
+    }
+    load.bucketNodes++;
+    curr = node->nextIdx;
+  }
+  return load;
+}
+
+void SpatialHash_GetSimState(SimStateBlock *out) {
+  *out = {.name = "spatial.static",
+          .base = &s_staticLayer,
+          .size = sizeof(s_staticLayer)};
 }
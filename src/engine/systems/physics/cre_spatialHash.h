@@ -1,8 +1,11 @@
 #ifndef CRE_SPATIALHASH_H
 #define CRE_SPATIALHASH_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+struct SimStateBlock;
+
 /**
  * @brief Index-linked spatial node for dual-layer spatial hash.
  *
@@ -17,6 +20,33 @@ typedef struct SpatialNode {
   uint32_t _padding; ///< Padding to 16 bytes
 } SpatialNode;
 
+/**
+ * @brief Dynamic layer load since the last SpatialHash_ClearDynamic.
+ *
+ * A bucket "collides" when nodes of two or more distinct cells hash into it:
+ * every query of one of those cells also walks the other cells' nodes.
+ */
+typedef struct {
+  uint32_t nodes;             ///< Dynamic nodes inserted
+  uint32_t overflowBodies;    ///< Bodies past the node pool (brute force)
+  uint32_t usedBuckets;       ///< Buckets holding at least one node
+  uint32_t maxChain;          ///< Longest bucket chain (nodes)
+  float avgChain;             ///< Mean chain length over used buckets
+  uint32_t collidedBuckets;   ///< Buckets shared by distinct cells
+  uint32_t collidedCells;     ///< Extra cells in those buckets (>= 1 each)
+  uint32_t truncatedQueries;  ///< Queries that stopped at maxResults
+  uint32_t maxBucketContacts; ///< Densest bucket (instrumented only)
+} SpatialHashStats;
+
+/**
+ * @brief Load of one grid cell, for heatmaps.
+ */
+typedef struct {
+  uint32_t cellNodes;   ///< Dynamic nodes in this cell
+  uint32_t bucketNodes; ///< Nodes a query of this cell walks (whole chain)
+  uint32_t contacts;    ///< Contacts recorded in the cell's bucket
+} SpatialCellLoad;
+
 // ============================================================================
 // Dynamic Layer API (cleared every frame)
 // ============================================================================
@@ -29,6 +59,9 @@ void SpatialHash_ClearDynamic(void);
 /**
  * @brief Adds a dynamic entity to the spatial hash (inv_mass > 0).
  *
+ * A body whose cells do not fit the node pool is kept on an overflow list
+ * that every query tests by cell range (logged once): slower, never lost.
+ *
  * @param entityID Entity identifier
  * @param x World X position
  * @param y World Y position
@@ -99,4 +132,53 @@ void SpatialHash_ClearAll(void);
 int SpatialHash_Query(int x, int y, int width, int height, uint32_t *results,
                       int maxResults);
 
+/**
+ * @brief Queries only the dynamic layer. Physics uses this together with the
+ * compiled static colliders (see cre_staticGeometry.h).
+ *
+ * @return Number of unique entities found
+ */
+int SpatialHash_QueryDynamic(int x, int y, int width, int height,
+                             uint32_t *results, int maxResults);
+
+// ============================================================================
+// Instrumentation API (tuning SPATIAL_GRID_SIZE / SPATIAL_HASH_SIZE)
+// ============================================================================
+
+/**
+ * @brief Enable per-bucket contact counting. Off by default: it costs a
+ * 64 KB clear per rebuild. Chain and truncation counters are always kept.
+ */
+void SpatialHash_SetInstrumentation(bool enabled);
+bool SpatialHash_IsInstrumented(void);
+
+/**
+ * @brief Record contacts found for a body at world (x, y). Contacts are
+ * binned by bucket, so cells that share a bucket share the count.
+ */
+void SpatialHash_AddContacts(int x, int y, uint32_t count);
+
+/**
+ * @brief Running count of truncated queries (never reset), so callers can
+ * measure their own queries by difference.
+ */
+uint32_t SpatialHash_GetTruncatedTotal(void);
+
+/**
+ * @brief Walk the dynamic buckets and fill the load counters.
+ * Debug cost (touches every bucket), call at most once per frame.
+ */
+SpatialHashStats SpatialHash_GetStats(void);
+
+/**
+ * @brief Load of a single grid cell (walks its bucket chain).
+ */
+SpatialCellLoad SpatialHash_GetCellLoad(int cellX, int cellY);
+
+/**
+ * @brief Static layer, for rollback (see cre_simState.h). The dynamic layer
+ * is rebuilt every step and is not part of the simulation state.
+ */
+void SpatialHash_GetSimState(SimStateBlock *out);
+
 #endif
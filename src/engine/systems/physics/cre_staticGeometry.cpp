@@ -0,0 +1,355 @@
+#include "cre_staticGeometry.h"
+#include "cre_spatialHash.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/core/cre_types.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+// ============================================================================
+// Configuration Constants
+// ============================================================================
+
+#define STATIC_MAX_COLLIDERS MAX_ENTITIES
+#define STATIC_MAX_GRID_NODES 40000
+#define STATIC_NULL_IDX UINT32_MAX
+#define STATIC_GRID_MASK (SPATIAL_HASH_SIZE - 1)
+#define STATIC_MERGE_EPSILON 0.01f
+#define STATIC_EDGE_QUERY_MAX 256
+
+#define WORLD_TO_GRID(val) ((val) >> SPATIAL_GRID_SHIFT)
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Compiled colliders + their grid. Rebuilt only on static changes,
+ * so rollback saves it as one simulation state block.
+ */
+struct StaticGeometryState {
+  StaticCollider colliders[STATIC_MAX_COLLIDERS];
+  uint32_t colliderCount;
+  // Collision grid (same chained layout as the spatial hash static layer)
+  uint32_t gridBuckets[SPATIAL_HASH_SIZE];
+  SpatialNode gridNodes[STATIC_MAX_GRID_NODES];
+  uint32_t gridPoolIdx;
+  uint32_t revision; // Bumped by every Clear/Build
+};
+
+static StaticGeometryState s_geo;
+
+// Timestamp deduplication for queries
+static uint32_t s_lastSeen[STATIC_MAX_COLLIDERS];
+static uint32_t s_queryStamp = 0;
+
+static inline uint32_t GetHashIndex(int cellX, int cellY) {
+  const unsigned int h1 = static_cast<unsigned int>(cellX) * 73856093;
+  const unsigned int h2 = static_cast<unsigned int>(cellY) * 19349663;
+  return (h1 ^ h2) & STATIC_GRID_MASK;
+}
+
+static inline bool NearlyEqual(float a, float b) {
+  return fabsf(a - b) < STATIC_MERGE_EPSILON;
+}
+
+// Colliders merge only when everything but the geometry matches.
+static inline uint64_t MergeKey(const StaticCollider &c) {
+  return (static_cast<uint64_t>(c.isCircle) << 40) |
+         (static_cast<uint64_t>(c.material) << 32) |
+         (static_cast<uint64_t>(c.mask) << 16) | c.layer;
+}
+
+// ============================================================================
+// Greedy Rectangle Decomposition
+// ============================================================================
+
+uint32_t StaticGeometry_MergeRects(StaticCollider *colliders, uint32_t count) {
+  if (count < 2)
+    return count;
+
+  // Pass 1: horizontal runs (same key, y and height; touching along x).
+  std::sort(colliders, colliders + count,
+            [](const StaticCollider &a, const StaticCollider &b) {
+              const uint64_t ka = MergeKey(a);
+              const uint64_t kb = MergeKey(b);
+              if (ka != kb)
+                return ka < kb;
+              if (a.y != b.y)
+                return a.y < b.y;
+              if (a.h != b.h)
+                return a.h < b.h;
+              return a.x < b.x;
+            });
+
+  uint32_t out = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    const StaticCollider &c = colliders[i];
+    if (out > 0) {
+      StaticCollider &run = colliders[out - 1];
+      if (!c.isCircle && MergeKey(run) == MergeKey(c) &&
+          NearlyEqual(run.y, c.y) && NearlyEqual(run.h, c.h) &&
+          NearlyEqual(run.x + run.w, c.x)) {
+        run.w = (c.x + c.w) - run.x;
+        run.ownerID = std::min(run.ownerID, c.ownerID);
+        continue;
+      }
+    }
+    colliders[out++] = c;
+  }
+  count = out;
+
+  // Pass 2: stack the runs vertically (same key, x and width).
+  std::sort(colliders, colliders + count,
+            [](const StaticCollider &a, const StaticCollider &b) {
+              const uint64_t ka = MergeKey(a);
+              const uint64_t kb = MergeKey(b);
+              if (ka != kb)
+                return ka < kb;
+              if (a.x != b.x)
+                return a.x < b.x;
+              if (a.w != b.w)
+                return a.w < b.w;
+              return a.y < b.y;
+            });
+
+  out = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    const StaticCollider &c = colliders[i];
+    if (out > 0) {
+      StaticCollider &run = colliders[out - 1];
+      if (!c.isCircle && MergeKey(run) == MergeKey(c) &&
+          NearlyEqual(run.x, c.x) && NearlyEqual(run.w, c.w) &&
+          NearlyEqual(run.y + run.h, c.y)) {
+        run.h = (c.y + c.h) - run.y;
+        run.ownerID = std::min(run.ownerID, c.ownerID);
+        continue;
+      }
+    }
+    colliders[out++] = c;
+  }
+
+  return out;
+}
+
+// ============================================================================
+// Collision Grid
+// ============================================================================
+
+static void StaticGeometry_ClearGrid(void) {
+  memset(s_geo.gridBuckets, 0xFF, sizeof(s_geo.gridBuckets));
+  s_geo.gridPoolIdx = 0;
+}
+
+static void StaticGeometry_GridInsert(uint32_t colliderIdx,
+                                      const StaticCollider &c) {
+  const int minX = WORLD_TO_GRID(static_cast<int>(c.x));
+  const int minY = WORLD_TO_GRID(static_cast<int>(c.y));
+  const int maxX = WORLD_TO_GRID(static_cast<int>(c.x + c.w));
+  const int maxY = WORLD_TO_GRID(static_cast<int>(c.y + c.h));
+
+  for (int cy = minY; cy <= maxY; cy++) {
+    for (int cx = minX; cx <= maxX; cx++) {
+      if (s_geo.gridPoolIdx >= STATIC_MAX_GRID_NODES) {
+        Log(LogLevel::Warning, "Static collider grid pool is FULL.");
+        return;
+      }
+      const uint32_t bucket = GetHashIndex(cx, cy);
+      const uint32_t nodeIdx = s_geo.gridPoolIdx++;
+      s_geo.gridNodes[nodeIdx].entityID = colliderIdx;
+      s_geo.gridNodes[nodeIdx].gridX = cx;
+      s_geo.gridNodes[nodeIdx].gridY = cy;
+      s_geo.gridNodes[nodeIdx].nextIdx = s_geo.gridBuckets[bucket];
+      s_geo.gridBuckets[bucket] = nodeIdx;
+    }
+  }
+}
+
+int StaticGeometry_Query(int x, int y, int width, int height,
+                         uint32_t *results, int maxResults) {
+  if (s_geo.colliderCount == 0)
+    return 0;
+
+  s_queryStamp++;
+  if (s_queryStamp == 0) {
+    memset(s_lastSeen, 0, sizeof(s_lastSeen));
+    s_queryStamp = 1;
+  }
+
+  int count = 0;
+  const int minX = WORLD_TO_GRID(x);
+  const int minY = WORLD_TO_GRID(y);
+  const int maxX = WORLD_TO_GRID(x + width);
+  const int maxY = WORLD_TO_GRID(y + height);
+
+  for (int cy = minY; cy <= maxY; cy++) {
+    for (int cx = minX; cx <= maxX; cx++) {
+      uint32_t curr = s_geo.gridBuckets[GetHashIndex(cx, cy)];
+      while (curr != STATIC_NULL_IDX) {
+        const SpatialNode *node = &s_geo.gridNodes[curr];
+        if (node->gridX == cx && node->gridY == cy &&
+            s_lastSeen[node->entityID] != s_queryStamp) {
+          s_lastSeen[node->entityID] = s_queryStamp;
+          if (count >= maxResults)
+            return count;
+          results[count++] = node->entityID;
+        }
+        curr = node->nextIdx;
+      }
+    }
+  }
+  return count;
+}
+
+// ============================================================================
+// Edge Chains (exposed faces)
+// ============================================================================
+
+/**
+ * @brief Mark faces that are fully covered by touching neighbours as
+ * internal. Colliders do not overlap after merging, so summing the touching
+ * spans is enough to decide full coverage.
+ */
+static void StaticGeometry_BuildEdges(void) {
+  uint32_t neighbours[STATIC_EDGE_QUERY_MAX];
+
+  for (uint32_t i = 0; i < s_geo.colliderCount; ++i) {
+    StaticCollider &r = s_geo.colliders[i];
+    r.edgeMask = STATIC_EDGE_ALL;
+    if (r.isCircle)
+      continue;
+
+    const int count = StaticGeometry_Query(
+        static_cast<int>(r.x) - 1, static_cast<int>(r.y) - 1,
+        static_cast<int>(r.w) + 2, static_cast<int>(r.h) + 2, neighbours,
+        STATIC_EDGE_QUERY_MAX);
+
+    float coverLeft = 0.0f, coverRight = 0.0f;
+    float coverTop = 0.0f, coverBottom = 0.0f;
+
+    for (int k = 0; k < count; ++k) {
+      const uint32_t j = neighbours[k];
+      if (j == i)
+        continue;
+      const StaticCollider &o = s_geo.colliders[j];
+      if (o.isCircle)
+        continue;
+
+      const float spanY = fminf(r.y + r.h, o.y + o.h) - fmaxf(r.y, o.y);
+      const float spanX = fminf(r.x + r.w, o.x + o.w) - fmaxf(r.x, o.x);
+
+      if (spanY > 0.0f) {
+        if (NearlyEqual(o.x + o.w, r.x))
+          coverLeft += spanY;
+        if (NearlyEqual(r.x + r.w, o.x))
+          coverRight += spanY;
+      }
+      if (spanX > 0.0f) {
+        if (NearlyEqual(o.y + o.h, r.y))
+          coverTop += spanX;
+        if (NearlyEqual(r.y + r.h, o.y))
+          coverBottom += spanX;
+      }
+    }
+
+    if (coverLeft >= r.h - STATIC_MERGE_EPSILON)
+      r.edgeMask &= static_cast<uint8_t>(~STATIC_EDGE_LEFT);
+    if (coverRight >= r.h - STATIC_MERGE_EPSILON)
+      r.edgeMask &= static_cast<uint8_t>(~STATIC_EDGE_RIGHT);
+    if (coverTop >= r.w - STATIC_MERGE_EPSILON)
+      r.edgeMask &= static_cast<uint8_t>(~STATIC_EDGE_TOP);
+    if (coverBottom >= r.w - STATIC_MERGE_EPSILON)
+      r.edgeMask &= static_cast<uint8_t>(~STATIC_EDGE_BOTTOM);
+  }
+}
+
+// ============================================================================
+// Build / Clear
+// ============================================================================
+
+void StaticGeometry_Clear(void) {
+  s_geo.colliderCount = 0;
+  s_geo.revision++;
+  StaticGeometry_ClearGrid();
+}
+
+void StaticGeometry_Build(const physicsPacket *packet) {
+  const uint32_t bound = packet->max_used_bound;
+  const creVec2 *restrict const p_pos = packet->write.pos;
+  const creVec2 *restrict const p_size = packet->read.size;
+  const uint64_t *restrict const p_flags = packet->write.state_flags;
+  const uint64_t *restrict const p_comps = packet->read.component_masks;
+  const uint8_t *restrict const p_material = packet->write.material_id;
+
+  const uint64_t reqFlags = FLAG_ACTIVE | FLAG_STATIC;
+  const uint64_t shapeComps = COMP_COLLISION_AABB | COMP_COLLISION_Circle;
+
+  StaticGeometry_Clear();
+
+  uint32_t bodyCount = 0;
+  for (uint32_t i = 0; i < bound; i++) {
+    if ((p_flags[i] & reqFlags) != reqFlags)
+      continue;
+    if (!(p_comps[i] & COMP_PHYSICS) || !(p_comps[i] & shapeComps))
+      continue;
+    if (bodyCount >= STATIC_MAX_COLLIDERS)
+      break;
+
+    StaticCollider &c = s_geo.colliders[bodyCount++];
+    c.x = p_pos[i].x;
+    c.y = p_pos[i].y;
+    c.w = p_size[i].x;
+    c.h = (p_comps[i] & COMP_COLLISION_AABB) ? p_size[i].y : p_size[i].x;
+    c.ownerID = i;
+    c.layer = static_cast<uint16_t>(GET_LAYER(p_flags[i]));
+    c.mask = static_cast<uint16_t>(GET_MASK(p_flags[i]));
+    c.material = p_material[i];
+    c.edgeMask = STATIC_EDGE_ALL;
+    c.isCircle = (p_comps[i] & COMP_COLLISION_AABB) ? 0 : 1;
+    c._padding = 0;
+  }
+
+  s_geo.colliderCount = StaticGeometry_MergeRects(s_geo.colliders, bodyCount);
+
+  for (uint32_t i = 0; i < s_geo.colliderCount; ++i) {
+    StaticGeometry_GridInsert(i, s_geo.colliders[i]);
+  }
+  StaticGeometry_BuildEdges();
+
+  Log(LogLevel::Info, "Compiled {} static bodies into {} colliders",
+      bodyCount, s_geo.colliderCount);
+}
+
+const StaticCollider *StaticGeometry_Get(uint32_t index) {
+  assert(index < s_geo.colliderCount && "Static collider index out of range");
+  return &s_geo.colliders[index];
+}
+
+uint32_t StaticGeometry_GetRevision(void) { return s_geo.revision; }
+
+StaticCellRange StaticGeometry_GetCellRange(const StaticCollider &collider,
+                                            float cellSize, int32_t width,
+                                            int32_t height) {
+  const float inv = 1.0f / cellSize;
+  const int32_t minX = static_cast<int32_t>(floorf(collider.x * inv));
+  const int32_t minY = static_cast<int32_t>(floorf(collider.y * inv));
+  const int32_t maxX =
+      static_cast<int32_t>(ceilf((collider.x + collider.w) * inv)) - 1;
+  const int32_t maxY =
+      static_cast<int32_t>(ceilf((collider.y + collider.h) * inv)) - 1;
+  return StaticCellRange{.minX = std::max(minX, 0),
+                         .minY = std::max(minY, 0),
+                         .maxX = std::min(maxX, width - 1),
+                         .maxY = std::min(maxY, height - 1)};
+}
+
+uint32_t StaticGeometry_Count(void) { return s_geo.colliderCount; }
+
+void StaticGeometry_GetSimState(SimStateBlock *out) {
+  *out = {.name = "physics.static", .base = &s_geo, .size = sizeof(s_geo)};
+}
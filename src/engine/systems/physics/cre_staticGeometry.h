@@ -0,0 +1,130 @@
+/**
+ * @file cre_staticGeometry.h
+ * @brief Static Geometry Compiler (Merged Colliders + Collision Grid)
+ *
+ * Static bodies are compiled into a compact collider list when
+ * CMD_PHYS_LOAD_STATIC runs:
+ *   1. Collect active FLAG_STATIC bodies with an AABB or Circle shape.
+ *   2. Greedy rectangle decomposition: merge horizontal runs of AABBs that
+ *      share y/height, then merge vertical runs that share x/width. Only
+ *      bodies with identical layer, mask and material are merged.
+ *   3. Edge chains: every merged rectangle records which of its four faces
+ *      border open space. Faces shared with another collider are internal
+ *      and never used as a contact normal (no snagging on tile seams).
+ *   4. Colliders are inserted into a dedicated, persistent collision grid.
+ *
+ * The renderer keeps using the per-entity static layer of the spatial hash;
+ * physics queries the compiled colliders instead. Contacts reference the
+ * collider's owner entity (first body of the merged group) for material
+ * and inverse mass lookups.
+ */
+
+#ifndef CRE_STATICGEOMETRY_H
+#define CRE_STATICGEOMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct physicsPacket;
+struct SimStateBlock;
+
+// Exposed-face bits (StaticCollider::edgeMask)
+constexpr uint8_t STATIC_EDGE_LEFT = (1 << 0);
+constexpr uint8_t STATIC_EDGE_RIGHT = (1 << 1);
+constexpr uint8_t STATIC_EDGE_TOP = (1 << 2);
+constexpr uint8_t STATIC_EDGE_BOTTOM = (1 << 3);
+constexpr uint8_t STATIC_EDGE_ALL =
+    (STATIC_EDGE_LEFT | STATIC_EDGE_RIGHT | STATIC_EDGE_TOP |
+     STATIC_EDGE_BOTTOM);
+
+/**
+ * @brief One compiled static collider (merged rectangle or single circle).
+ */
+typedef struct StaticCollider {
+  float x; ///< Top-left X
+  float y; ///< Top-left Y
+  float w; ///< Width (diameter for circles)
+  float h; ///< Height
+  uint32_t ownerID;  ///< Representative entity (material, inv_mass)
+  uint16_t layer;    ///< Collision layer bits
+  uint16_t mask;     ///< Collision mask bits
+  uint8_t material;  ///< Material id shared by the merged group
+  uint8_t edgeMask;  ///< STATIC_EDGE_* faces exposed to open space
+  uint8_t isCircle;  ///< 1 = circle collider (never merged)
+  uint8_t _padding;
+} StaticCollider;
+
+/**
+ * @brief Inclusive cell bounds (empty when max < min).
+ */
+struct StaticCellRange {
+  int32_t minX;
+  int32_t minY;
+  int32_t maxX;
+  int32_t maxY;
+};
+
+/**
+ * @brief Greedy rectangle decomposition, in place. Usable offline.
+ *
+ * Merges axis-aligned colliders that touch exactly and share the same
+ * layer/mask/material into maximal rectangles. Circles pass through.
+ *
+ * @param colliders Collider array (reordered and compacted)
+ * @param count     Number of input colliders
+ * @return Number of colliders after merging
+ */
+uint32_t StaticGeometry_MergeRects(StaticCollider *colliders, uint32_t count);
+
+/**
+ * @brief Compile static colliders from the registry and rebuild the grid.
+ * Called by CMD_PHYS_LOAD_STATIC and after static bodies were teleported.
+ */
+void StaticGeometry_Build(const physicsPacket *packet);
+
+/**
+ * @brief Drop every compiled collider (scene transitions, CMD_PHYS_RESET).
+ */
+void StaticGeometry_Clear(void);
+
+/**
+ * @brief Query compiled colliders overlapping an area.
+ *
+ * @param results    Output collider indices
+ * @param maxResults Capacity of results
+ * @return Number of unique colliders found
+ */
+int StaticGeometry_Query(int x, int y, int width, int height,
+                         uint32_t *results, int maxResults);
+
+/**
+ * @brief Access a compiled collider by index (from StaticGeometry_Query).
+ */
+const StaticCollider *StaticGeometry_Get(uint32_t index);
+
+/**
+ * @brief Number of compiled colliders.
+ */
+uint32_t StaticGeometry_Count(void);
+
+/**
+ * @brief Changes whenever the compiled colliders do (rebuild, clear or
+ * rollback restore). Lets derived grids (lighting, vision) resync lazily.
+ */
+uint32_t StaticGeometry_GetRevision(void);
+
+/**
+ * @brief Cells a collider overlaps on a grid of cellSize cells with its
+ * origin at world 0,0, clipped to width x height. Used to rasterize the
+ * colliders into derived grids.
+ */
+StaticCellRange StaticGeometry_GetCellRange(const StaticCollider &collider,
+                                            float cellSize, int32_t width,
+                                            int32_t height);
+
+/**
+ * @brief Compiled colliders + grid, for rollback (see cre_simState.h).
+ */
+void StaticGeometry_GetSimState(SimStateBlock *out);
+
+#endif
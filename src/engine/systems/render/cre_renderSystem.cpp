@@ -4,7 +4,9 @@
 #include "engine/core/cre_config.h"
 #include "engine/ecs/cre_entityRegistry.h"
 #include "engine/loaders/cre_assetManager.h"
+#include "engine/systems/light/cre_lightSystem.h"
 #include "engine/systems/physics/cre_spatialHash.h"
+#include "engine/systems/vision/cre_visionSystem.h"
 #include <algorithm>
 #include <assert.h>
 #include <math.h>
@@ -215,6 +217,10 @@ void renderSystem_DrawEntities(EntityRegistry &reg, creRectangle cullRect) {
       static_cast<int>(cullRect.width), static_cast<int>(cullRect.height),
       visibleEntities, MAX_VISIBLE_ENTITIES);
 
+  // Fog of war hides what the local team does not see (level geometry is
+  // always drawn)
+  const uint8_t fogTeam = VisionSystem_GetFogTeam();
+
   int sortCount = 0;
   for (int i = 0; i < visibleCount; i++) {
     const uint32_t id = visibleEntities[i];
@@ -224,6 +230,9 @@ void renderSystem_DrawEntities(EntityRegistry &reg, creRectangle cullRect) {
     const uint64_t flags = reg.state_flags[id];
     if ((flags & (FLAG_ACTIVE | FLAG_VISIBLE)) != (FLAG_ACTIVE | FLAG_VISIBLE))
       continue;
+    if (fogTeam != VISION_TEAM_NONE && !(flags & FLAG_STATIC) &&
+        !VisionSystem_IsVisible(fogTeam, reg.pos[id]))
+      continue;
 
     const float rawDepth = (reg.pos[id].x * g_WeightX) +
                            (reg.pos[id].y * g_WeightY) +
@@ -239,6 +248,7 @@ void renderSystem_DrawEntities(EntityRegistry &reg, creRectangle cullRect) {
   std::sort(sortKeys, sortKeys + sortCount,
             [](const SortKey &a, const SortKey &b) { return a < b; });
 
+  const bool lit = LightSystem_IsEnabled();
   int16_t lastBatch = -1;
   for (int i = 0; i < sortCount; i++) {
     const SortKey key = sortKeys[i];
@@ -263,8 +273,28 @@ void renderSystem_DrawEntities(EntityRegistry &reg, creRectangle cullRect) {
     // position.x += size.x * pivotX;
     // position.y += size.y * pivotY;
 
-    rendererCore_DrawSprite(spriteID, position, size, pivot, rotation, flipX,
-                            flipY, color);
+    if (lit) {
+      // Light sampled at the unrotated corners, interpolated across the quad
+      const float x0 = position.x - size.x * pivot.x;
+      const float y0 = position.y - size.y * pivot.y;
+      const creVec2 at[4] = {{x0, y0},
+                             {x0, y0 + size.y},
+                             {x0 + size.x, y0 + size.y},
+                             {x0 + size.x, y0}};
+      creColor corners[4];
+      for (int k = 0; k < 4; k++) {
+        const creColor light = LightSystem_Sample(at[k]);
+        corners[k] = creColor{
+            static_cast<uint8_t>((color.r * light.r + 127) / 255),
+            static_cast<uint8_t>((color.g * light.g + 127) / 255),
+            static_cast<uint8_t>((color.b * light.b + 127) / 255), color.a};
+      }
+      rendererCore_DrawSpriteShaded(spriteID, position, size, pivot, rotation,
+                                    flipX, flipY, corners);
+    } else {
+      rendererCore_DrawSprite(spriteID, position, size, pivot, rotation, flipX,
+                              flipY, color);
+    }
   }
   rendererCore_EndBatch();
 }
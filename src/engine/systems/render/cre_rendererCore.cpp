@@ -6,6 +6,8 @@
 #include "engine/platform/cre_viewport.h"
 #include "engine/systems/camera/cre_cameraUtils.h"
 #include "raylib.h"
+#include "rlgl.h"
+#include <math.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -18,6 +20,8 @@ typedef struct {
   RenderTexture2D canvas;
   Texture2D cachedAtlas;
   Texture2D currentTexture;
+  float atlasInvWidth;  /* Atlas quad stream, set by BeginAtlasQuads */
+  float atlasInvHeight;
   Shader currentShader;
   int32_t currentBlendMode;
   int32_t currentFilterMode;
@@ -119,27 +123,202 @@ void rendererCore_EndWorldMode(void) { EndMode2D(); }
  * Consolidated Sprite Draw
  * ─────────────────────────────────────────────────────────────────────────────
  */
+/*
+ * The atlas stores trimmed sprites: only the w x h visible pixels, found at
+ * (offX, offY) inside the origW x origH source image. size spans the source
+ * image, so the quad covers the trimmed part only, scaled by size / orig and
+ * placed at the scaled offset (mirrored when flipped). Transparent borders
+ * are never rasterized and trimmed sprites keep their proportions.
+ */
+typedef struct {
+  creRectangle src;   /* Atlas pixels */
+  creRectangle local; /* Relative to the top-left of size */
+  bool trimmed;
+} SpriteQuad;
+
+static SpriteQuad rendererCore_GetSpriteQuad(uint32_t spriteID, creVec2 size,
+                                             bool flipX, bool flipY) {
+  // remove this static_cast<int> after fixing spriteids type.
+  const SpriteMeta *meta = Asset_getSprite(static_cast<int>(spriteID));
+  const uint16_t origW = meta->origW ? meta->origW : meta->w;
+  const uint16_t origH = meta->origH ? meta->origH : meta->h;
+  const float scaleX = size.x / static_cast<float>(origW);
+  const float scaleY = size.y / static_cast<float>(origH);
+  const int32_t offX = flipX ? origW - meta->offX - meta->w : meta->offX;
+  const int32_t offY = flipY ? origH - meta->offY - meta->h : meta->offY;
+  return SpriteQuad{
+      .src = {static_cast<float>(meta->x), static_cast<float>(meta->y),
+              static_cast<float>(meta->w), static_cast<float>(meta->h)},
+      .local = {static_cast<float>(offX) * scaleX,
+                static_cast<float>(offY) * scaleY,
+                static_cast<float>(meta->w) * scaleX,
+                static_cast<float>(meta->h) * scaleY},
+      .trimmed = meta->w != origW || meta->h != origH};
+}
+
 void rendererCore_DrawSprite(uint32_t spriteID, creVec2 position, creVec2 size,
                              creVec2 pivot, float rotation, bool flipX,
                              bool flipY, creColor tint) {
-  // remove this static_cast<int> after fixing spriteids type.
-  creRectangle srcRect = Asset_getRect(static_cast<int>(spriteID));
+  const SpriteQuad quad =
+      rendererCore_GetSpriteQuad(spriteID, size, flipX, flipY);
 
-  float srcW = flipX ? -srcRect.width : srcRect.width;
-  float srcH = flipY ? -srcRect.height
-                     : srcRect.height; /* Inverted: default flips for RT */
+  float srcW = flipX ? -quad.src.width : quad.src.width;
+  float srcH = flipY ? -quad.src.height
+                     : quad.src.height; /* Inverted: default flips for RT */
 
-  creRectangle src = {srcRect.x, srcRect.y, srcW, srcH};
+  creRectangle src = {quad.src.x, quad.src.y, srcW, srcH};
 
-  creRectangle dest = {position.x, position.y, size.x, size.y};
+  creRectangle dest = {position.x, position.y, quad.local.width,
+                       quad.local.height};
 
-  /* Pivot: normalized (0-1) -> pixel offset */
-  creVec2 origin = {size.x * pivot.x, size.y * pivot.y};
+  /* Pivot: normalized (0-1) -> pixel offset, relative to the trimmed quad */
+  creVec2 origin = {size.x * pivot.x - quad.local.x,
+                    size.y * pivot.y - quad.local.y};
 
   DrawTexturePro(state.currentTexture, R_REC(src), R_REC(dest), R_VEC(origin),
                  rotation, R_COL(tint));
 }
 
+static creColor rendererCore_MixCorners(const creColor corners[4], float tx,
+                                        float ty) {
+  /* corners: TL, BL, BR, TR */
+  const float w[4] = {(1.0f - tx) * (1.0f - ty), (1.0f - tx) * ty, tx * ty,
+                      tx * (1.0f - ty)};
+  float r = 0.5f;
+  float g = 0.5f;
+  float b = 0.5f;
+  float a = 0.5f;
+  for (uint32_t i = 0; i < 4; i++) {
+    r += static_cast<float>(corners[i].r) * w[i];
+    g += static_cast<float>(corners[i].g) * w[i];
+    b += static_cast<float>(corners[i].b) * w[i];
+    a += static_cast<float>(corners[i].a) * w[i];
+  }
+  return creColor{static_cast<uint8_t>(r), static_cast<uint8_t>(g),
+                  static_cast<uint8_t>(b), static_cast<uint8_t>(a)};
+}
+
+/*
+ * Same quad as DrawTexturePro (flips, pivot, rotation), with the color set
+ * per vertex. Stays in the current rlgl batch like DrawTexturePro does.
+ */
+void rendererCore_DrawSpriteShaded(uint32_t spriteID, creVec2 position,
+                                   creVec2 size, creVec2 pivot, float rotation,
+                                   bool flipX, bool flipY,
+                                   const creColor corners[4]) {
+  const Texture2D texture = state.currentTexture;
+  if (texture.id == 0)
+    return;
+  const SpriteQuad quad =
+      rendererCore_GetSpriteQuad(spriteID, size, flipX, flipY);
+  const creRectangle src = quad.src;
+  const float invW = 1.0f / static_cast<float>(texture.width);
+  const float invH = 1.0f / static_cast<float>(texture.height);
+  float u0 = src.x * invW;
+  float u1 = (src.x + src.width) * invW;
+  float v0 = src.y * invH;
+  float v1 = (src.y + src.height) * invH;
+  if (flipX) {
+    const float u = u0;
+    u0 = u1;
+    u1 = u;
+  }
+  if (flipY) {
+    const float v = v0;
+    v0 = v1;
+    v1 = v;
+  }
+
+  /* Corners relative to the pivot, then rotated around it */
+  const float dx = quad.local.x - size.x * pivot.x;
+  const float dy = quad.local.y - size.y * pivot.y;
+  const float w = quad.local.width;
+  const float h = quad.local.height;
+  const float xs[4] = {dx, dx, dx + w, dx + w};
+  const float ys[4] = {dy, dy + h, dy + h, dy};
+  const float us[4] = {u0, u0, u1, u1};
+  const float vs[4] = {v0, v1, v1, v0};
+  float c = 1.0f;
+  float s = 0.0f;
+  if (rotation != 0.0f) {
+    c = cosf(rotation * DEG2RAD);
+    s = sinf(rotation * DEG2RAD);
+  }
+
+  /* A trimmed quad is inside size: its corners take the mixed colors */
+  creColor colors[4] = {corners[0], corners[1], corners[2], corners[3]};
+  if (quad.trimmed && size.x > 0.0f && size.y > 0.0f) {
+    const float x0 = quad.local.x / size.x;
+    const float y0 = quad.local.y / size.y;
+    const float x1 = (quad.local.x + w) / size.x;
+    const float y1 = (quad.local.y + h) / size.y;
+    colors[0] = rendererCore_MixCorners(corners, x0, y0);
+    colors[1] = rendererCore_MixCorners(corners, x0, y1);
+    colors[2] = rendererCore_MixCorners(corners, x1, y1);
+    colors[3] = rendererCore_MixCorners(corners, x1, y0);
+  }
+
+  rlSetTexture(texture.id);
+  rlBegin(RL_QUADS);
+  rlNormal3f(0.0f, 0.0f, 1.0f);
+  for (uint32_t i = 0; i < 4; i++) {
+    rlColor4ub(colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+    rlTexCoord2f(us[i], vs[i]);
+    rlVertex2f(position.x + xs[i] * c - ys[i] * s,
+               position.y + xs[i] * s + ys[i] * c);
+  }
+  rlEnd();
+  rlSetTexture(0);
+}
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ * Atlas Quad Stream
+ * ─────────────────────────────────────────────────────────────────────────────
+ * Same vertices DrawTexturePro emits for an unrotated quad, without the
+ * per-quad rlBegin/rlEnd. rlgl flushes on texture changes only, so glyphs
+ * drawn after sprites stay in their batch.
+ */
+bool rendererCore_BeginAtlasQuads(creColor tint) {
+  const Texture2D atlas = state.cachedAtlas;
+  if (atlas.id == 0)
+    return false;
+  state.atlasInvWidth = 1.0f / static_cast<float>(atlas.width);
+  state.atlasInvHeight = 1.0f / static_cast<float>(atlas.height);
+
+  rlSetTexture(atlas.id);
+  rlBegin(RL_QUADS);
+  rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+  rlNormal3f(0.0f, 0.0f, 1.0f);
+  return true;
+}
+
+void rendererCore_AtlasTint(creColor tint) {
+  rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+}
+
+void rendererCore_AtlasQuad(creRectangle src, creRectangle dest) {
+  const float u0 = src.x * state.atlasInvWidth;
+  const float v0 = src.y * state.atlasInvHeight;
+  const float u1 = (src.x + src.width) * state.atlasInvWidth;
+  const float v1 = (src.y + src.height) * state.atlasInvHeight;
+  const float x1 = dest.x + dest.width;
+  const float y1 = dest.y + dest.height;
+
+  rlTexCoord2f(u0, v0);
+  rlVertex2f(dest.x, dest.y);
+  rlTexCoord2f(u0, v1);
+  rlVertex2f(dest.x, y1);
+  rlTexCoord2f(u1, v1);
+  rlVertex2f(x1, y1);
+  rlTexCoord2f(u1, v0);
+  rlVertex2f(x1, dest.y);
+}
+
+void rendererCore_EndAtlasQuads(void) {
+  rlEnd();
+  rlSetTexture(0);
+}
+
 void rendererCore_SetState(Texture2D *texture, Shader *shader,
                            int32_t blendMode, int32_t filterMode) {
   EndShaderMode();
@@ -34,11 +34,30 @@ void rendererCore_BeginWorldMode(const CameraComponent *cam, ViewportSize vp);
 void rendererCore_EndWorldMode(void);
 
 /* Consolidated sprite draw
+ * - size: the sprite's original (untrimmed) image scaled to the entity; only
+ *   the trimmed pixels are drawn, at their offset inside it
  * - pivot: normalized (0,0)=top-left, (0.5,0.5)=center, (1,1)=bottom-right */
 void rendererCore_DrawSprite(uint32_t spriteID, creVec2 position, creVec2 size,
                              creVec2 pivot, float rotation, bool flipX,
                              bool flipY, creColor tint);
 
+/* DrawSprite with one color per corner (light map shading)
+ * - corners: top-left, bottom-left, bottom-right, top-right of size before
+ *   rotation; each is the tint already multiplied by its light. Trimmed
+ *   quads interpolate them at their own corners. */
+void rendererCore_DrawSpriteShaded(uint32_t spriteID, creVec2 position,
+                                   creVec2 size, creVec2 pivot, float rotation,
+                                   bool flipX, bool flipY,
+                                   const creColor corners[4]);
+
+/* Atlas quad stream (text glyphs)
+ * - Same texture as the sprites: the quads share the sprite draw call.
+ * - No pivot, rotation or flip. Begin returns false if no atlas is loaded. */
+bool rendererCore_BeginAtlasQuads(creColor tint);
+void rendererCore_AtlasTint(creColor tint); /* For the following quads */
+void rendererCore_AtlasQuad(creRectangle src, creRectangle dest);
+void rendererCore_EndAtlasQuads(void);
+
 void rendererCore_SetState(Texture2D *texture, Shader *shader,
                            int32_t blendMode, int32_t filterMode);
 
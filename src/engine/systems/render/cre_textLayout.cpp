@@ -0,0 +1,77 @@
+#include "cre_textLayout.h"
+#include "assets/atlas/atlas_data.h"
+
+static constexpr int32_t TEXT_LINE_SPACING = 2; // raylib's default
+static constexpr uint8_t TEXT_FALLBACK_GLYPH = '?' - FONT_FIRST_CHAR;
+
+static_assert(FONT_GLYPH_COUNT <= 0xFF, "Glyph indices are stored as uint8");
+
+static uint8_t GlyphIndex(char c) {
+  const uint32_t index =
+      static_cast<uint32_t>(static_cast<uint8_t>(c)) - FONT_FIRST_CHAR;
+  return (index < FONT_GLYPH_COUNT) ? static_cast<uint8_t>(index)
+                                    : TEXT_FALLBACK_GLYPH;
+}
+
+TextCursor textLayout_Begin(const char *text, uint32_t length,
+                            int32_t fontSize) {
+  const int32_t size = (fontSize < FONT_BASE_SIZE) ? FONT_BASE_SIZE : fontSize;
+  return TextCursor{
+      .text = text,
+      .length = text ? length : 0,
+      .pos = 0,
+      .scale = static_cast<float>(size) / static_cast<float>(FONT_BASE_SIZE),
+      .spacing = static_cast<float>(size / FONT_BASE_SIZE),
+      .lineAdvance = static_cast<float>(size + TEXT_LINE_SPACING),
+      .fontSize = static_cast<float>(size),
+      .x = 0.0f,
+      .y = 0.0f,
+      .width = 0.0f};
+}
+
+bool textLayout_Next(TextCursor *cursor, TextGlyph *out) {
+  TextCursor &c = *cursor;
+  while (c.pos < c.length) {
+    const char ch = c.text[c.pos++];
+    if (ch == '\n') {
+      c.width = (c.x > c.width) ? c.x : c.width;
+      c.x = 0.0f;
+      c.y += c.lineAdvance;
+      continue;
+    }
+    const uint8_t glyph = GlyphIndex(ch);
+    const float x = c.x;
+    c.x += static_cast<float>(ASSET_GLYPHS[glyph].w) * c.scale + c.spacing;
+    // No spacing after the last glyph of a line
+    if (c.pos == c.length || c.text[c.pos] == '\n') {
+      c.x -= c.spacing;
+    }
+    if (ch != ' ' && ch != '\t') {
+      *out = TextGlyph{.x = x, .y = c.y, .glyph = glyph};
+      return true;
+    }
+  }
+  c.width = (c.x > c.width) ? c.x : c.width;
+  return false;
+}
+
+creVec2 textLayout_Extent(const TextCursor *cursor) {
+  const float width = (cursor->x > cursor->width) ? cursor->x : cursor->width;
+  return creVec2{width,
+                 (cursor->length > 0) ? cursor->y + cursor->fontSize : 0.0f};
+}
+
+creVec2 textLayout_Measure(const char *text, uint32_t length,
+                           int32_t fontSize) {
+  TextCursor cursor = textLayout_Begin(text, length, fontSize);
+  TextGlyph glyph;
+  while (textLayout_Next(&cursor, &glyph)) {
+  }
+  return textLayout_Extent(&cursor);
+}
+
+creRectangle textLayout_GlyphRect(uint8_t glyph) {
+  const GlyphMeta &g = ASSET_GLYPHS[glyph];
+  return creRectangle{static_cast<float>(g.x), static_cast<float>(g.y),
+                      static_cast<float>(g.w), static_cast<float>(g.h)};
+}
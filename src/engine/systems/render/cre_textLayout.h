@@ -0,0 +1,70 @@
+/**
+ * @file cre_textLayout.h
+ * @brief Glyph Layout for the Atlas Font (no renderer dependency)
+ *
+ * Walks a string over ASSET_GLYPHS with DrawText's metrics and yields one
+ * placement per visible glyph. Shared by the text renderer and the UI,
+ * which caches the placements; the headless build uses it for measuring.
+ *
+ *   TextCursor c = textLayout_Begin(text, length, fontSize);
+ *   TextGlyph g;
+ *   while (textLayout_Next(&c, &g)) { ... }
+ *   creVec2 size = textLayout_Extent(&c);
+ *
+ * Strings are ASCII (other bytes map to '?'); spaces and tabs only advance,
+ * '\n' starts a new line.
+ */
+
+#ifndef CRE_TEXTLAYOUT_H
+#define CRE_TEXTLAYOUT_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+struct TextGlyph {
+  float x; // Offset from the text origin, pixels
+  float y;
+  uint8_t glyph; // Index into ASSET_GLYPHS
+};
+
+struct TextCursor {
+  const char *text;
+  uint32_t length;
+  uint32_t pos;
+  float scale;   // Screen pixels per glyph pixel
+  float spacing; // Between glyphs
+  float lineAdvance;
+  float fontSize; // Clamped to FONT_BASE_SIZE
+  float x;
+  float y;
+  float width; // Widest finished line
+};
+
+TextCursor textLayout_Begin(const char *text, uint32_t length,
+                            int32_t fontSize);
+
+/**
+ * @brief Advance to the next visible glyph.
+ * @return false once the text is exhausted
+ */
+bool textLayout_Next(TextCursor *cursor, TextGlyph *out);
+
+/**
+ * @brief Extent of the text (widest line x all lines). Complete once Next
+ * has returned false.
+ */
+creVec2 textLayout_Extent(const TextCursor *cursor);
+
+/**
+ * @brief Walk the whole string and return its extent.
+ */
+creVec2 textLayout_Measure(const char *text, uint32_t length,
+                           int32_t fontSize);
+
+/**
+ * @brief Atlas rectangle of a glyph (unscaled cell).
+ */
+creRectangle textLayout_GlyphRect(uint8_t glyph);
+
+#endif
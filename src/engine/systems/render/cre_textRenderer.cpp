@@ -0,0 +1,173 @@
+#include "cre_textRenderer.h"
+#include "cre_rendererCore.h"
+#include "cre_textLayout.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "raylib.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+static_assert(TEXT_MAX_LENGTH <= 0xFFFF, "Run lengths are stored as uint16");
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+struct TextRun {
+  TextGlyph glyphs[TEXT_MAX_LENGTH];
+  char text[TEXT_MAX_LENGTH];
+  creVec2 size;
+  float scale;
+  int32_t fontSize;
+  uint16_t length;
+  uint16_t glyphCount;
+  uint16_t gen;
+  bool alive;
+};
+
+static TextRun s_runs[TEXT_MAX_RUNS] = {};
+static uint32_t s_liveRuns = 0;
+static uint32_t s_layouts = 0;
+
+static void EmitGlyph(const TextGlyph &g, creVec2 origin, float scale) {
+  const creRectangle src = textLayout_GlyphRect(g.glyph);
+  rendererCore_AtlasQuad(src, creRectangle{origin.x + g.x, origin.y + g.y,
+                                           src.width * scale,
+                                           src.height * scale});
+}
+
+// ============================================================================
+// Runs
+// ============================================================================
+
+static TextRun *GetRun(TextID text) {
+  if (text.index >= TEXT_MAX_RUNS)
+    return nullptr;
+  TextRun *run = &s_runs[text.index];
+  return (run->alive && run->gen == text.gen) ? run : nullptr;
+}
+
+static void LayoutRun(TextRun *run, const char *str, uint32_t length) {
+  memcpy(run->text, str, length);
+  run->text[length] = '\0';
+  run->length = static_cast<uint16_t>(length);
+
+  TextCursor cursor = textLayout_Begin(run->text, length, run->fontSize);
+  uint32_t count = 0;
+  while (textLayout_Next(&cursor, &run->glyphs[count])) {
+    count++;
+  }
+  run->size = textLayout_Extent(&cursor);
+  run->scale = cursor.scale;
+  run->glyphCount = static_cast<uint16_t>(count);
+  s_layouts++;
+}
+
+static uint32_t ClampLength(const char *str) {
+  const size_t length = strnlen(str, TEXT_MAX_LENGTH);
+  if (length < TEXT_MAX_LENGTH)
+    return static_cast<uint32_t>(length);
+  Log(LogLevel::Warning, "TextRenderer: String truncated to {} bytes",
+      TEXT_MAX_LENGTH - 1);
+  return TEXT_MAX_LENGTH - 1;
+}
+
+TextID textRenderer_Create(const char *text, int32_t fontSize) {
+  for (uint32_t i = 0; i < TEXT_MAX_RUNS; i++) {
+    TextRun *run = &s_runs[i];
+    if (run->alive)
+      continue;
+    run->alive = true;
+    run->fontSize = fontSize;
+    LayoutRun(run, text ? text : "", text ? ClampLength(text) : 0);
+    s_liveRuns++;
+    return TextID{.index = static_cast<uint16_t>(i), .gen = run->gen};
+  }
+  Log(LogLevel::Warning, "textRenderer_Create: All {} runs in use",
+      TEXT_MAX_RUNS);
+  return TEXT_INVALID;
+}
+
+void textRenderer_Destroy(TextID text) {
+  TextRun *run = GetRun(text);
+  if (!run)
+    return;
+  run->alive = false;
+  run->gen++;
+  s_liveRuns--;
+}
+
+bool textRenderer_Set(TextID text, const char *str) {
+  TextRun *run = GetRun(text);
+  if (!run || !str)
+    return false;
+  const uint32_t length = ClampLength(str);
+  if (length == run->length && memcmp(run->text, str, length) == 0)
+    return false;
+  LayoutRun(run, str, length);
+  return true;
+}
+
+bool textRenderer_SetF(TextID text, const char *fmt, ...) {
+  char buffer[TEXT_MAX_LENGTH];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  va_end(args);
+  return textRenderer_Set(text, buffer);
+}
+
+creVec2 textRenderer_Measure(TextID text) {
+  const TextRun *run = GetRun(text);
+  return run ? run->size : creVec2{0.0f, 0.0f};
+}
+
+void textRenderer_Draw(TextID text, creVec2 pos, creColor tint) {
+  const TextRun *run = GetRun(text);
+  if (!run || run->glyphCount == 0)
+    return;
+  if (!rendererCore_BeginAtlasQuads(tint)) {
+    DrawText(run->text, static_cast<int>(pos.x), static_cast<int>(pos.y),
+             run->fontSize, Color{tint.r, tint.g, tint.b, tint.a});
+    return;
+  }
+  for (uint32_t i = 0; i < run->glyphCount; i++) {
+    EmitGlyph(run->glyphs[i], pos, run->scale);
+  }
+  rendererCore_EndAtlasQuads();
+}
+
+// ============================================================================
+// Transient Strings
+// ============================================================================
+
+creVec2 textRenderer_MeasureString(const char *text, uint32_t length,
+                                   int32_t fontSize) {
+  return textLayout_Measure(text, length, fontSize);
+}
+
+void textRenderer_DrawString(const char *text, uint32_t length, creVec2 pos,
+                             int32_t fontSize, creColor tint) {
+  if (!rendererCore_BeginAtlasQuads(tint)) {
+    // text is not terminated at length in general
+    char buffer[TEXT_MAX_LENGTH];
+    const uint32_t n =
+        (length < TEXT_MAX_LENGTH) ? length : TEXT_MAX_LENGTH - 1;
+    memcpy(buffer, text, n);
+    buffer[n] = '\0';
+    DrawText(buffer, static_cast<int>(pos.x), static_cast<int>(pos.y),
+             fontSize, Color{tint.r, tint.g, tint.b, tint.a});
+    return;
+  }
+  TextCursor cursor = textLayout_Begin(text, length, fontSize);
+  TextGlyph glyph;
+  while (textLayout_Next(&cursor, &glyph)) {
+    EmitGlyph(glyph, pos, cursor.scale);
+  }
+  rendererCore_EndAtlasQuads();
+}
+
+TextStats textRenderer_GetStats(void) {
+  return TextStats{.runs = s_liveRuns, .layouts = s_layouts};
+}
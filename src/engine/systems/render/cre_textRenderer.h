@@ -0,0 +1,85 @@
+/**
+ * @file cre_textRenderer.h
+ * @brief Cached Text Runs (Atlas Glyphs, Sprite Batch)
+ *
+ * The asset pipeline bakes raylib's default font into the sprite atlas
+ * (ASSET_GLYPHS), so text is drawn with the same texture as the sprites and
+ * never breaks their batch. Metrics match DrawText: a glyph cell is
+ * FONT_BASE_SIZE pixels high, scaled by fontSize / FONT_BASE_SIZE, with
+ * fontSize / FONT_BASE_SIZE pixels of spacing (sizes below the base size are
+ * raised to it).
+ *
+ * A run is a string behind a handle, laid out once: glyph offsets and the
+ * extent are cached and recomputed only when Set receives a different
+ * string. Draw just emits the cached quads:
+ *
+ *   TextID title = textRenderer_Create("GAME OVER", 80);      // scene init
+ *   textRenderer_SetF(score, "Score: %u", points);            // no-op if same
+ *   textRenderer_Draw(title, pos, tint);                      // every frame
+ *   textRenderer_Destroy(title);                              // scene unload
+ *
+ * Layout itself lives in cre_textLayout (usable without a renderer).
+ * Strings are ASCII (other bytes draw '?') and truncated to
+ * TEXT_MAX_LENGTH - 1 bytes; '\n' starts a new line. Without a loaded
+ * atlas, text falls back to raylib's DrawText.
+ */
+
+#ifndef CRE_TEXTRENDERER_H
+#define CRE_TEXTRENDERER_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+struct TextStats {
+  uint32_t runs;    ///< Live handles
+  uint32_t layouts; ///< Run layouts since startup (Create + changed Set)
+};
+
+/**
+ * @brief Lay out text once and return its handle.
+ * @return Handle, or TEXT_INVALID if every run is in use
+ */
+TextID textRenderer_Create(const char *text, int32_t fontSize);
+
+/**
+ * @brief Free a run. Stale handles are ignored.
+ */
+void textRenderer_Destroy(TextID text);
+
+/**
+ * @brief Replace the string of a run.
+ * @return true if it changed (and was laid out again)
+ */
+bool textRenderer_Set(TextID text, const char *str);
+
+/**
+ * @brief printf-style textRenderer_Set.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((format(printf, 2, 3)))
+#endif
+bool textRenderer_SetF(TextID text, const char *fmt, ...);
+
+/**
+ * @brief Cached extent of a run in pixels, {0, 0} for stale handles.
+ */
+creVec2 textRenderer_Measure(TextID text);
+
+/**
+ * @brief Draw a run with its top-left corner at pos.
+ */
+void textRenderer_Draw(TextID text, creVec2 pos, creColor tint);
+
+/**
+ * @brief Uncached variants for transient strings (debug draw): the layout
+ * is walked on every call. length bytes of text are used.
+ */
+creVec2 textRenderer_MeasureString(const char *text, uint32_t length,
+                                   int32_t fontSize);
+void textRenderer_DrawString(const char *text, uint32_t length, creVec2 pos,
+                             int32_t fontSize, creColor tint);
+
+TextStats textRenderer_GetStats(void);
+
+#endif
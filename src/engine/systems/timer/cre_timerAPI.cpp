@@ -0,0 +1,36 @@
+#include "cre_timerAPI.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_config.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include <math.h>
+#include <stdint.h>
+
+uint32_t timerAPI_SecondsToTicks(float seconds) {
+  const double ticks = static_cast<double>(seconds) * 1e6 /
+                       static_cast<double>(FIXED_STEP_US);
+  if (!(ticks >= 1.0))
+    return 1;
+  if (ticks >= static_cast<double>(TIMER_MAX_DELAY))
+    return TIMER_MAX_DELAY;
+  return static_cast<uint32_t>(lround(ticks));
+}
+
+TimerID timerAPI_After(const Command &cmd, float seconds) {
+  return TimerSystem_Schedule(cmd, timerAPI_SecondsToTicks(seconds), 0);
+}
+
+TimerID timerAPI_Every(const Command &cmd, float seconds) {
+  const uint32_t ticks = timerAPI_SecondsToTicks(seconds);
+  return TimerSystem_Schedule(cmd, ticks, ticks);
+}
+
+TimerID timerAPI_DestroyAfter(Entity entity, float seconds) {
+  const Command cmd = {
+      .type = CMD_ENTITY_DESTROY,
+      .entity = entity,
+      .u64 = {},
+  };
+  return timerAPI_After(cmd, seconds);
+}
+
+bool timerAPI_Cancel(TimerID timer) { return TimerSystem_Cancel(timer); }
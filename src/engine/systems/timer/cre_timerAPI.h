@@ -0,0 +1,26 @@
+#ifndef CRE_TIMERAPI_H
+#define CRE_TIMERAPI_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+struct Command;
+
+/**
+ * @brief Fixed steps covering seconds (rounded, at least 1).
+ */
+uint32_t timerAPI_SecondsToTicks(float seconds);
+
+/**
+ * @brief Push cmd onto the bus once, seconds from now.
+ */
+TimerID timerAPI_After(const Command &cmd, float seconds);
+
+/**
+ * @brief Push cmd every seconds, the first time seconds from now.
+ */
+TimerID timerAPI_Every(const Command &cmd, float seconds);
+
+TimerID timerAPI_DestroyAfter(Entity entity, float seconds);
+bool timerAPI_Cancel(TimerID timer);
+#endif
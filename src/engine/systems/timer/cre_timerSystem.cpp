@@ -0,0 +1,315 @@
+#include "cre_timerSystem.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
+#include "engine/memory/cre_arena.h"
+#include <assert.h>
+#include <string.h>
+
+static constexpr uint32_t TIMER_WHEEL_BITS = 6;
+static constexpr uint32_t TIMER_WHEEL_SLOTS = 1U << TIMER_WHEEL_BITS;
+static constexpr uint32_t TIMER_WHEEL_MASK = TIMER_WHEEL_SLOTS - 1;
+static constexpr uint32_t TIMER_NIL = 0xFFFFFFFFU;
+static constexpr uint16_t TIMER_SLOT_FREE = 0xFFFF;
+static constexpr size_t TIMER_ALIGNMENT = 64;
+
+static_assert(TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS < TIMER_SLOT_FREE,
+              "Slot ids must fit below TIMER_SLOT_FREE");
+static_assert(TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS < 32,
+              "Wheel span must fit the 32-bit tick counter");
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Start of the wheel block, followed by the node columns. Everything
+ * is index-linked, so the block can be saved and restored as raw bytes.
+ */
+struct TimerWheel {
+  uint32_t now;      // Last processed tick
+  uint32_t capacity;
+  uint32_t pending;
+  uint32_t freeHead; // Free nodes, linked through next[]
+  uint32_t dropped;
+  uint32_t heads[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+};
+
+/**
+ * @brief Node columns inside the block. Cascades only touch the links and
+ * due ticks; the commands are read once, when the timer fires.
+ */
+struct TimerColumns {
+  TimerWheel *wheel;
+  uint32_t *next;
+  uint32_t *prev;
+  uint32_t *due;
+  uint32_t *period; // 0 = one-shot
+  uint32_t *gen;
+  uint16_t *slot;   // level * 64 + index, or FREE
+  Command *cmd;
+  size_t bytes;
+};
+
+static TimerColumns s_timers = {};
+static uint32_t s_fired = 0;
+static uint32_t s_cascaded = 0;
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+static size_t AlignUp(size_t size) {
+  return (size + TIMER_ALIGNMENT - 1) & ~(TIMER_ALIGNMENT - 1);
+}
+
+size_t TimerSystem_MemorySize(uint32_t capacity) {
+  const size_t n = capacity;
+  return AlignUp(sizeof(TimerWheel)) + 5 * AlignUp(sizeof(uint32_t) * n) +
+         AlignUp(sizeof(uint16_t) * n) + AlignUp(sizeof(Command) * n);
+}
+
+bool TimerSystem_Init(Arena *arena, uint32_t capacity) {
+  const size_t bytes = TimerSystem_MemorySize(capacity);
+  if (capacity == 0 || capacity >= TIMER_NIL ||
+      arena_Remaining(arena) < bytes + TIMER_ALIGNMENT) {
+    Log(LogLevel::Error, "TimerSystem_Init: Arena too small for {} timers",
+        capacity);
+    s_timers = {};
+    return false;
+  }
+
+  uint8_t *cursor = static_cast<uint8_t *>(
+      arena_PushAligned(arena, bytes, TIMER_ALIGNMENT));
+  s_timers.wheel = reinterpret_cast<TimerWheel *>(cursor);
+  cursor += AlignUp(sizeof(TimerWheel));
+  uint32_t **columns[] = {&s_timers.next, &s_timers.prev, &s_timers.due,
+                          &s_timers.period, &s_timers.gen};
+  for (uint32_t **column : columns) {
+    *column = reinterpret_cast<uint32_t *>(cursor);
+    cursor += AlignUp(sizeof(uint32_t) * capacity);
+  }
+  s_timers.slot = reinterpret_cast<uint16_t *>(cursor);
+  cursor += AlignUp(sizeof(uint16_t) * capacity);
+  s_timers.cmd = reinterpret_cast<Command *>(cursor);
+  s_timers.bytes = bytes;
+
+  memset(s_timers.wheel, 0, bytes);
+  s_timers.wheel->capacity = capacity;
+  TimerSystem_Clear();
+  Log(LogLevel::Info, "Timer System Initialized ({} timers, {} KB)", capacity,
+      bytes / 1024);
+  return true;
+}
+
+void TimerSystem_Clear(void) {
+  TimerWheel *wheel = s_timers.wheel;
+  if (!wheel)
+    return;
+
+  for (uint32_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+    for (uint32_t i = 0; i < TIMER_WHEEL_SLOTS; i++) {
+      wheel->heads[level][i] = TIMER_NIL;
+    }
+  }
+  // Bump every generation so live handles become stale.
+  const uint32_t capacity = wheel->capacity;
+  for (uint32_t i = 0; i < capacity; i++) {
+    s_timers.gen[i]++;
+    s_timers.slot[i] = TIMER_SLOT_FREE;
+    s_timers.next[i] = (i + 1 < capacity) ? i + 1 : TIMER_NIL;
+  }
+  wheel->freeHead = 0;
+  wheel->pending = 0;
+  wheel->now = 0;
+  s_fired = 0;
+  s_cascaded = 0;
+}
+
+// ============================================================================
+// Slot Lists
+// ============================================================================
+
+/**
+ * @brief Link node into the slot matching its due tick. Level L is picked by
+ * the distance to now (< 64^(L+1) ticks), the slot by bits 6L..6L+5 of the
+ * due tick.
+ */
+static void Place(uint32_t node) {
+  TimerWheel *wheel = s_timers.wheel;
+  const uint32_t delta = s_timers.due[node] - wheel->now;
+  uint32_t level = 0;
+  while (level + 1 < TIMER_WHEEL_LEVELS &&
+         (delta >> (TIMER_WHEEL_BITS * (level + 1))) != 0) {
+    level++;
+  }
+  const uint32_t index =
+      (s_timers.due[node] >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK;
+
+  uint32_t &head = wheel->heads[level][index];
+  s_timers.prev[node] = TIMER_NIL;
+  s_timers.next[node] = head;
+  if (head != TIMER_NIL) {
+    s_timers.prev[head] = node;
+  }
+  head = node;
+  s_timers.slot[node] = static_cast<uint16_t>(level * TIMER_WHEEL_SLOTS + index);
+}
+
+static void Unlink(uint32_t node) {
+  const uint32_t slot = s_timers.slot[node];
+  const uint32_t prev = s_timers.prev[node];
+  const uint32_t next = s_timers.next[node];
+  if (prev != TIMER_NIL) {
+    s_timers.next[prev] = next;
+  } else {
+    s_timers.wheel->heads[slot / TIMER_WHEEL_SLOTS][slot & TIMER_WHEEL_MASK] =
+        next;
+  }
+  if (next != TIMER_NIL) {
+    s_timers.prev[next] = prev;
+  }
+}
+
+static void Release(uint32_t node) {
+  TimerWheel *wheel = s_timers.wheel;
+  s_timers.gen[node]++;
+  s_timers.slot[node] = TIMER_SLOT_FREE;
+  s_timers.next[node] = wheel->freeHead;
+  wheel->freeHead = node;
+  wheel->pending--;
+}
+
+static bool TimerSystem_IsHandleValid(TimerID timer) {
+  return s_timers.wheel && timer.index < s_timers.wheel->capacity &&
+         s_timers.gen[timer.index] == timer.gen &&
+         s_timers.slot[timer.index] != TIMER_SLOT_FREE;
+}
+
+// ============================================================================
+// Schedule / Cancel
+// ============================================================================
+
+TimerID TimerSystem_Schedule(const Command &cmd, uint32_t delayTicks,
+                             uint32_t periodTicks) {
+  TimerWheel *wheel = s_timers.wheel;
+  if (!wheel || wheel->freeHead == TIMER_NIL) {
+    Log(LogLevel::Warning, "TimerSystem_Schedule: Wheel is full");
+    return TIMER_INVALID;
+  }
+
+  const uint32_t node = wheel->freeHead;
+  wheel->freeHead = s_timers.next[node];
+  wheel->pending++;
+
+  const uint32_t delay =
+      (delayTicks < 1) ? 1
+                       : (delayTicks > TIMER_MAX_DELAY ? TIMER_MAX_DELAY
+                                                       : delayTicks);
+  s_timers.due[node] = wheel->now + delay;
+  s_timers.period[node] =
+      (periodTicks > TIMER_MAX_DELAY) ? TIMER_MAX_DELAY : periodTicks;
+  s_timers.cmd[node] = cmd;
+  Place(node);
+  return TimerID{.index = node, .gen = s_timers.gen[node]};
+}
+
+bool TimerSystem_Cancel(TimerID timer) {
+  if (!TimerSystem_IsHandleValid(timer))
+    return false;
+  Unlink(timer.index);
+  Release(timer.index);
+  return true;
+}
+
+bool TimerSystem_IsPending(TimerID timer) {
+  return TimerSystem_IsHandleValid(timer);
+}
+
+uint32_t TimerSystem_GetRemaining(TimerID timer) {
+  if (!TimerSystem_IsHandleValid(timer))
+    return 0;
+  return s_timers.due[timer.index] - s_timers.wheel->now;
+}
+
+// ============================================================================
+// Advance
+// ============================================================================
+
+/**
+ * @brief Empty one slot of an upper level and re-place its timers; they are
+ * now less than 64^level ticks away, so they all land lower.
+ */
+static void Cascade(uint32_t level, uint32_t index) {
+  uint32_t node = s_timers.wheel->heads[level][index];
+  s_timers.wheel->heads[level][index] = TIMER_NIL;
+  while (node != TIMER_NIL) {
+    const uint32_t next = s_timers.next[node];
+    Place(node);
+    s_cascaded++;
+    node = next;
+  }
+}
+
+void TimerSystem_Advance(CommandBus &bus) {
+  TimerWheel *wheel = s_timers.wheel;
+  s_fired = 0;
+  s_cascaded = 0;
+  if (!wheel)
+    return;
+
+  const uint32_t now = ++wheel->now;
+
+  // Upper levels whose slot boundary is this tick, top down.
+  uint32_t wrapped = 0;
+  while (wrapped + 1 < TIMER_WHEEL_LEVELS &&
+         (now & ((1U << (TIMER_WHEEL_BITS * (wrapped + 1))) - 1)) == 0) {
+    wrapped++;
+  }
+  for (uint32_t level = wrapped; level > 0; level--) {
+    Cascade(level, (now >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK);
+  }
+
+  // Level 0: everything in the slot is due now. Detach the list first so
+  // periodic timers can be re-placed while walking it.
+  uint32_t &head = wheel->heads[0][now & TIMER_WHEEL_MASK];
+  uint32_t node = head;
+  head = TIMER_NIL;
+  while (node != TIMER_NIL) {
+    const uint32_t next = s_timers.next[node];
+    assert(s_timers.due[node] == now);
+    if (CommandBus_Push(bus, s_timers.cmd[node])) {
+      s_fired++;
+    } else {
+      wheel->dropped++;
+      Log(LogLevel::Warning, "TimerSystem_Advance: CommandBus is full!");
+    }
+
+    const uint32_t period = s_timers.period[node];
+    if (period > 0) {
+      s_timers.due[node] = now + period;
+      Place(node);
+    } else {
+      Release(node);
+    }
+    node = next;
+  }
+}
+
+void TimerSystem_GetSimState(SimStateBlock *out) {
+  *out = {.name = "timer.wheel",
+          .base = s_timers.wheel,
+          .size = s_timers.bytes};
+}
+
+TimerStats TimerSystem_GetStats(void) {
+  const TimerWheel *wheel = s_timers.wheel;
+  if (!wheel)
+    return TimerStats{
+        .pending = 0, .capacity = 0, .fired = 0, .cascaded = 0, .dropped = 0};
+  return TimerStats{.pending = wheel->pending,
+                    .capacity = wheel->capacity,
+                    .fired = s_fired,
+                    .cascaded = s_cascaded,
+                    .dropped = wheel->dropped};
+}
@@ -0,0 +1,98 @@
+/**
+ * @file cre_timerSystem.h
+ * @brief Deferred Commands (Hierarchical Timing Wheel)
+ *
+ * A timer holds a Command and pushes it onto the CommandBus when it comes
+ * due, once or every `period` ticks. One tick is one fixed step: the wheel
+ * advances at the top of each fixed step, so physics commands apply in that
+ * step. Entity commands are applied right after the frame's fixed steps
+ * (EntitySystem_UpdateSince), and the systems that run after them
+ * (animation, transform, audio, camera) read theirs in the same frame. AI
+ * has drained the bus before the steps: do not schedule AI commands.
+ *
+ * The wheel has TIMER_WHEEL_LEVELS levels of 64 slots. Level 0 holds timers
+ * due in the next 64 ticks, one slot per tick; level L holds one slot per
+ * 64^L ticks. When level 0 wraps, the next slot of level 1 is cascaded
+ * (re-inserted one level down), and so on. Insert and cancel are O(1)
+ * (intrusive doubly linked lists); a timer is touched at most once per
+ * level before it fires.
+ *
+ * Nodes are index-linked and live in one arena block, which is registered
+ * as simulation state: rollback and replays restore pending timers with the
+ * rest of the tick. Commands are not re-validated when they fire; systems
+ * already ignore commands for dead entities (stale generations).
+ */
+
+#ifndef CRE_TIMERSYSTEM_H
+#define CRE_TIMERSYSTEM_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Forward declarations (dependency injection)
+struct Arena;
+struct Command;
+struct CommandBus;
+struct SimStateBlock;
+
+constexpr uint32_t TIMER_WHEEL_LEVELS = 4;
+constexpr uint32_t TIMER_MAX_DELAY =
+    (1U << (6 * TIMER_WHEEL_LEVELS)) - 1; // Ticks (~77 h at 60 Hz)
+
+struct TimerStats {
+  uint32_t pending;  ///< Scheduled timers (periodic ones included)
+  uint32_t capacity; ///< Timers the wheel can hold
+  uint32_t fired;    ///< Commands pushed by the last advance
+  uint32_t cascaded; ///< Timers moved down a level by the last advance
+  uint32_t dropped;  ///< Commands lost to a full bus since startup
+};
+
+/**
+ * @brief Bytes TimerSystem_Init pushes for a given capacity.
+ */
+size_t TimerSystem_MemorySize(uint32_t capacity);
+
+/**
+ * @brief Carve the wheel out of arena and reset it.
+ * @return false if the arena is too small (the wheel is left empty)
+ */
+bool TimerSystem_Init(Arena *arena, uint32_t capacity);
+
+/**
+ * @brief Cancel every timer and invalidate all handles (scene changes).
+ */
+void TimerSystem_Clear(void);
+
+/**
+ * @brief Push cmd onto the bus in delayTicks ticks (clamped to
+ * [1, TIMER_MAX_DELAY]), then every periodTicks ticks if periodTicks > 0.
+ * @return Handle, or TIMER_INVALID if the wheel is full
+ */
+TimerID TimerSystem_Schedule(const Command &cmd, uint32_t delayTicks,
+                             uint32_t periodTicks);
+
+/**
+ * @brief Remove a pending timer. Stale handles are ignored.
+ * @return true if the timer was pending
+ */
+bool TimerSystem_Cancel(TimerID timer);
+
+bool TimerSystem_IsPending(TimerID timer);
+
+/**
+ * @brief Ticks until the timer fires next, 0 for stale handles.
+ */
+uint32_t TimerSystem_GetRemaining(TimerID timer);
+
+/**
+ * @brief Advance one tick and push every command that came due.
+ */
+void TimerSystem_Advance(CommandBus &bus);
+
+void TimerSystem_GetSimState(SimStateBlock *out);
+
+TimerStats TimerSystem_GetStats(void);
+
+#endif
@@ -0,0 +1,64 @@
+#include "cre_transformAPI.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_logger.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <stdint.h>
+
+void transformAPI_Attach(CommandBus &bus, Entity entity, Entity parent,
+                         creVec2 offset, float rotation) {
+  Command cmd = {
+      .type = CMD_XFORM_ATTACH,
+      .entity = entity,
+      .xformAttach = {.parent = parent, .offset = offset, .rotation = rotation}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "transformAPI_Attach: CommandBus is full!");
+  }
+}
+
+void transformAPI_Detach(CommandBus &bus, Entity entity) {
+  Command cmd = {.type = CMD_XFORM_DETACH, .entity = entity, .u64 = {}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "transformAPI_Detach: CommandBus is full!");
+  }
+}
+
+void transformAPI_SetLocalOffset(CommandBus &bus, Entity entity,
+                                 creVec2 offset) {
+  Command cmd = {
+      .type = CMD_XFORM_SET_OFFSET, .entity = entity, .vec2 = {.value = offset}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "transformAPI_SetLocalOffset: CommandBus is full!");
+  }
+}
+
+void transformAPI_SetLocalRotation(CommandBus &bus, Entity entity,
+                                   float rotation) {
+  Command cmd = {.type = CMD_XFORM_SET_ROTATION,
+                 .entity = entity,
+                 .f32 = {.value = rotation}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning,
+        "transformAPI_SetLocalRotation: CommandBus is full!");
+  }
+}
+
+void transformAPI_SetLocalScale(CommandBus &bus, Entity entity, creVec2 scale) {
+  Command cmd = {
+      .type = CMD_XFORM_SET_SCALE, .entity = entity, .vec2 = {.value = scale}};
+
+  if (!CommandBus_Push(bus, cmd)) {
+    Log(LogLevel::Warning, "transformAPI_SetLocalScale: CommandBus is full!");
+  }
+}
+
+Entity transformAPI_GetParent(const EntityRegistry &reg, Entity entity) {
+  if (!EntityRegistry_IsAlive(reg, entity) ||
+      !(reg.component_masks[entity.id] & COMP_HIERARCHY)) {
+    return ENTITY_INVALID;
+  }
+  return reg.parents[entity.id];
+}
@@ -0,0 +1,31 @@
+#ifndef CRE_TRANSFORMAPI_H
+#define CRE_TRANSFORMAPI_H
+
+#include "engine/core/cre_types.h"
+#include <stdint.h>
+struct CommandBus;
+struct EntityRegistry;
+
+/**
+ * @brief Make entity follow parent (adds COMP_HIERARCHY, resets the local
+ * scale to 1). Rejected if it would create a cycle or exceed
+ * TRANSFORM_MAX_DEPTH.
+ * @param offset   Local position in parent space
+ * @param rotation Local rotation in degrees
+ */
+void transformAPI_Attach(CommandBus &bus, Entity entity, Entity parent,
+                         creVec2 offset, float rotation);
+
+/**
+ * @brief Stop following the parent. The entity keeps its last world
+ * transform.
+ */
+void transformAPI_Detach(CommandBus &bus, Entity entity);
+void transformAPI_SetLocalOffset(CommandBus &bus, Entity entity,
+                                 creVec2 offset);
+void transformAPI_SetLocalRotation(CommandBus &bus, Entity entity,
+                                   float rotation);
+void transformAPI_SetLocalScale(CommandBus &bus, Entity entity, creVec2 scale);
+
+Entity transformAPI_GetParent(const EntityRegistry &reg, Entity entity);
+#endif
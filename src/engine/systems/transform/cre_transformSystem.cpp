@@ -0,0 +1,377 @@
+#include "cre_transformSystem.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/ecs/cre_entityAPI.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <math.h>
+#include <string.h>
+
+#define DEG_TO_RAD (3.14159265f / 180.0f)
+
+static_assert(TRANSFORM_MAX_DEPTH < 256, "s_depth[] is uint8_t");
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+// Depth-sorted order: level L occupies [s_levelStart[L - 1], s_levelStart[L])
+static uint32_t s_order[MAX_ENTITIES];
+static Entity s_orderParent[MAX_ENTITIES];
+static uint32_t s_levelStart[TRANSFORM_MAX_DEPTH + 1];
+static uint8_t s_depth[MAX_ENTITIES]; // 0 = root (or not in the order)
+static uint32_t s_levels = 0;
+static uint32_t s_seenCount = 0; // COMP_HIERARCHY entities at the rebuild
+static bool s_dirty = true;
+static TransformStats s_stats = {};
+
+// Level-1 parents (deduplicated): the only rotations that go through libm
+static uint32_t s_roots[MAX_ENTITIES];
+static uint32_t s_rootCount = 0;
+static bool s_isRoot[MAX_ENTITIES];
+
+// sin/cos of every world rotation in the tree, per entity id. Children get
+// theirs from the angle-sum identities instead of sinf/cosf.
+static float s_sin[MAX_ENTITIES];
+static float s_cos[MAX_ENTITIES];
+
+// Local rotation per order slot and its sin/cos (refreshed on change)
+static float s_localRot[MAX_ENTITIES];
+static float s_localSin[MAX_ENTITIES];
+static float s_localCos[MAX_ENTITIES];
+
+transformPacket CreateTransformPacket(EntityRegistry *reg, CommandBus *bus) {
+  transformPacket pkt = {
+      .bus = bus,
+      .max_used_bound = reg->max_used_bound,
+      .read = {.state_flags = reg->state_flags,
+               .generations = reg->generations},
+      .write = {.component_masks = reg->component_masks,
+                .counters = &reg->counters,
+                .parents = reg->parents,
+                .local_pos = reg->local_pos,
+                .local_rotation = reg->local_rotation,
+                .local_scale = reg->local_scale,
+                .pos = reg->pos,
+                .rotation = reg->rotation,
+                .visual_scale = reg->visual_scale},
+  };
+  return pkt;
+}
+
+/**
+ * @brief Levels between id and its root, following parents[].
+ * @return 0 for a root, TRANSFORM_MAX_DEPTH + 1 if too deep (or a cycle)
+ */
+static uint32_t DepthOf(const uint64_t *masks, const Entity *parents,
+                        uint32_t id) {
+  uint32_t depth = 0;
+  while ((masks[id] & COMP_HIERARCHY) && depth <= TRANSFORM_MAX_DEPTH) {
+    id = parents[id].id;
+    if (id >= MAX_ENTITIES)
+      break;
+    depth++;
+  }
+  return depth;
+}
+
+// ============================================================================
+// Command Processing
+// ============================================================================
+
+static void SetHierarchy(transformPacket *packet, uint32_t id, bool on) {
+  uint64_t *masks = packet->write.component_masks;
+  const uint64_t flags = packet->read.state_flags[id];
+  const uint64_t comps =
+      on ? (masks[id] | COMP_HIERARCHY) : (masks[id] & ~COMP_HIERARCHY);
+  EntityCounters_OnEntity(packet->write.counters, flags, masks[id], flags,
+                          comps);
+  masks[id] = comps;
+}
+
+void TransformSystem_ProcessCommands(transformPacket *packet) {
+  // UNPACKING THE PACKET
+  CommandBus &bus = *packet->bus;
+  const uint64_t *flags = packet->read.state_flags;
+  const uint32_t *generations = packet->read.generations;
+  const uint64_t *masks = packet->write.component_masks;
+  Entity *parents = packet->write.parents;
+  creVec2 *local_pos = packet->write.local_pos;
+  float *local_rotation = packet->write.local_rotation;
+  creVec2 *local_scale = packet->write.local_scale;
+
+  CommandIterator iter = CommandBus_GetIterator(bus);
+  const Command *cmd;
+
+  while (CommandBus_Next(bus, &iter, &cmd)) {
+    if ((cmd->type & CMD_DOMAIN_MASK) != CMD_DOMAIN_TRANSFORM)
+      continue;
+    if (!EntityRegistry_IsAlive(flags, generations, cmd->entity))
+      continue;
+    const uint32_t id = cmd->entity.id;
+
+    switch (cmd->type) {
+    case CMD_XFORM_ATTACH: {
+      const Entity parent = cmd->xformAttach.parent;
+      if (parent.id == id ||
+          !EntityRegistry_IsAlive(flags, generations, parent)) {
+        Log(LogLevel::Warning, "TransformSystem: Invalid parent for {}", id);
+        break;
+      }
+      // Reject cycles: id must not be an ancestor of the new parent
+      uint32_t depth = 1;
+      uint32_t up = parent.id;
+      while ((masks[up] & COMP_HIERARCHY) && up != id &&
+             depth <= TRANSFORM_MAX_DEPTH) {
+        up = parents[up].id;
+        if (up >= MAX_ENTITIES)
+          break;
+        depth++;
+      }
+      if (up == id || depth > TRANSFORM_MAX_DEPTH) {
+        Log(LogLevel::Warning,
+            "TransformSystem: Attach {} -> {} rejected (cycle or too deep)",
+            id, parent.id);
+        break;
+      }
+
+      parents[id] = parent;
+      local_pos[id] = cmd->xformAttach.offset;
+      local_rotation[id] = cmd->xformAttach.rotation;
+      local_scale[id] = creVec2{1.0f, 1.0f};
+      if (!(masks[id] & COMP_HIERARCHY)) {
+        SetHierarchy(packet, id, true);
+      }
+      break;
+    }
+    case CMD_XFORM_DETACH: {
+      if (!(masks[id] & COMP_HIERARCHY))
+        break;
+      SetHierarchy(packet, id, false);
+      parents[id] = ENTITY_INVALID;
+      break;
+    }
+    case CMD_XFORM_SET_OFFSET: {
+      if (masks[id] & COMP_HIERARCHY) {
+        local_pos[id] = cmd->vec2.value;
+      }
+      break;
+    }
+    case CMD_XFORM_SET_ROTATION: {
+      if (masks[id] & COMP_HIERARCHY) {
+        local_rotation[id] = cmd->f32.value;
+      }
+      break;
+    }
+    case CMD_XFORM_SET_SCALE: {
+      if (masks[id] & COMP_HIERARCHY) {
+        local_scale[id] = cmd->vec2.value;
+      }
+      break;
+    }
+    default:
+      break;
+    }
+  }
+}
+
+// ============================================================================
+// Order Maintenance
+// ============================================================================
+
+/**
+ * @brief True if the order still describes the registry: same child count
+ * and every child still has its parent at the level above.
+ */
+static bool ValidateOrder(const transformPacket *packet) {
+  if (s_dirty || packet->write.counters->children != s_seenCount)
+    return false;
+
+  const uint64_t *flags = packet->read.state_flags;
+  const uint32_t *generations = packet->read.generations;
+  const uint64_t *masks = packet->write.component_masks;
+  const Entity *parents = packet->write.parents;
+
+  for (uint32_t level = 1; level <= s_levels; level++) {
+    for (uint32_t k = s_levelStart[level - 1]; k < s_levelStart[level]; k++) {
+      const uint32_t id = s_order[k];
+      const Entity parent = s_orderParent[k];
+      if (!(flags[id] & FLAG_ACTIVE) || !(masks[id] & COMP_HIERARCHY))
+        return false;
+      if (parents[id].id != parent.id ||
+          parents[id].generation != parent.generation)
+        return false;
+      if (!EntityRegistry_IsAlive(flags, generations, parent))
+        return false;
+      const uint32_t parentDepth =
+          (masks[parent.id] & COMP_HIERARCHY) ? s_depth[parent.id] : 0u;
+      if (parentDepth + 1 != level ||
+          ((masks[parent.id] & COMP_HIERARCHY) && parentDepth == 0))
+        return false;
+    }
+  }
+  return true;
+}
+
+static void RebuildOrder(transformPacket *packet) {
+  const uint32_t bound = packet->max_used_bound;
+  const uint64_t *flags = packet->read.state_flags;
+  const uint32_t *generations = packet->read.generations;
+  const uint64_t *masks = packet->write.component_masks;
+  const Entity *parents = packet->write.parents;
+
+  uint32_t levelCount[TRANSFORM_MAX_DEPTH + 1] = {};
+  uint32_t seen = 0;
+  uint32_t orphans = 0;
+  uint32_t rejected = 0;
+
+  // Pass 1: depth of every child (s_depth doubles as the sort key)
+  memset(s_depth, 0, sizeof(s_depth));
+  for (uint32_t i = 0; i < bound; i++) {
+    if (!(flags[i] & FLAG_ACTIVE) || !(masks[i] & COMP_HIERARCHY))
+      continue;
+    seen++;
+    if (!EntityRegistry_IsAlive(flags, generations, parents[i])) {
+      // Parent died: the child goes with it
+      entityAPI_Destroy(*packet->bus,
+                        Entity{.id = i, .generation = generations[i]});
+      orphans++;
+      continue;
+    }
+    const uint32_t depth = DepthOf(masks, parents, i);
+    if (depth > TRANSFORM_MAX_DEPTH) {
+      rejected++;
+      continue;
+    }
+    s_depth[i] = static_cast<uint8_t>(depth);
+    levelCount[depth]++;
+  }
+
+  // A child under an orphan or rejected ancestor cannot be resolved either
+  // (its ancestor is not in the order); leave it where it is
+  for (uint32_t i = 0; i < bound; i++) {
+    uint32_t up = i;
+    while (s_depth[up] > 1) {
+      up = parents[up].id;
+    }
+    if (s_depth[i] > 1 && s_depth[up] == 0) {
+      levelCount[s_depth[i]]--;
+      s_depth[i] = 0;
+      rejected++;
+    }
+  }
+
+  // Pass 2: counting sort by depth (ascending ids within a level)
+  uint32_t levels = 0;
+  uint32_t offset = 0;
+  uint32_t cursor[TRANSFORM_MAX_DEPTH + 1];
+  for (uint32_t d = 1; d <= TRANSFORM_MAX_DEPTH; d++) {
+    cursor[d] = offset;
+    offset += levelCount[d];
+    s_levelStart[d] = offset;
+    if (levelCount[d] > 0) {
+      levels = d;
+    }
+  }
+  s_levelStart[0] = 0;
+  for (uint32_t i = 0; i < bound; i++) {
+    const uint32_t depth = s_depth[i];
+    if (depth == 0)
+      continue;
+    const uint32_t slot = cursor[depth]++;
+    s_order[slot] = i;
+    s_orderParent[slot] = parents[i];
+    const float localRot = packet->write.local_rotation[i];
+    s_localRot[slot] = localRot;
+    s_localSin[slot] = sinf(localRot * DEG_TO_RAD);
+    s_localCos[slot] = cosf(localRot * DEG_TO_RAD);
+  }
+
+  memset(s_isRoot, 0, sizeof(s_isRoot));
+  s_rootCount = 0;
+  for (uint32_t k = 0; k < levelCount[1]; k++) {
+    const uint32_t parent = s_orderParent[k].id;
+    if (!s_isRoot[parent]) {
+      s_isRoot[parent] = true;
+      s_roots[s_rootCount++] = parent;
+    }
+  }
+
+  s_levels = levels;
+  s_seenCount = seen;
+  s_dirty = false;
+  s_stats.children = offset;
+  s_stats.levels = levels;
+  s_stats.rebuilds++;
+  s_stats.orphans = orphans;
+  s_stats.rejected = rejected;
+}
+
+// ============================================================================
+// Propagation
+// ============================================================================
+
+/**
+ * @brief Resolve the children in order slots [first, end). Their parents
+ * belong to earlier levels (or are roots), so they are final already.
+ */
+static void ResolveLevel(transformPacket *packet, uint32_t first,
+                         uint32_t end) {
+  const creVec2 *restrict local_pos = packet->write.local_pos;
+  const float *restrict local_rotation = packet->write.local_rotation;
+  const creVec2 *restrict local_scale = packet->write.local_scale;
+  creVec2 *restrict pos = packet->write.pos;
+  float *restrict rotation = packet->write.rotation;
+  creVec2 *restrict visual_scale = packet->write.visual_scale;
+
+  for (uint32_t slot = first; slot < end; slot++) {
+    const uint32_t id = s_order[slot];
+    const uint32_t parent = s_orderParent[slot].id;
+    const float localRot = local_rotation[id];
+    if (localRot < s_localRot[slot] || localRot > s_localRot[slot]) {
+      s_localRot[slot] = localRot;
+      s_localSin[slot] = sinf(localRot * DEG_TO_RAD);
+      s_localCos[slot] = cosf(localRot * DEG_TO_RAD);
+    }
+
+    const creVec2 parentPos = pos[parent];
+    const creVec2 parentScale = visual_scale[parent];
+    const float parentSin = s_sin[parent];
+    const float parentCos = s_cos[parent];
+    const float ox = local_pos[id].x * parentScale.x;
+    const float oy = local_pos[id].y * parentScale.y;
+
+    pos[id] = creVec2{parentPos.x + ox * parentCos - oy * parentSin,
+                      parentPos.y + ox * parentSin + oy * parentCos};
+    rotation[id] = rotation[parent] + localRot;
+    visual_scale[id] = creVec2{parentScale.x * local_scale[id].x,
+                               parentScale.y * local_scale[id].y};
+    s_sin[id] = parentSin * s_localCos[slot] + parentCos * s_localSin[slot];
+    s_cos[id] = parentCos * s_localCos[slot] - parentSin * s_localSin[slot];
+  }
+}
+
+void TransformSystem_Update(transformPacket *packet) {
+  TransformSystem_ProcessCommands(packet);
+
+  if (!ValidateOrder(packet)) {
+    RebuildOrder(packet);
+  }
+
+  const float *rotation = packet->write.rotation;
+  for (uint32_t r = 0; r < s_rootCount; r++) {
+    const uint32_t id = s_roots[r];
+    s_sin[id] = sinf(rotation[id] * DEG_TO_RAD);
+    s_cos[id] = cosf(rotation[id] * DEG_TO_RAD);
+  }
+
+  // Levels in order, so every parent is final before its children read it
+  for (uint32_t level = 1; level <= s_levels; level++) {
+    ResolveLevel(packet, s_levelStart[level - 1], s_levelStart[level]);
+  }
+}
+
+void TransformSystem_Invalidate(void) { s_dirty = true; }
+
+TransformStats TransformSystem_GetStats(void) { return s_stats; }
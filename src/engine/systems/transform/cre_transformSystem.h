@@ -0,0 +1,69 @@
+/**
+ * @file cre_transformSystem.h
+ * @brief Parent/Child Transform Hierarchy (Depth-Sorted Batched Propagation)
+ *
+ * Entities with COMP_HIERARCHY follow a parent. Their world transform is
+ * derived every frame from the parent's and their local one:
+ *
+ *   rotation     = parent.rotation + local_rotation          (degrees)
+ *   visual_scale = parent.visual_scale * local_scale
+ *   pos          = parent.pos + R(parent.rotation) *
+ *                  (local_pos * parent.visual_scale)
+ *
+ * The system keeps a compact copy of the hierarchy, children sorted by depth
+ * (counting sort). Because a level only reads the levels above it, one
+ * linear pass over the order resolves the whole tree: no recursion, no
+ * per-child walk to the root. sin/cos of world rotations are cached per
+ * entity; only roots call into libm each frame, children combine their
+ * parent's values with their (cached) local ones.
+ *
+ * The order is a cache of the registry, not state: every frame it is
+ * validated against parents[] (and the COMP_HIERARCHY count) and rebuilt
+ * when anything changed, so rollback restores need no extra block. Local
+ * values are read straight from the registry, so moving a child does not
+ * rebuild anything.
+ *
+ * A child whose parent died is destroyed (one frame later, through the
+ * bus). Children own their pos: do not give them COMP_PHYSICS.
+ */
+
+#ifndef CRE_TRANSFORMSYSTEM_H
+#define CRE_TRANSFORMSYSTEM_H
+
+#include <stdint.h>
+
+// Forward declarations (dependency injection)
+struct EntityRegistry;
+struct CommandBus;
+struct transformPacket;
+
+struct TransformStats {
+  uint32_t children; ///< Children in the order (orphans excluded)
+  uint32_t levels;   ///< Deepest level in the order
+  uint32_t rebuilds; ///< Order rebuilds since startup
+  uint32_t orphans;  ///< Children destroyed with their parent, last rebuild
+  uint32_t rejected; ///< Children deeper than TRANSFORM_MAX_DEPTH (or cycles)
+};
+
+transformPacket CreateTransformPacket(EntityRegistry *reg, CommandBus *bus);
+
+/**
+ * @brief Process CMD_XFORM_* commands from the bus.
+ * Called automatically by TransformSystem_Update.
+ */
+void TransformSystem_ProcessCommands(transformPacket *packet);
+
+/**
+ * @brief Bring every child's world transform up to date.
+ * Runs after physics and animation, before rendering.
+ */
+void TransformSystem_Update(transformPacket *packet);
+
+/**
+ * @brief Force the next update to rebuild the order.
+ */
+void TransformSystem_Invalidate(void);
+
+TransformStats TransformSystem_GetStats(void);
+
+#endif
@@ -0,0 +1,90 @@
+#include "cre_tweenAPI.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <stdint.h>
+
+static TweenID tweenAPI_Start(const EntityRegistry &reg, Entity entity,
+                              TweenTarget target, TweenEase ease,
+                              float duration, float x, float y, float z,
+                              float w) {
+  const TweenDesc desc = {.entity = entity,
+                          .target = target,
+                          .ease = ease,
+                          .tag = 0,
+                          .duration = duration,
+                          .delay = 0.0f,
+                          .from = {0.0f, 0.0f, 0.0f, 0.0f},
+                          .to = {x, y, z, w},
+                          .fromCurrent = true};
+  return TweenSystem_Start(reg, desc);
+}
+
+TweenID tweenAPI_MoveTo(const EntityRegistry &reg, Entity entity, creVec2 to,
+                        float duration, TweenEase ease) {
+  return tweenAPI_Start(reg, entity, TWEEN_TARGET_POS, ease, duration, to.x,
+                        to.y, 0.0f, 0.0f);
+}
+
+TweenID tweenAPI_RotateTo(const EntityRegistry &reg, Entity entity,
+                          float degrees, float duration, TweenEase ease) {
+  return tweenAPI_Start(reg, entity, TWEEN_TARGET_ROTATION, ease, duration,
+                        degrees, 0.0f, 0.0f, 0.0f);
+}
+
+TweenID tweenAPI_ScaleTo(const EntityRegistry &reg, Entity entity,
+                         creVec2 scale, float duration, TweenEase ease) {
+  return tweenAPI_Start(reg, entity, TWEEN_TARGET_SCALE, ease, duration,
+                        scale.x, scale.y, 0.0f, 0.0f);
+}
+
+TweenID tweenAPI_ColorTo(const EntityRegistry &reg, Entity entity,
+                         creColor color, float duration, TweenEase ease) {
+  return tweenAPI_Start(reg, entity, TWEEN_TARGET_COLOR, ease, duration,
+                        static_cast<float>(color.r),
+                        static_cast<float>(color.g),
+                        static_cast<float>(color.b),
+                        static_cast<float>(color.a));
+}
+
+TweenID tweenAPI_Flash(const EntityRegistry &reg, Entity entity,
+                       creColor flash, float duration) {
+  if (!EntityRegistry_IsAlive(reg, entity))
+    return TWEEN_INVALID;
+  const creColor base = reg.colors[entity.id];
+  const TweenDesc desc = {.entity = entity,
+                          .target = TWEEN_TARGET_COLOR,
+                          .ease = TWEEN_EASE_OUT_QUAD,
+                          .tag = 0,
+                          .duration = duration,
+                          .delay = 0.0f,
+                          .from = {static_cast<float>(flash.r),
+                                   static_cast<float>(flash.g),
+                                   static_cast<float>(flash.b),
+                                   static_cast<float>(flash.a)},
+                          .to = {static_cast<float>(base.r),
+                                 static_cast<float>(base.g),
+                                 static_cast<float>(base.b),
+                                 static_cast<float>(base.a)},
+                          .fromCurrent = false};
+  return TweenSystem_Start(reg, desc);
+}
+
+TweenID tweenAPI_CameraZoomTo(const EntityRegistry &reg, Entity cameraEntity,
+                              float zoom, float duration, TweenEase ease) {
+  return tweenAPI_Start(reg, cameraEntity, TWEEN_TARGET_CAMERA_ZOOM, ease,
+                        duration, zoom, 0.0f, 0.0f, 0.0f);
+}
+
+TweenID tweenAPI_CameraShake(const EntityRegistry &reg, Entity cameraEntity,
+                             creVec2 amplitude, float duration) {
+  // Shake eases oscillate around from: to only sets the amplitude
+  for (uint32_t i = 0; i < MAX_CAMERAS; i++) {
+    const CameraComponent &cam = reg.cameras[i];
+    if (!ENTITY_MATCH(cam.ownerEntity, cameraEntity))
+      continue;
+    const creVec2 base = cam.follow.offset;
+    return tweenAPI_Start(reg, cameraEntity, TWEEN_TARGET_CAMERA_OFFSET,
+                          TWEEN_EASE_SHAKE, duration, base.x + amplitude.x,
+                          base.y + amplitude.y, 0.0f, 0.0f);
+  }
+  return TWEEN_INVALID;
+}
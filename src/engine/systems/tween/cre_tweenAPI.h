@@ -0,0 +1,33 @@
+#ifndef CRE_TWEENAPI_H
+#define CRE_TWEENAPI_H
+
+#include "engine/core/cre_types.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+#include <stdint.h>
+struct EntityRegistry;
+
+// Shorthands for TweenSystem_Start, all starting from the current value.
+TweenID tweenAPI_MoveTo(const EntityRegistry &reg, Entity entity, creVec2 to,
+                        float duration, TweenEase ease);
+TweenID tweenAPI_RotateTo(const EntityRegistry &reg, Entity entity,
+                          float degrees, float duration, TweenEase ease);
+TweenID tweenAPI_ScaleTo(const EntityRegistry &reg, Entity entity,
+                         creVec2 scale, float duration, TweenEase ease);
+TweenID tweenAPI_ColorTo(const EntityRegistry &reg, Entity entity,
+                         creColor color, float duration, TweenEase ease);
+
+/**
+ * @brief Snap to flash, then fade back to the current color.
+ */
+TweenID tweenAPI_Flash(const EntityRegistry &reg, Entity entity,
+                       creColor flash, float duration);
+
+TweenID tweenAPI_CameraZoomTo(const EntityRegistry &reg, Entity cameraEntity,
+                              float zoom, float duration, TweenEase ease);
+
+/**
+ * @brief Shake the camera's follow offset by up to amplitude (decaying).
+ */
+TweenID tweenAPI_CameraShake(const EntityRegistry &reg, Entity cameraEntity,
+                             creVec2 amplitude, float duration);
+#endif
@@ -0,0 +1,501 @@
+#include "cre_tweenSystem.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_simState.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/ecs/cre_components.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+constexpr uint32_t TWEEN_MAX_TWEENS = TWEEN_POOL_CAPACITY * TWEEN_EASE_COUNT;
+static_assert(TWEEN_MAX_TWEENS < 0xFFFF, "Tween handles use 16-bit indices");
+
+static constexpr uint8_t TWEEN_SLOT_FREE = 0xFF;
+static constexpr uint32_t TWEEN_CHANNELS = 4;
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Running tweens of one easing function (SoA, dense).
+ */
+struct TweenPool {
+  alignas(64) float t[TWEEN_POOL_CAPACITY];    // Progress, < 0 while delayed
+  alignas(64) float rate[TWEEN_POOL_CAPACITY]; // 1 / duration
+  alignas(64) float from[TWEEN_CHANNELS][TWEEN_POOL_CAPACITY];
+  alignas(64) float delta[TWEEN_CHANNELS][TWEEN_POOL_CAPACITY]; // to - from
+  alignas(64) Entity entity[TWEEN_POOL_CAPACITY];
+  alignas(64) uint8_t target[TWEEN_POOL_CAPACITY];
+  alignas(64) uint8_t capture[TWEEN_POOL_CAPACITY]; // Read from at t >= 0
+  alignas(64) uint16_t tag[TWEEN_POOL_CAPACITY];
+  alignas(64) uint16_t handle[TWEEN_POOL_CAPACITY]; // Back-reference
+  uint32_t count;
+};
+
+/**
+ * @brief Pools + handle table. A simulation state block: tweens write pos and
+ * rotation, so rollback must restore their progress with those columns.
+ */
+struct TweenStore {
+  TweenPool pools[TWEEN_EASE_COUNT];
+  uint16_t gen[TWEEN_MAX_TWEENS];
+  uint8_t ease[TWEEN_MAX_TWEENS]; // Pool of the handle, or FREE
+  uint16_t dense[TWEEN_MAX_TWEENS];
+  uint16_t freeIDs[TWEEN_MAX_TWEENS];
+  int32_t freeTop;
+};
+
+static TweenStore s_tweens;
+
+// Per-update scratch (one pool at a time)
+alignas(64) static float s_eased[TWEEN_POOL_CAPACITY];
+alignas(64) static float s_value[TWEEN_CHANNELS][TWEEN_POOL_CAPACITY];
+alignas(64) static uint8_t s_alive[TWEEN_POOL_CAPACITY];
+alignas(64) static uint8_t s_write[TWEEN_POOL_CAPACITY]; // Alive, not delayed
+alignas(64) static uint16_t s_bucket[TWEEN_TARGET_COUNT][TWEEN_POOL_CAPACITY];
+
+static TweenEvent s_events[TWEEN_MAX_EVENTS];
+static uint32_t s_eventCount = 0;
+static TweenStats s_stats = {};
+
+// ============================================================================
+// Handle Table
+// ============================================================================
+
+void TweenSystem_Init(void) {
+  memset(s_tweens.gen, 0, sizeof(s_tweens.gen));
+  TweenSystem_Clear();
+  Log(LogLevel::Info, "Tween System Initialized ({} per easing, {} easings)",
+      TWEEN_POOL_CAPACITY, static_cast<uint32_t>(TWEEN_EASE_COUNT));
+}
+
+void TweenSystem_Clear(void) {
+  for (uint32_t e = 0; e < TWEEN_EASE_COUNT; e++) {
+    s_tweens.pools[e].count = 0;
+  }
+
+  // Bump every generation so live handles become stale.
+  s_tweens.freeTop = -1;
+  for (int32_t i = static_cast<int32_t>(TWEEN_MAX_TWEENS) - 1; i >= 0; --i) {
+    s_tweens.gen[i]++;
+    s_tweens.ease[i] = TWEEN_SLOT_FREE;
+    s_tweens.freeIDs[++s_tweens.freeTop] = static_cast<uint16_t>(i);
+  }
+  s_eventCount = 0;
+  s_stats = {.running = 0, .finished = 0, .dropped = 0, .lostEvents = 0};
+}
+
+static bool TweenSystem_IsHandleValid(TweenID tween) {
+  return tween.index < TWEEN_MAX_TWEENS &&
+         s_tweens.gen[tween.index] == tween.gen &&
+         s_tweens.ease[tween.index] != TWEEN_SLOT_FREE;
+}
+
+static void TweenSystem_RemoveDense(uint8_t ease, uint32_t dense) {
+  TweenPool &pool = s_tweens.pools[ease];
+  assert(dense < pool.count);
+
+  const uint16_t index = pool.handle[dense];
+  s_tweens.gen[index]++;
+  s_tweens.ease[index] = TWEEN_SLOT_FREE;
+  s_tweens.freeIDs[++s_tweens.freeTop] = index;
+
+  // Swap-remove, keep the moved tween's handle pointing at its new index.
+  const uint32_t last = --pool.count;
+  if (dense != last) {
+    pool.t[dense] = pool.t[last];
+    pool.rate[dense] = pool.rate[last];
+    for (uint32_t c = 0; c < TWEEN_CHANNELS; c++) {
+      pool.from[c][dense] = pool.from[c][last];
+      pool.delta[c][dense] = pool.delta[c][last];
+    }
+    pool.entity[dense] = pool.entity[last];
+    pool.target[dense] = pool.target[last];
+    pool.capture[dense] = pool.capture[last];
+    pool.tag[dense] = pool.tag[last];
+    pool.handle[dense] = pool.handle[last];
+    s_tweens.dense[pool.handle[dense]] = static_cast<uint16_t>(dense);
+  }
+}
+
+/**
+ * @brief Slot of the camera owned by entity, or MAX_CAMERAS.
+ */
+static uint32_t FindCamera(const CameraComponent *cameras, Entity entity) {
+  for (uint32_t i = 0; i < MAX_CAMERAS; i++) {
+    if (ENTITY_MATCH(cameras[i].ownerEntity, entity))
+      return i;
+  }
+  return MAX_CAMERAS;
+}
+
+/**
+ * @brief Current value of a target (fromCurrent). camera is the slot found
+ * for camera targets; other channels of out are left as they are.
+ */
+static void ReadCurrent(const creVec2 *pos, const float *rotation,
+                        const creVec2 *visual_scale, const creColor *colors,
+                        const CameraComponent *cameras, uint32_t camera,
+                        uint32_t id, uint8_t target, float *out) {
+  switch (static_cast<TweenTarget>(target)) {
+  case TWEEN_TARGET_POS:
+    out[0] = pos[id].x;
+    out[1] = pos[id].y;
+    break;
+  case TWEEN_TARGET_ROTATION:
+    out[0] = rotation[id];
+    break;
+  case TWEEN_TARGET_SCALE:
+    out[0] = visual_scale[id].x;
+    out[1] = visual_scale[id].y;
+    break;
+  case TWEEN_TARGET_COLOR:
+    out[0] = static_cast<float>(colors[id].r);
+    out[1] = static_cast<float>(colors[id].g);
+    out[2] = static_cast<float>(colors[id].b);
+    out[3] = static_cast<float>(colors[id].a);
+    break;
+  case TWEEN_TARGET_CAMERA_ZOOM:
+    out[0] = cameras[camera].zoom;
+    break;
+  case TWEEN_TARGET_CAMERA_OFFSET:
+    out[0] = cameras[camera].follow.offset.x;
+    out[1] = cameras[camera].follow.offset.y;
+    break;
+  case TWEEN_TARGET_COUNT:
+    break;
+  }
+}
+
+// ============================================================================
+// Start / Cancel
+// ============================================================================
+
+TweenID TweenSystem_Start(const EntityRegistry &reg, const TweenDesc &desc) {
+  const bool isCamera = desc.target == TWEEN_TARGET_CAMERA_ZOOM ||
+                        desc.target == TWEEN_TARGET_CAMERA_OFFSET;
+  uint32_t camera = MAX_CAMERAS;
+  if (isCamera) {
+    camera = FindCamera(reg.cameras, desc.entity);
+  }
+  if (desc.target >= TWEEN_TARGET_COUNT || desc.ease >= TWEEN_EASE_COUNT ||
+      !(desc.duration > 0.0f) || !EntityRegistry_IsAlive(reg, desc.entity) ||
+      (isCamera && camera == MAX_CAMERAS)) {
+    Log(LogLevel::Warning, "TweenSystem_Start: Invalid tween for entity {}",
+        desc.entity.id);
+    return TWEEN_INVALID;
+  }
+
+  TweenPool &pool = s_tweens.pools[desc.ease];
+  if (pool.count >= TWEEN_POOL_CAPACITY || s_tweens.freeTop < 0) {
+    Log(LogLevel::Warning, "TweenSystem_Start: Pool {} is full",
+        static_cast<uint32_t>(desc.ease));
+    return TWEEN_INVALID;
+  }
+
+  float from[TWEEN_CHANNELS] = {desc.from[0], desc.from[1], desc.from[2],
+                                desc.from[3]};
+  if (desc.fromCurrent) {
+    ReadCurrent(reg.pos, reg.rotation, reg.visual_scale, reg.colors,
+                reg.cameras, camera, desc.entity.id, desc.target, from);
+  }
+
+  const uint16_t index = s_tweens.freeIDs[s_tweens.freeTop--];
+  const uint32_t dense = pool.count++;
+  const float rate = 1.0f / desc.duration;
+  pool.t[dense] = -std::max(desc.delay, 0.0f) * rate;
+  pool.rate[dense] = rate;
+  for (uint32_t c = 0; c < TWEEN_CHANNELS; c++) {
+    pool.from[c][dense] = from[c];
+    pool.delta[c][dense] = desc.to[c] - from[c];
+  }
+  pool.entity[dense] = desc.entity;
+  pool.target[dense] = desc.target;
+  // A delayed tween starts from the value it finds when the delay ends
+  pool.capture[dense] = desc.fromCurrent && desc.delay > 0.0f;
+  pool.tag[dense] = desc.tag;
+  pool.handle[dense] = index;
+  s_tweens.ease[index] = desc.ease;
+  s_tweens.dense[index] = static_cast<uint16_t>(dense);
+  return TweenID{.index = index, .gen = s_tweens.gen[index]};
+}
+
+void TweenSystem_Cancel(TweenID tween) {
+  if (!TweenSystem_IsHandleValid(tween))
+    return;
+  TweenSystem_RemoveDense(s_tweens.ease[tween.index],
+                          s_tweens.dense[tween.index]);
+}
+
+bool TweenSystem_IsRunning(TweenID tween) {
+  return TweenSystem_IsHandleValid(tween);
+}
+
+void TweenSystem_GetSimState(SimStateBlock *out) {
+  *out = {.name = "tween.store", .base = &s_tweens, .size = sizeof(s_tweens)};
+}
+
+tweenPacket CreateTweenPacket(EntityRegistry *reg, float dt) {
+  tweenPacket pkt = {
+      .dt = dt,
+      .read = {.state_flags = reg->state_flags,
+               .generations = reg->generations},
+      .write = {.pos = reg->pos,
+                .rotation = reg->rotation,
+                .visual_scale = reg->visual_scale,
+                .colors = reg->colors,
+                .cameras = reg->cameras},
+  };
+  return pkt;
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+static inline float Clamp01(float t) {
+  return std::min(std::max(t, 0.0f), 1.0f);
+}
+
+/**
+ * @brief s_eased[i] = ease(clamp(t[i])). One loop per easing function, the
+ * switch is outside the loop.
+ */
+static void EvaluateEase(uint8_t ease, const float *restrict t, uint32_t n) {
+  float *restrict out = s_eased;
+  switch (static_cast<TweenEase>(ease)) {
+  case TWEEN_EASE_LINEAR:
+    for (uint32_t i = 0; i < n; i++) {
+      out[i] = Clamp01(t[i]);
+    }
+    break;
+  case TWEEN_EASE_IN_QUAD:
+    for (uint32_t i = 0; i < n; i++) {
+      const float u = Clamp01(t[i]);
+      out[i] = u * u;
+    }
+    break;
+  case TWEEN_EASE_OUT_QUAD:
+    for (uint32_t i = 0; i < n; i++) {
+      const float u = Clamp01(t[i]);
+      out[i] = u * (2.0f - u);
+    }
+    break;
+  case TWEEN_EASE_IN_OUT_QUAD:
+    for (uint32_t i = 0; i < n; i++) {
+      const float u = Clamp01(t[i]);
+      const float v = 1.0f - u;
+      out[i] = (u < 0.5f) ? 2.0f * u * u : 1.0f - 2.0f * v * v;
+    }
+    break;
+  case TWEEN_EASE_OUT_CUBIC:
+    for (uint32_t i = 0; i < n; i++) {
+      const float v = 1.0f - Clamp01(t[i]);
+      out[i] = 1.0f - v * v * v;
+    }
+    break;
+  case TWEEN_EASE_OUT_BACK: {
+    const float c1 = 1.70158f;
+    const float c3 = c1 + 1.0f;
+    for (uint32_t i = 0; i < n; i++) {
+      const float v = Clamp01(t[i]) - 1.0f;
+      out[i] = 1.0f + c3 * v * v * v + c1 * v * v;
+    }
+    break;
+  }
+  case TWEEN_EASE_SHAKE: {
+    const float omega = 2.0f * 3.14159265f * TWEEN_SHAKE_CYCLES;
+    for (uint32_t i = 0; i < n; i++) {
+      const float u = Clamp01(t[i]);
+      out[i] = sinf(u * omega) * (1.0f - u);
+    }
+    break;
+  }
+  case TWEEN_EASE_COUNT:
+    break;
+  }
+}
+
+static inline uint8_t ToColorChannel(float v) {
+  return static_cast<uint8_t>(std::min(std::max(v, 0.0f), 255.0f) + 0.5f);
+}
+
+static void EmitEvent(uint8_t ease, uint32_t dense, bool finished) {
+  const TweenPool &pool = s_tweens.pools[ease];
+  if (s_eventCount >= TWEEN_MAX_EVENTS) {
+    s_stats.lostEvents++;
+    return;
+  }
+  const uint16_t index = pool.handle[dense];
+  s_events[s_eventCount++] = {
+      .id = TweenID{.index = index, .gen = s_tweens.gen[index]},
+      .entity = pool.entity[dense],
+      .tag = pool.tag[dense],
+      .target = static_cast<TweenTarget>(pool.target[dense]),
+      .finished = finished};
+}
+
+static void UpdatePool(tweenPacket *packet, uint8_t ease) {
+  TweenPool &pool = s_tweens.pools[ease];
+  const uint32_t n = pool.count;
+  if (n == 0)
+    return;
+
+  const uint64_t *flags = packet->read.state_flags;
+  const uint32_t *generations = packet->read.generations;
+  creVec2 *pos = packet->write.pos;
+  float *rotation = packet->write.rotation;
+  creVec2 *visual_scale = packet->write.visual_scale;
+  creColor *colors = packet->write.colors;
+  CameraComponent *cameras = packet->write.cameras;
+
+  // Advance
+  const float dt = packet->dt;
+  float *restrict t = pool.t;
+  const float *restrict rate = pool.rate;
+  for (uint32_t i = 0; i < n; i++) {
+    t[i] += dt * rate[i];
+  }
+
+  // Delays that ended this update: take from out of the registry now, so
+  // the tween does not jump back to the value it saw when it was started
+  for (uint32_t i = 0; i < n; i++) {
+    if (!pool.capture[i] || t[i] < 0.0f)
+      continue;
+    pool.capture[i] = 0;
+    uint32_t camera = MAX_CAMERAS;
+    const uint8_t target = pool.target[i];
+    if (target == TWEEN_TARGET_CAMERA_ZOOM ||
+        target == TWEEN_TARGET_CAMERA_OFFSET) {
+      camera = FindCamera(cameras, pool.entity[i]);
+      if (camera == MAX_CAMERAS)
+        continue; // Dropped by the scatter below
+    }
+    float from[TWEEN_CHANNELS];
+    for (uint32_t c = 0; c < TWEEN_CHANNELS; c++) {
+      from[c] = pool.from[c][i];
+    }
+    ReadCurrent(pos, rotation, visual_scale, colors, cameras, camera,
+                pool.entity[i].id, target, from);
+    for (uint32_t c = 0; c < TWEEN_CHANNELS; c++) {
+      const float to = pool.from[c][i] + pool.delta[c][i];
+      pool.from[c][i] = from[c];
+      pool.delta[c][i] = to - from[c];
+    }
+  }
+
+  // Ease + lerp every channel (unused channels are computed, not written)
+  EvaluateEase(ease, t, n);
+  for (uint32_t c = 0; c < TWEEN_CHANNELS; c++) {
+    const float *restrict from = pool.from[c];
+    const float *restrict delta = pool.delta[c];
+    float *restrict value = s_value[c];
+    for (uint32_t i = 0; i < n; i++) {
+      value[i] = from[i] + delta[i] * s_eased[i];
+    }
+  }
+
+  // Scatter. Indices are bucketed by target first: swap-removes shuffle the
+  // targets inside a pool, and a per-tween switch then mispredicts. Delayed
+  // tweens leave their target alone (something else may be moving it).
+  uint32_t bucketCount[TWEEN_TARGET_COUNT] = {};
+  for (uint32_t i = 0; i < n; i++) {
+    const uint8_t target = pool.target[i];
+    s_bucket[target][bucketCount[target]++] = static_cast<uint16_t>(i);
+    s_alive[i] = EntityRegistry_IsAlive(flags, generations, pool.entity[i]);
+    s_write[i] = s_alive[i] && t[i] >= 0.0f;
+  }
+
+  const float *restrict v0 = s_value[0];
+  const float *restrict v1 = s_value[1];
+  const float *restrict v2 = s_value[2];
+  const float *restrict v3 = s_value[3];
+  const Entity *restrict entity = pool.entity;
+  const uint8_t *restrict write = s_write;
+  const uint16_t *restrict bucket = s_bucket[TWEEN_TARGET_POS];
+  for (uint32_t k = 0; k < bucketCount[TWEEN_TARGET_POS]; k++) {
+    const uint32_t i = bucket[k];
+    if (write[i])
+      pos[entity[i].id] = creVec2{v0[i], v1[i]};
+  }
+  bucket = s_bucket[TWEEN_TARGET_ROTATION];
+  for (uint32_t k = 0; k < bucketCount[TWEEN_TARGET_ROTATION]; k++) {
+    const uint32_t i = bucket[k];
+    if (write[i])
+      rotation[entity[i].id] = v0[i];
+  }
+  bucket = s_bucket[TWEEN_TARGET_SCALE];
+  for (uint32_t k = 0; k < bucketCount[TWEEN_TARGET_SCALE]; k++) {
+    const uint32_t i = bucket[k];
+    if (write[i])
+      visual_scale[entity[i].id] = creVec2{v0[i], v1[i]};
+  }
+  bucket = s_bucket[TWEEN_TARGET_COLOR];
+  for (uint32_t k = 0; k < bucketCount[TWEEN_TARGET_COLOR]; k++) {
+    const uint32_t i = bucket[k];
+    if (write[i])
+      colors[entity[i].id] =
+          creColor{ToColorChannel(v0[i]), ToColorChannel(v1[i]),
+                   ToColorChannel(v2[i]), ToColorChannel(v3[i])};
+  }
+
+  // Cameras: a handful at most, resolved by owner every frame
+  for (uint32_t target = TWEEN_TARGET_CAMERA_ZOOM;
+       target <= TWEEN_TARGET_CAMERA_OFFSET; target++) {
+    bucket = s_bucket[target];
+    for (uint32_t k = 0; k < bucketCount[target]; k++) {
+      const uint32_t i = bucket[k];
+      if (!s_alive[i])
+        continue;
+      const uint32_t camera = FindCamera(cameras, pool.entity[i]);
+      if (camera == MAX_CAMERAS) {
+        s_alive[i] = 0;
+      } else if (!s_write[i]) {
+        continue;
+      } else if (target == TWEEN_TARGET_CAMERA_ZOOM) {
+        cameras[camera].zoom = std::min(std::max(v0[i], MIN_ZOOM), MAX_ZOOM);
+      } else {
+        cameras[camera].follow.offset = creVec2{v0[i], v1[i]};
+      }
+    }
+  }
+
+  // Retire, back to front so swap-remove only moves visited tweens
+  for (uint32_t i = n; i-- > 0;) {
+    const bool done = t[i] >= 1.0f;
+    if (!done && s_alive[i])
+      continue;
+    if (s_alive[i]) {
+      s_stats.finished++;
+    } else {
+      s_stats.dropped++;
+    }
+    EmitEvent(ease, i, s_alive[i] != 0);
+    TweenSystem_RemoveDense(ease, i);
+  }
+}
+
+void TweenSystem_Update(tweenPacket *packet) {
+  s_eventCount = 0;
+  s_stats.finished = 0;
+  s_stats.dropped = 0;
+  s_stats.lostEvents = 0;
+
+  uint32_t running = 0;
+  for (uint8_t ease = 0; ease < TWEEN_EASE_COUNT; ease++) {
+    UpdatePool(packet, ease);
+    running += s_tweens.pools[ease].count;
+  }
+  s_stats.running = running;
+}
+
+const TweenEvent *TweenSystem_GetEvents(uint32_t *count) {
+  *count = s_eventCount;
+  return s_events;
+}
+
+TweenStats TweenSystem_GetStats(void) { return s_stats; }
@@ -0,0 +1,135 @@
+/**
+ * @file cre_tweenSystem.h
+ * @brief SoA Tween System (Pools per Easing Function)
+ *
+ * A tween interpolates one registry value from -> to over a duration and
+ * writes it straight into the column every frame, without bus commands:
+ *
+ *   TWEEN_TARGET_POS            pos[]                  (x, y)
+ *   TWEEN_TARGET_ROTATION       rotation[]             (degrees)
+ *   TWEEN_TARGET_SCALE          visual_scale[]         (x, y)
+ *   TWEEN_TARGET_COLOR          colors[]               (r, g, b, a: 0-255)
+ *   TWEEN_TARGET_CAMERA_ZOOM    cameras[].zoom         (entity = camera owner)
+ *   TWEEN_TARGET_CAMERA_OFFSET  cameras[].follow.offset
+ *
+ * Running tweens live in one dense SoA pool per easing function, so each
+ * pool is evaluated by straight loops without a per-tween switch: advance,
+ * ease, lerp all four channels, then scatter into the registry one target
+ * at a time. Finished tweens are swap-removed and reported once through
+ * TweenSystem_GetEvents.
+ *
+ * A delayed tween does not touch its target until the delay ends; with
+ * fromCurrent it reads from at that moment, not when it was started.
+ *
+ * Tweens of dead entities (or cameras) are dropped and reported with
+ * finished = false. Tweens write pos and rotation, so the pools are a
+ * simulation state block and roll back with those columns. They still
+ * advance once per frame, not per tick: keep gameplay motion in physics,
+ * and do not tween the pos of a physics body or a hierarchy child.
+ */
+
+#ifndef CRE_TWEENSYSTEM_H
+#define CRE_TWEENSYSTEM_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Forward declarations (dependency injection)
+struct EntityRegistry;
+struct SimStateBlock;
+struct tweenPacket;
+
+enum TweenEase : uint8_t {
+  TWEEN_EASE_LINEAR = 0,
+  TWEEN_EASE_IN_QUAD,
+  TWEEN_EASE_OUT_QUAD,
+  TWEEN_EASE_IN_OUT_QUAD,
+  TWEEN_EASE_OUT_CUBIC,
+  TWEEN_EASE_OUT_BACK, ///< Overshoots the target, then settles
+  TWEEN_EASE_SHAKE,    ///< Decaying oscillation of amplitude to - from,
+                       ///< ends back at from (camera shake, hit wobble)
+  TWEEN_EASE_COUNT
+};
+
+enum TweenTarget : uint8_t {
+  TWEEN_TARGET_POS = 0,
+  TWEEN_TARGET_ROTATION,
+  TWEEN_TARGET_SCALE,
+  TWEEN_TARGET_COLOR,
+  TWEEN_TARGET_CAMERA_ZOOM,
+  TWEEN_TARGET_CAMERA_OFFSET,
+  TWEEN_TARGET_COUNT
+};
+
+struct TweenDesc {
+  Entity entity;
+  TweenTarget target;
+  TweenEase ease;
+  uint16_t tag;     ///< Caller data, echoed in the completion event
+  float duration;   ///< Seconds (> 0)
+  float delay;      ///< Seconds before the tween starts writing
+  float from[4];    ///< Unused channels are ignored
+  float to[4];
+  bool fromCurrent; ///< Read from out of the registry instead
+};
+
+struct TweenEvent {
+  TweenID id;
+  Entity entity;
+  uint16_t tag;
+  TweenTarget target;
+  bool finished; ///< false: dropped (entity or camera died)
+};
+
+struct TweenStats {
+  uint32_t running;   ///< Tweens in all pools
+  uint32_t finished;  ///< Completed during the last update
+  uint32_t dropped;   ///< Target died during the last update
+  uint32_t lostEvents; ///< Events past TWEEN_MAX_EVENTS, last update
+};
+
+/**
+ * @brief Reset every pool and handle. Call once at engine startup.
+ */
+void TweenSystem_Init(void);
+
+/**
+ * @brief Stop every tween and invalidate all handles (scene changes).
+ */
+void TweenSystem_Clear(void);
+
+/**
+ * @brief Start a tween. Synchronous: it runs from the next update.
+ * @return Handle, or TWEEN_INVALID (bad target, pool full)
+ */
+TweenID TweenSystem_Start(const EntityRegistry &reg, const TweenDesc &desc);
+
+/**
+ * @brief Stop a tween where it is (no event). Stale handles are ignored.
+ */
+void TweenSystem_Cancel(TweenID tween);
+
+bool TweenSystem_IsRunning(TweenID tween);
+
+/**
+ * @brief Pools and handle table (see cre_simState.h).
+ */
+void TweenSystem_GetSimState(SimStateBlock *out);
+
+tweenPacket CreateTweenPacket(EntityRegistry *reg, float dt);
+
+/**
+ * @brief Advance every pool and write the values into the registry.
+ * Runs after animation and before the transform hierarchy.
+ */
+void TweenSystem_Update(tweenPacket *packet);
+
+/**
+ * @brief Tweens that ended during the last update (valid until the next).
+ */
+const TweenEvent *TweenSystem_GetEvents(uint32_t *count);
+
+TweenStats TweenSystem_GetStats(void);
+
+#endif
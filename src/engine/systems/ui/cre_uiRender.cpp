@@ -0,0 +1,40 @@
+/**
+ * @file cre_uiRender.cpp
+ * @brief UI Draw List Submission (client only)
+ *
+ * Kept apart from cre_uiSystem.cpp so the headless build can lay out and
+ * benchmark the UI without the renderer.
+ */
+#include "cre_uiSystem.h"
+#include "engine/systems/render/cre_rendererCore.h"
+
+void UISystem_Render(void) {
+  uint32_t count = 0;
+  const UIDrawCmd *cmds = UISystem_GetDrawList(&count);
+  if (count == 0)
+    return;
+
+  creColor tint = cmds[0].quads[0].color;
+  if (!rendererCore_BeginAtlasQuads(tint))
+    return;
+  for (uint32_t c = 0; c < count; c++) {
+    const UIDrawCmd &cmd = cmds[c];
+    for (uint32_t q = 0; q < cmd.count; q++) {
+      const UIQuad &quad = cmd.quads[q];
+      const creColor color = quad.color;
+      if (color.r != tint.r || color.g != tint.g || color.b != tint.b ||
+          color.a != tint.a) {
+        tint = color;
+        rendererCore_AtlasTint(tint);
+      }
+      rendererCore_AtlasQuad(
+          creRectangle{static_cast<float>(quad.srcX),
+                       static_cast<float>(quad.srcY),
+                       static_cast<float>(quad.srcW),
+                       static_cast<float>(quad.srcH)},
+          creRectangle{cmd.origin.x + quad.dest.x, cmd.origin.y + quad.dest.y,
+                       quad.dest.width, quad.dest.height});
+    }
+  }
+  rendererCore_EndAtlasQuads();
+}
@@ -0,0 +1,648 @@
+#include "cre_uiSystem.h"
+#include "assets/atlas/atlas_data.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/systems/render/cre_textLayout.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+static constexpr uint16_t UI_NIL = 0xFFFF;
+static constexpr uint16_t UI_ROOT = 0;
+// Background + one quad per label byte (a sprite needs two)
+static constexpr uint32_t UI_QUADS_PER_WIDGET = UI_TEXT_LENGTH;
+
+static_assert(UI_MAX_WIDGETS < UI_NIL, "Widget indices must fit below UI_NIL");
+static_assert(UI_TEXT_LENGTH >= 2, "Sprites need a background and one quad");
+
+enum UIFlags : uint8_t {
+  UI_FLAG_ALIVE = 1 << 0,
+  UI_FLAG_VISIBLE = 1 << 1,
+  UI_FLAG_DIRTY_MEASURE = 1 << 2, // Fit size must be recomputed
+  UI_FLAG_DIRTY_ARRANGE = 1 << 3, // Children must be placed again
+  UI_FLAG_DIRTY_QUADS = 1 << 4,   // Cached quads must be rebuilt
+};
+
+static constexpr uint8_t UI_FLAGS_DIRTY =
+    UI_FLAG_DIRTY_MEASURE | UI_FLAG_DIRTY_ARRANGE | UI_FLAG_DIRTY_QUADS;
+
+enum UIContent : uint8_t {
+  UI_CONTENT_NONE = 0,
+  UI_CONTENT_TEXT,
+  UI_CONTENT_SPRITE
+};
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Tree links and flags, touched by every walk.
+ */
+struct UITree {
+  uint16_t parent[UI_MAX_WIDGETS];
+  uint16_t firstChild[UI_MAX_WIDGETS];
+  uint16_t lastChild[UI_MAX_WIDGETS];
+  uint16_t nextSibling[UI_MAX_WIDGETS]; // Free list link for dead slots
+  uint16_t prevSibling[UI_MAX_WIDGETS];
+  uint16_t gen[UI_MAX_WIDGETS];
+  uint8_t flags[UI_MAX_WIDGETS];
+  uint16_t freeHead;
+  uint32_t alive;
+};
+
+/**
+ * @brief Style, content and layout results.
+ */
+struct UIWidgets {
+  UIStyle style[UI_MAX_WIDGETS];
+  creVec2 measured[UI_MAX_WIDGETS]; // Fit size (FIXED axes: the value)
+  creVec2 size[UI_MAX_WIDGETS];     // Arranged size
+  creVec2 local[UI_MAX_WIDGETS];    // Position inside the parent
+  creVec2 absolute[UI_MAX_WIDGETS]; // Screen position, last draw list
+  UIContent content[UI_MAX_WIDGETS];
+  char text[UI_MAX_WIDGETS][UI_TEXT_LENGTH];
+  int32_t fontSize[UI_MAX_WIDGETS];
+  uint32_t spriteID[UI_MAX_WIDGETS];
+  creColor contentColor[UI_MAX_WIDGETS];
+  uint8_t quadCount[UI_MAX_WIDGETS];
+};
+
+static UITree s_tree = {};
+static UIWidgets s_widgets = {};
+static UIQuad s_quads[UI_MAX_WIDGETS][UI_QUADS_PER_WIDGET];
+static UIDrawCmd s_drawList[UI_MAX_WIDGETS];
+static uint32_t s_drawCount = 0;
+static uint32_t s_drawQuads = 0;
+static bool s_listDirty = true;
+static UIStats s_stats = {};
+
+static constexpr UIStyle UI_ROOT_STYLE = {
+    .width = {.mode = UI_SIZE_FIXED, .value = 0.0f},
+    .height = {.mode = UI_SIZE_FIXED, .value = 0.0f},
+    .direction = UI_DIR_COLUMN,
+    .justify = UI_JUSTIFY_START,
+    .align = UI_ALIGN_START,
+    .padding = 0.0f,
+    .gap = 0.0f,
+    .background = {0, 0, 0, 0}};
+
+// ============================================================================
+// Handles & Dirty Marking
+// ============================================================================
+
+static bool UISystem_IsHandleValid(UIWidgetID widget) {
+  return widget.index < UI_MAX_WIDGETS &&
+         (s_tree.flags[widget.index] & UI_FLAG_ALIVE) &&
+         s_tree.gen[widget.index] == widget.gen;
+}
+
+/**
+ * @brief Dirty the widget and every ancestor: their fit size and the
+ * placement of their children may depend on it.
+ */
+static void MarkDirty(uint16_t index) {
+  s_tree.flags[index] |= UI_FLAG_DIRTY_QUADS;
+  for (uint16_t i = index; i != UI_NIL; i = s_tree.parent[i]) {
+    s_tree.flags[i] |= UI_FLAG_DIRTY_MEASURE | UI_FLAG_DIRTY_ARRANGE;
+  }
+}
+
+static void ResetSlot(uint16_t index) {
+  s_tree.parent[index] = UI_NIL;
+  s_tree.firstChild[index] = UI_NIL;
+  s_tree.lastChild[index] = UI_NIL;
+  s_tree.nextSibling[index] = UI_NIL;
+  s_tree.prevSibling[index] = UI_NIL;
+  s_widgets.content[index] = UI_CONTENT_NONE;
+  s_widgets.text[index][0] = '\0';
+  s_widgets.quadCount[index] = 0;
+  s_widgets.measured[index] = creVec2{0.0f, 0.0f};
+  s_widgets.size[index] = creVec2{-1.0f, -1.0f}; // First arrange resizes
+  s_widgets.local[index] = creVec2{0.0f, 0.0f};
+  s_widgets.absolute[index] = creVec2{0.0f, 0.0f};
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void UISystem_Init(void) {
+  s_tree = {};
+  UISystem_Clear();
+  Log(LogLevel::Info, "UI System Initialized ({} widgets)", UI_MAX_WIDGETS);
+}
+
+void UISystem_Clear(void) {
+  for (uint32_t i = 0; i < UI_MAX_WIDGETS; i++) {
+    const uint16_t index = static_cast<uint16_t>(i);
+    ResetSlot(index);
+    if (s_tree.flags[i] & UI_FLAG_ALIVE) {
+      s_tree.gen[i]++;
+    }
+    s_tree.flags[i] = 0;
+    s_tree.nextSibling[i] =
+        (i + 1 < UI_MAX_WIDGETS) ? static_cast<uint16_t>(i + 1) : UI_NIL;
+  }
+  s_tree.freeHead = 1;
+
+  // Root: never freed, sized by UISystem_Update
+  ResetSlot(UI_ROOT);
+  s_tree.flags[UI_ROOT] = UI_FLAG_ALIVE | UI_FLAG_VISIBLE | UI_FLAGS_DIRTY;
+  s_widgets.style[UI_ROOT] = UI_ROOT_STYLE;
+  s_tree.alive = 1;
+  s_drawCount = 0;
+  s_drawQuads = 0;
+  s_listDirty = true;
+}
+
+UIWidgetID UISystem_GetRoot(void) {
+  return UIWidgetID{.index = UI_ROOT, .gen = s_tree.gen[UI_ROOT]};
+}
+
+UIWidgetID UISystem_Create(UIWidgetID parent, const UIStyle &style) {
+  if (!UISystem_IsHandleValid(parent))
+    return UI_INVALID;
+  const uint16_t index = s_tree.freeHead;
+  if (index == UI_NIL) {
+    Log(LogLevel::Warning, "UISystem_Create: All {} widgets in use",
+        UI_MAX_WIDGETS);
+    return UI_INVALID;
+  }
+  s_tree.freeHead = s_tree.nextSibling[index];
+  s_tree.alive++;
+
+  ResetSlot(index);
+  s_tree.flags[index] = UI_FLAG_ALIVE | UI_FLAG_VISIBLE;
+  s_widgets.style[index] = style;
+
+  // Append to the parent's children
+  const uint16_t p = parent.index;
+  s_tree.parent[index] = p;
+  s_tree.prevSibling[index] = s_tree.lastChild[p];
+  if (s_tree.lastChild[p] != UI_NIL) {
+    s_tree.nextSibling[s_tree.lastChild[p]] = index;
+  } else {
+    s_tree.firstChild[p] = index;
+  }
+  s_tree.lastChild[p] = index;
+
+  MarkDirty(index);
+  return UIWidgetID{.index = index, .gen = s_tree.gen[index]};
+}
+
+void UISystem_Destroy(UIWidgetID widget) {
+  if (!UISystem_IsHandleValid(widget) || widget.index == UI_ROOT)
+    return;
+
+  // Unlink from the parent, which has to re-layout
+  const uint16_t index = widget.index;
+  const uint16_t p = s_tree.parent[index];
+  const uint16_t prev = s_tree.prevSibling[index];
+  const uint16_t next = s_tree.nextSibling[index];
+  if (prev != UI_NIL) {
+    s_tree.nextSibling[prev] = next;
+  } else {
+    s_tree.firstChild[p] = next;
+  }
+  if (next != UI_NIL) {
+    s_tree.prevSibling[next] = prev;
+  } else {
+    s_tree.lastChild[p] = prev;
+  }
+  MarkDirty(p);
+  s_listDirty = true;
+
+  // Free the subtree (children are pushed before the slot's links are reused)
+  uint16_t stack[UI_MAX_WIDGETS];
+  uint32_t top = 0;
+  stack[top++] = index;
+  while (top > 0) {
+    const uint16_t i = stack[--top];
+    for (uint16_t c = s_tree.firstChild[i]; c != UI_NIL;
+         c = s_tree.nextSibling[c]) {
+      stack[top++] = c;
+    }
+    s_tree.gen[i]++;
+    s_tree.flags[i] = 0;
+    s_tree.nextSibling[i] = s_tree.freeHead;
+    s_tree.freeHead = i;
+    s_tree.alive--;
+  }
+}
+
+// ============================================================================
+// Setters
+// ============================================================================
+
+void UISystem_SetStyle(UIWidgetID widget, const UIStyle &style) {
+  if (!UISystem_IsHandleValid(widget))
+    return;
+  UIStyle &dst = s_widgets.style[widget.index];
+  if (widget.index == UI_ROOT) {
+    const UISize width = dst.width;
+    const UISize height = dst.height;
+    dst = style;
+    dst.width = width;
+    dst.height = height;
+  } else {
+    dst = style;
+  }
+  MarkDirty(widget.index);
+}
+
+void UISystem_SetText(UIWidgetID widget, const char *text, int32_t fontSize,
+                      creColor color) {
+  if (!UISystem_IsHandleValid(widget) || !text)
+    return;
+  const uint16_t i = widget.index;
+  const size_t length = strnlen(text, UI_TEXT_LENGTH - 1);
+  char *dst = s_widgets.text[i];
+  const creColor old = s_widgets.contentColor[i];
+  if (s_widgets.content[i] == UI_CONTENT_TEXT &&
+      s_widgets.fontSize[i] == fontSize && old.r == color.r &&
+      old.g == color.g && old.b == color.b && old.a == color.a &&
+      strncmp(dst, text, length) == 0 && dst[length] == '\0')
+    return;
+
+  memcpy(dst, text, length);
+  dst[length] = '\0';
+  s_widgets.content[i] = UI_CONTENT_TEXT;
+  s_widgets.fontSize[i] = fontSize;
+  s_widgets.contentColor[i] = color;
+  MarkDirty(i);
+}
+
+void UISystem_SetTextF(UIWidgetID widget, int32_t fontSize, creColor color,
+                       const char *fmt, ...) {
+  char buffer[UI_TEXT_LENGTH];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  va_end(args);
+  UISystem_SetText(widget, buffer, fontSize, color);
+}
+
+void UISystem_SetSprite(UIWidgetID widget, uint32_t spriteID,
+                        creColor tint) {
+  if (!UISystem_IsHandleValid(widget))
+    return;
+  const uint16_t i = widget.index;
+  const uint32_t sprite =
+      (spriteID < SPRITE_COUNT) ? spriteID : static_cast<uint32_t>(SPR_MISSING);
+  const creColor old = s_widgets.contentColor[i];
+  if (s_widgets.content[i] == UI_CONTENT_SPRITE &&
+      s_widgets.spriteID[i] == sprite && old.r == tint.r && old.g == tint.g &&
+      old.b == tint.b && old.a == tint.a)
+    return;
+  s_widgets.content[i] = UI_CONTENT_SPRITE;
+  s_widgets.spriteID[i] = sprite;
+  s_widgets.contentColor[i] = tint;
+  MarkDirty(i);
+}
+
+void UISystem_SetVisible(UIWidgetID widget, bool visible) {
+  if (!UISystem_IsHandleValid(widget) || widget.index == UI_ROOT)
+    return;
+  uint8_t &flags = s_tree.flags[widget.index];
+  if (((flags & UI_FLAG_VISIBLE) != 0) == visible)
+    return;
+  flags = visible ? static_cast<uint8_t>(flags | UI_FLAG_VISIBLE)
+                  : static_cast<uint8_t>(flags & ~UI_FLAG_VISIBLE);
+  MarkDirty(widget.index);
+  s_listDirty = true;
+}
+
+void UISystem_Invalidate(void) {
+  for (uint32_t i = 0; i < UI_MAX_WIDGETS; i++) {
+    if (s_tree.flags[i] & UI_FLAG_ALIVE) {
+      s_tree.flags[i] |= UI_FLAGS_DIRTY;
+    }
+  }
+}
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+static creVec2 ContentSize(uint16_t i) {
+  switch (s_widgets.content[i]) {
+  case UI_CONTENT_TEXT: {
+    const char *text = s_widgets.text[i];
+    return textLayout_Measure(text, static_cast<uint32_t>(strlen(text)),
+                              s_widgets.fontSize[i]);
+  }
+  case UI_CONTENT_SPRITE: {
+    const SpriteMeta &meta = ASSET_SPRITES[s_widgets.spriteID[i]];
+    return creVec2{static_cast<float>(meta.origW),
+                   static_cast<float>(meta.origH)};
+  }
+  case UI_CONTENT_NONE:
+    break;
+  }
+  return creVec2{0.0f, 0.0f};
+}
+
+/**
+ * @brief Fit size of a widget, bottom-up. Clean widgets return their cached
+ * size, so only dirty paths are walked.
+ */
+static creVec2 Measure(uint16_t i) {
+  if (!(s_tree.flags[i] & UI_FLAG_DIRTY_MEASURE))
+    return s_widgets.measured[i];
+  s_tree.flags[i] &= static_cast<uint8_t>(~UI_FLAG_DIRTY_MEASURE);
+  s_stats.measured++;
+
+  const UIStyle &style = s_widgets.style[i];
+  const bool row = (style.direction == UI_DIR_ROW);
+  float main = 0.0f;
+  float cross = 0.0f;
+  uint32_t visible = 0;
+  for (uint16_t c = s_tree.firstChild[i]; c != UI_NIL;
+       c = s_tree.nextSibling[c]) {
+    if (!(s_tree.flags[c] & UI_FLAG_VISIBLE))
+      continue;
+    const creVec2 child = Measure(c);
+    main += row ? child.x : child.y;
+    const float childCross = row ? child.y : child.x;
+    cross = (childCross > cross) ? childCross : cross;
+    visible++;
+  }
+  if (visible > 1) {
+    main += style.gap * static_cast<float>(visible - 1);
+  }
+
+  const creVec2 content = ContentSize(i);
+  float fitW = row ? main : cross;
+  float fitH = row ? cross : main;
+  fitW = (content.x > fitW) ? content.x : fitW;
+  fitH = (content.y > fitH) ? content.y : fitH;
+
+  const float padding = 2.0f * style.padding;
+  const creVec2 measured = {
+      (style.width.mode == UI_SIZE_FIXED) ? style.width.value : fitW + padding,
+      (style.height.mode == UI_SIZE_FIXED) ? style.height.value
+                                           : fitH + padding};
+  s_widgets.measured[i] = measured;
+  return measured;
+}
+
+static void RebuildQuads(uint16_t i) {
+  const UIStyle &style = s_widgets.style[i];
+  const creVec2 size = s_widgets.size[i];
+  const float pad = style.padding;
+  UIQuad *quads = s_quads[i];
+  uint32_t count = 0;
+
+  if (style.background.a > 0) {
+    quads[count++] = UIQuad{.dest = {0.0f, 0.0f, size.x, size.y},
+                            .srcX = ATLAS_WHITE_X,
+                            .srcY = ATLAS_WHITE_Y,
+                            .srcW = ATLAS_WHITE_SIZE,
+                            .srcH = ATLAS_WHITE_SIZE,
+                            .color = style.background};
+  }
+
+  const creColor color = s_widgets.contentColor[i];
+  switch (s_widgets.content[i]) {
+  case UI_CONTENT_TEXT: {
+    const char *text = s_widgets.text[i];
+    TextCursor cursor = textLayout_Begin(
+        text, static_cast<uint32_t>(strlen(text)), s_widgets.fontSize[i]);
+    TextGlyph glyph;
+    while (textLayout_Next(&cursor, &glyph)) {
+      const GlyphMeta &g = ASSET_GLYPHS[glyph.glyph];
+      quads[count++] = UIQuad{
+          .dest = {pad + glyph.x, pad + glyph.y,
+                   static_cast<float>(g.w) * cursor.scale,
+                   static_cast<float>(g.h) * cursor.scale},
+          .srcX = g.x,
+          .srcY = g.y,
+          .srcW = g.w,
+          .srcH = g.h,
+          .color = color};
+    }
+    break;
+  }
+  case UI_CONTENT_SPRITE: {
+    // The content box spans the untrimmed image; only the trimmed pixels
+    // are drawn, at their scaled offset
+    const SpriteMeta &meta = ASSET_SPRITES[s_widgets.spriteID[i]];
+    const float scaleX = (size.x - 2.0f * pad) / static_cast<float>(meta.origW);
+    const float scaleY = (size.y - 2.0f * pad) / static_cast<float>(meta.origH);
+    quads[count++] =
+        UIQuad{.dest = {pad + static_cast<float>(meta.offX) * scaleX,
+                        pad + static_cast<float>(meta.offY) * scaleY,
+                        static_cast<float>(meta.w) * scaleX,
+                        static_cast<float>(meta.h) * scaleY},
+               .srcX = meta.x,
+               .srcY = meta.y,
+               .srcW = meta.w,
+               .srcH = meta.h,
+               .color = color};
+    break;
+  }
+  case UI_CONTENT_NONE:
+    break;
+  }
+
+  s_widgets.quadCount[i] = static_cast<uint8_t>(count);
+  s_tree.flags[i] &= static_cast<uint8_t>(~UI_FLAG_DIRTY_QUADS);
+  s_stats.rebuilt++;
+  s_listDirty = true;
+}
+
+static float CrossSize(const UISize &size, float measured, float inner) {
+  switch (size.mode) {
+  case UI_SIZE_FIXED:
+    return size.value;
+  case UI_SIZE_GROW:
+    return inner;
+  case UI_SIZE_FIT:
+    break;
+  }
+  return measured;
+}
+
+/**
+ * @brief Give a widget its size and place its children, top-down. A clean
+ * widget that keeps its size is skipped with its whole subtree.
+ */
+static void Arrange(uint16_t i, float width, float height) {
+  creVec2 &size = s_widgets.size[i];
+  const bool resized = (size.x != width || size.y != height);
+  if (resized) {
+    size = creVec2{width, height};
+    s_tree.flags[i] |= UI_FLAG_DIRTY_QUADS;
+  }
+  if (s_tree.flags[i] & UI_FLAG_DIRTY_QUADS) {
+    RebuildQuads(i);
+  }
+  if (!resized && !(s_tree.flags[i] & UI_FLAG_DIRTY_ARRANGE))
+    return;
+  s_tree.flags[i] &= static_cast<uint8_t>(~UI_FLAG_DIRTY_ARRANGE);
+  s_stats.arranged++;
+  s_listDirty = true;
+
+  const UIStyle &style = s_widgets.style[i];
+  const bool row = (style.direction == UI_DIR_ROW);
+  const float innerMain = (row ? width : height) - 2.0f * style.padding;
+  const float innerCross = (row ? height : width) - 2.0f * style.padding;
+
+  // Pass 1: fixed and fit children claim their size, grow ones share the rest
+  uint32_t visible = 0;
+  float claimed = 0.0f;
+  float weights = 0.0f;
+  for (uint16_t c = s_tree.firstChild[i]; c != UI_NIL;
+       c = s_tree.nextSibling[c]) {
+    if (!(s_tree.flags[c] & UI_FLAG_VISIBLE))
+      continue;
+    const UISize &main =
+        row ? s_widgets.style[c].width : s_widgets.style[c].height;
+    if (main.mode == UI_SIZE_GROW) {
+      weights += main.value;
+    } else {
+      const creVec2 m = s_widgets.measured[c];
+      claimed += row ? m.x : m.y;
+    }
+    visible++;
+  }
+  if (visible == 0)
+    return;
+
+  const float gaps = style.gap * static_cast<float>(visible - 1);
+  const float space = innerMain - claimed - gaps; // Negative: overflow
+  const float share =
+      (weights > 0.0f && space > 0.0f) ? space / weights : 0.0f;
+
+  float cursor = style.padding;
+  float extraGap = 0.0f;
+  if (weights <= 0.0f) {
+    switch (style.justify) {
+    case UI_JUSTIFY_CENTER:
+      cursor += space * 0.5f;
+      break;
+    case UI_JUSTIFY_END:
+      cursor += space;
+      break;
+    case UI_JUSTIFY_SPACE_BETWEEN:
+      extraGap = (visible > 1 && space > 0.0f)
+                     ? space / static_cast<float>(visible - 1)
+                     : 0.0f;
+      break;
+    case UI_JUSTIFY_START:
+      break;
+    }
+  }
+
+  // Pass 2: place and recurse
+  for (uint16_t c = s_tree.firstChild[i]; c != UI_NIL;
+       c = s_tree.nextSibling[c]) {
+    if (!(s_tree.flags[c] & UI_FLAG_VISIBLE))
+      continue;
+    const UIStyle &cs = s_widgets.style[c];
+    const creVec2 m = s_widgets.measured[c];
+    const UISize &mainSize = row ? cs.width : cs.height;
+    const float mainLen =
+        (mainSize.mode == UI_SIZE_GROW) ? mainSize.value * share
+                                        : (row ? m.x : m.y);
+    const float crossLen =
+        CrossSize(row ? cs.height : cs.width, row ? m.y : m.x, innerCross);
+
+    float crossPos = style.padding;
+    switch (style.align) {
+    case UI_ALIGN_CENTER:
+      crossPos += (innerCross - crossLen) * 0.5f;
+      break;
+    case UI_ALIGN_END:
+      crossPos += innerCross - crossLen;
+      break;
+    case UI_ALIGN_START:
+      break;
+    }
+
+    s_widgets.local[c] =
+        row ? creVec2{cursor, crossPos} : creVec2{crossPos, cursor};
+    Arrange(c, row ? mainLen : crossLen, row ? crossLen : mainLen);
+    cursor += mainLen + style.gap + extraGap;
+  }
+}
+
+/**
+ * @brief Visible widgets in paint order (parents below children), with
+ * absolute origins accumulated on the way down.
+ */
+static void RefreshDrawList(void) {
+  uint16_t stack[UI_MAX_WIDGETS];
+  uint32_t top = 0;
+  s_drawCount = 0;
+  s_drawQuads = 0;
+
+  s_widgets.absolute[UI_ROOT] = creVec2{0.0f, 0.0f};
+  stack[top++] = UI_ROOT;
+  while (top > 0) {
+    const uint16_t i = stack[--top];
+    const uint16_t p = s_tree.parent[i];
+    if (p != UI_NIL) {
+      s_widgets.absolute[i] = s_widgets.absolute[p] + s_widgets.local[i];
+    }
+    const uint32_t count = s_widgets.quadCount[i];
+    if (count > 0) {
+      s_drawList[s_drawCount++] = UIDrawCmd{
+          .quads = s_quads[i], .count = count, .origin = s_widgets.absolute[i]};
+      s_drawQuads += count;
+    }
+    // Reverse order, so the first child is drawn first
+    for (uint16_t c = s_tree.lastChild[i]; c != UI_NIL;
+         c = s_tree.prevSibling[c]) {
+      if (s_tree.flags[c] & UI_FLAG_VISIBLE) {
+        stack[top++] = c;
+      }
+    }
+  }
+}
+
+void UISystem_Update(float screenWidth, float screenHeight) {
+  s_stats.measured = 0;
+  s_stats.arranged = 0;
+  s_stats.rebuilt = 0;
+
+  UIStyle &root = s_widgets.style[UI_ROOT];
+  if (root.width.value != screenWidth || root.height.value != screenHeight) {
+    root.width.value = screenWidth;
+    root.height.value = screenHeight;
+    MarkDirty(UI_ROOT);
+  }
+
+  Measure(UI_ROOT);
+  Arrange(UI_ROOT, screenWidth, screenHeight);
+  if (s_listDirty) {
+    RefreshDrawList();
+    s_listDirty = false;
+  }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+creRectangle UISystem_GetRect(UIWidgetID widget) {
+  if (!UISystem_IsHandleValid(widget))
+    return creRectangle{0.0f, 0.0f, 0.0f, 0.0f};
+  const creVec2 pos = s_widgets.absolute[widget.index];
+  const creVec2 size = s_widgets.size[widget.index];
+  return creRectangle{pos.x, pos.y, size.x, size.y};
+}
+
+const UIDrawCmd *UISystem_GetDrawList(uint32_t *count) {
+  *count = s_drawCount;
+  return s_drawList;
+}
+
+UIStats UISystem_GetStats(void) {
+  UIStats stats = s_stats;
+  stats.widgets = s_tree.alive;
+  stats.drawCmds = s_drawCount;
+  stats.quads = s_drawQuads;
+  return stats;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file cre_uiSystem.h
+ * @brief Retained UI Tree (Flex Layout, Dirty Subtrees, Cached Draw Lists)
+ *
+ * Widgets form a tree under a root that spans the screen. Each widget is a
+ * flex box: it lays its visible children out in a row or column, sizing
+ * each axis as FIXED (pixels), FIT (content + padding) or GROW (share of
+ * the space left, by weight; stretch on the cross axis). A widget can draw
+ * a background and one label or sprite.
+ *
+ * Nothing is recomputed unless something changed:
+ *   - Setters mark the widget and its ancestors dirty. Measuring only
+ *     descends into dirty widgets; clean ones return their cached size.
+ *   - Arranging skips every subtree that is clean and keeps its size.
+ *     Positions are relative to the parent, so moving a subtree does not
+ *     touch its descendants.
+ *   - Each widget caches its quads (local coordinates) and rebuilds them
+ *     only when its content or size changes.
+ *   - The draw list (visible widgets in paint order with absolute origins)
+ *     is refreshed only when any of the above happened.
+ *
+ * Every quad samples the sprite atlas (panels use ATLAS_WHITE_*, labels the
+ * baked font), so the client draws the whole UI in one batch
+ * (UISystem_Render, cre_uiRender.cpp). The rest of the module has no
+ * renderer dependency.
+ *
+ * The UI is presentation state: it is not part of the simulation state.
+ */
+
+#ifndef CRE_UISYSTEM_H
+#define CRE_UISYSTEM_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+enum UIDirection : uint8_t { UI_DIR_ROW = 0, UI_DIR_COLUMN };
+
+enum UISizeMode : uint8_t {
+  UI_SIZE_FIT = 0, ///< Content (children, label or sprite) + padding
+  UI_SIZE_FIXED,   ///< value pixels
+  UI_SIZE_GROW     ///< Main axis: share of the free space by weight (value);
+                   ///< cross axis: parent's inner size
+};
+
+enum UIJustify : uint8_t {
+  UI_JUSTIFY_START = 0,
+  UI_JUSTIFY_CENTER,
+  UI_JUSTIFY_END,
+  UI_JUSTIFY_SPACE_BETWEEN
+};
+
+enum UIAlign : uint8_t { UI_ALIGN_START = 0, UI_ALIGN_CENTER, UI_ALIGN_END };
+
+struct UISize {
+  UISizeMode mode;
+  float value;
+};
+
+struct UIStyle {
+  UISize width;
+  UISize height;
+  UIDirection direction; ///< Main axis for the children
+  UIJustify justify;     ///< Children along the main axis
+  UIAlign align;         ///< Children across it
+  float padding;
+  float gap;             ///< Between children
+  creColor background;   ///< a = 0: none
+};
+
+/**
+ * @brief One textured quad, relative to its widget. src is in atlas pixels.
+ */
+struct UIQuad {
+  creRectangle dest;
+  uint16_t srcX;
+  uint16_t srcY;
+  uint16_t srcW;
+  uint16_t srcH;
+  creColor color;
+};
+
+/**
+ * @brief A visible widget's cached quads and where to draw them.
+ */
+struct UIDrawCmd {
+  const UIQuad *quads;
+  uint32_t count;
+  creVec2 origin; ///< Absolute, screen pixels
+};
+
+struct UIStats {
+  uint32_t widgets;  ///< Live widgets (root included)
+  uint32_t measured; ///< Widgets measured by the last update
+  uint32_t arranged; ///< Widgets arranged by the last update
+  uint32_t rebuilt;  ///< Quad lists rebuilt by the last update
+  uint32_t drawCmds; ///< Entries in the draw list
+  uint32_t quads;    ///< Quads in the draw list
+};
+
+/**
+ * @brief Reset the tree to an empty root. Call once at engine startup.
+ */
+void UISystem_Init(void);
+
+/**
+ * @brief Destroy every widget and invalidate all handles.
+ */
+void UISystem_Clear(void);
+
+/**
+ * @brief Root of the tree. Its size follows the screen; its style (minus
+ * the size) can be changed like any other widget's.
+ */
+UIWidgetID UISystem_GetRoot(void);
+
+/**
+ * @brief Append a widget to parent's children.
+ * @return Handle, or UI_INVALID (stale parent, tree full)
+ */
+UIWidgetID UISystem_Create(UIWidgetID parent, const UIStyle &style);
+
+/**
+ * @brief Destroy a widget and its subtree. The root cannot be destroyed.
+ */
+void UISystem_Destroy(UIWidgetID widget);
+
+void UISystem_SetStyle(UIWidgetID widget, const UIStyle &style);
+
+/**
+ * @brief Show a label (truncated to UI_TEXT_LENGTH - 1 bytes), replacing
+ * any sprite. Nothing is invalidated if the label is unchanged.
+ */
+void UISystem_SetText(UIWidgetID widget, const char *text, int32_t fontSize,
+                      creColor color);
+
+/**
+ * @brief printf-style UISystem_SetText.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((format(printf, 4, 5)))
+#endif
+void UISystem_SetTextF(UIWidgetID widget, int32_t fontSize, creColor color,
+                       const char *fmt, ...);
+
+/**
+ * @brief Show an atlas sprite (its untrimmed image) stretched over the
+ * content box, replacing any label. Trimmed borders take space but are not
+ * drawn.
+ */
+void UISystem_SetSprite(UIWidgetID widget, uint32_t spriteID,
+                        creColor tint);
+
+/**
+ * @brief Hidden widgets take no space and hide their subtree.
+ */
+void UISystem_SetVisible(UIWidgetID widget, bool visible);
+
+/**
+ * @brief Mark the whole tree dirty (next update recomputes everything).
+ */
+void UISystem_Invalidate(void);
+
+/**
+ * @brief Bring layout, quads and the draw list up to date for a screen of
+ * the given size. Cheap when nothing changed.
+ */
+void UISystem_Update(float screenWidth, float screenHeight);
+
+/**
+ * @brief Absolute rectangle from the last update, {0} for stale handles.
+ */
+creRectangle UISystem_GetRect(UIWidgetID widget);
+
+/**
+ * @brief Draw list of the last update (valid until the next).
+ */
+const UIDrawCmd *UISystem_GetDrawList(uint32_t *count);
+
+/**
+ * @brief Submit the draw list to the renderer in one atlas batch (client).
+ */
+void UISystem_Render(void);
+
+UIStats UISystem_GetStats(void);
+
+#endif
@@ -0,0 +1,555 @@
+#include "cre_visionSystem.h"
+#include "engine/core/cre_config.h"
+#include "engine/core/cre_logger.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include "engine/memory/cre_arena.h"
+#include "engine/systems/physics/cre_spatialHash.h"
+#include "engine/systems/physics/cre_staticGeometry.h"
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr uint16_t VIEWER_NIL = 0xFFFF;
+static constexpr size_t VISION_ALIGNMENT = 64;
+// A viewer sees at most radius cells away: its sight box is 2r + 1 wide
+static constexpr uint32_t VISION_BOX_SIDE = 2 * VISION_MAX_RADIUS + 1;
+
+static_assert(VISION_MAX_VIEWERS < VIEWER_NIL,
+              "Viewer indices must fit below VIEWER_NIL");
+static_assert(VISION_BOX_SIDE <= 64, "A sight box row must fit in a uint64");
+static_assert(VISION_MAX_TEAMS <= 32, "Dirty teams are a uint32 mask");
+static_assert(VISION_GRID_WIDTH % 64 == 0,
+              "Grid rows must be whole uint64 words");
+
+enum ViewerFlags : uint8_t {
+  VIEWER_FLAG_ALIVE = 1 << 0,
+  VIEWER_FLAG_CAST = 1 << 1, // Its sight rows are valid for cellX/cellY
+};
+
+// ============================================================================
+// Module State
+// ============================================================================
+
+/**
+ * @brief Occupancy and team visibility, one bit per cell, rows of
+ * wordsPerRow uint64 words.
+ */
+struct VisionGrid {
+  uint64_t *staticBits; // Covered by compiled static geometry
+  uint64_t *wallBits;   // Set with VisionSystem_SetOpaque
+  uint64_t *teamBits;   // VISION_MAX_TEAMS grids, back to back
+  int32_t width;
+  int32_t height;
+  uint32_t wordsPerRow;
+  size_t wordsPerGrid;
+  size_t bytes;
+  uint32_t staticRevision; // Of the static geometry staticBits mirror
+  uint32_t dirtyTeams;     // Teams to rebuild on the next update
+  uint8_t fogTeam;
+};
+
+struct ViewerPool {
+  Entity entity[VISION_MAX_VIEWERS];
+  int32_t cellX[VISION_MAX_VIEWERS]; // Where the cached cast starts
+  int32_t cellY[VISION_MAX_VIEWERS];
+  uint16_t gen[VISION_MAX_VIEWERS];
+  uint16_t nextFree[VISION_MAX_VIEWERS];
+  uint8_t radius[VISION_MAX_VIEWERS];
+  uint8_t team[VISION_MAX_VIEWERS];
+  uint8_t flags[VISION_MAX_VIEWERS];
+  uint16_t freeHead;
+  uint32_t bound; // Highest slot ever used + 1
+  uint32_t alive;
+};
+
+static VisionGrid s_grid = {};
+static ViewerPool s_viewers = {};
+// Cached casts: bit lx of row ly is cell (cellX - r + lx, cellY - r + ly)
+static uint64_t s_sight[VISION_MAX_VIEWERS][VISION_BOX_SIDE];
+static VisionStats s_stats = {};
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+static size_t AlignUp(size_t bytes) {
+  return (bytes + VISION_ALIGNMENT - 1) & ~(VISION_ALIGNMENT - 1);
+}
+
+size_t VisionSystem_MemorySize(uint32_t width, uint32_t height) {
+  const size_t words = static_cast<size_t>(width / 64) * height;
+  return AlignUp(sizeof(uint64_t) * words) * (2 + VISION_MAX_TEAMS);
+}
+
+static void ResetViewers(void) {
+  for (uint32_t i = 0; i < VISION_MAX_VIEWERS; i++) {
+    s_viewers.gen[i]++; // Live handles become stale
+    s_viewers.flags[i] = 0;
+    s_viewers.nextFree[i] = (i + 1 < VISION_MAX_VIEWERS)
+                                ? static_cast<uint16_t>(i + 1)
+                                : VIEWER_NIL;
+  }
+  s_viewers.freeHead = 0;
+  s_viewers.bound = 0;
+  s_viewers.alive = 0;
+}
+
+bool VisionSystem_Init(Arena *arena, uint32_t width, uint32_t height) {
+  const size_t bytes = VisionSystem_MemorySize(width, height);
+  if (width == 0 || height == 0 || (width % 64) != 0 ||
+      width > INT32_MAX / height ||
+      arena_Remaining(arena) < bytes + VISION_ALIGNMENT) {
+    Log(LogLevel::Error,
+        "VisionSystem_Init: Cannot fit {}x{} cells (width must be a "
+        "multiple of 64)",
+        width, height);
+    s_grid = {};
+    return false;
+  }
+
+  uint8_t *cursor = static_cast<uint8_t *>(
+      arena_PushAligned(arena, bytes, VISION_ALIGNMENT));
+  const size_t words = static_cast<size_t>(width / 64) * height;
+  const size_t stride = AlignUp(sizeof(uint64_t) * words);
+  s_grid.staticBits = reinterpret_cast<uint64_t *>(cursor);
+  s_grid.wallBits = reinterpret_cast<uint64_t *>(cursor + stride);
+  s_grid.teamBits = reinterpret_cast<uint64_t *>(cursor + 2 * stride);
+  s_grid.width = static_cast<int32_t>(width);
+  s_grid.height = static_cast<int32_t>(height);
+  s_grid.wordsPerRow = width / 64;
+  s_grid.wordsPerGrid = stride / sizeof(uint64_t);
+  s_grid.bytes = bytes;
+  VisionSystem_Clear();
+
+  Log(LogLevel::Info, "Vision System Initialized ({}x{} cells, {} KB)", width,
+      height, bytes / 1024);
+  return true;
+}
+
+void VisionSystem_Clear(void) {
+  ResetViewers();
+  s_stats = {};
+  s_grid.fogTeam = VISION_TEAM_NONE;
+  s_grid.dirtyTeams = 0;
+  if (!s_grid.staticBits)
+    return;
+  memset(s_grid.staticBits, 0, s_grid.bytes);
+  // Mirror the static geometry again on the next update
+  s_grid.staticRevision = StaticGeometry_GetRevision() - 1;
+}
+
+// ============================================================================
+// Occupancy
+// ============================================================================
+
+static inline bool InGrid(int32_t x, int32_t y) {
+  return x >= 0 && y >= 0 && x < s_grid.width && y < s_grid.height;
+}
+
+static inline size_t WordIndex(int32_t x, int32_t y) {
+  return static_cast<size_t>(y) * s_grid.wordsPerRow +
+         static_cast<size_t>(x >> 6);
+}
+
+static inline uint64_t BitMask(int32_t x) {
+  return uint64_t{1} << static_cast<uint32_t>(x & 63);
+}
+
+static inline uint64_t *TeamBits(uint32_t team) {
+  return s_grid.teamBits + team * s_grid.wordsPerGrid;
+}
+
+/**
+ * @brief Outside the grid counts as opaque: sight never leaves it.
+ */
+static inline bool IsOpaqueCell(int32_t x, int32_t y) {
+  if (!InGrid(x, y))
+    return true;
+  const size_t w = WordIndex(x, y);
+  return ((s_grid.staticBits[w] | s_grid.wallBits[w]) & BitMask(x)) != 0;
+}
+
+static inline bool ViewerIsCastAt(uint32_t v, int32_t x, int32_t y) {
+  const int32_t r = s_viewers.radius[v];
+  const int32_t lx = x - (s_viewers.cellX[v] - r);
+  const int32_t ly = y - (s_viewers.cellY[v] - r);
+  if (lx < 0 || ly < 0 || lx > 2 * r || ly > 2 * r)
+    return false;
+  return (s_sight[v][ly] >> static_cast<uint32_t>(lx)) & 1u;
+}
+
+/**
+ * @brief Drop the casts a cell's opacity change can alter. Only cells a
+ * cast examined affect it: the visible ones inside the disc and the box
+ * corners outside it (examined but never marked).
+ */
+static void InvalidateAround(int32_t x, int32_t y) {
+  for (uint32_t v = 0; v < s_viewers.bound; v++) {
+    if (!(s_viewers.flags[v] & VIEWER_FLAG_CAST))
+      continue;
+    const int32_t r = s_viewers.radius[v];
+    const int32_t dx = x - s_viewers.cellX[v];
+    const int32_t dy = y - s_viewers.cellY[v];
+    if (abs(dx) > r || abs(dy) > r)
+      continue;
+    if (dx * dx + dy * dy > r * r || ViewerIsCastAt(v, x, y)) {
+      s_viewers.flags[v] &= static_cast<uint8_t>(~VIEWER_FLAG_CAST);
+    }
+  }
+}
+
+/**
+ * @brief Rebuild the static bits from the compiled colliders. Every cast
+ * may have changed.
+ */
+static void SyncStatic(void) {
+  memset(s_grid.staticBits, 0, sizeof(uint64_t) * s_grid.wordsPerGrid);
+  const uint32_t count = StaticGeometry_Count();
+  for (uint32_t i = 0; i < count; i++) {
+    const StaticCellRange range = StaticGeometry_GetCellRange(
+        *StaticGeometry_Get(i), VISION_CELL_SIZE, s_grid.width, s_grid.height);
+    for (int32_t y = range.minY; y <= range.maxY; y++) {
+      for (int32_t x = range.minX; x <= range.maxX; x++) {
+        s_grid.staticBits[WordIndex(x, y)] |= BitMask(x);
+      }
+    }
+  }
+  VisionSystem_Invalidate();
+  s_grid.staticRevision = StaticGeometry_GetRevision();
+}
+
+void VisionSystem_SetOpaque(int32_t cellX, int32_t cellY, bool opaque) {
+  if (!s_grid.staticBits || !InGrid(cellX, cellY))
+    return;
+  const bool before = IsOpaqueCell(cellX, cellY);
+  uint64_t &word = s_grid.wallBits[WordIndex(cellX, cellY)];
+  word = opaque ? (word | BitMask(cellX)) : (word & ~BitMask(cellX));
+  if (IsOpaqueCell(cellX, cellY) != before) {
+    InvalidateAround(cellX, cellY);
+  }
+}
+
+bool VisionSystem_IsOpaque(int32_t cellX, int32_t cellY) {
+  return s_grid.staticBits && InGrid(cellX, cellY) &&
+         IsOpaqueCell(cellX, cellY);
+}
+
+// ============================================================================
+// Shadowcasting
+// ============================================================================
+
+struct CastContext {
+  uint64_t *rows;
+  int32_t cx;
+  int32_t cy;
+  int32_t radius;
+  uint32_t cells; // Examined
+};
+
+/**
+ * @brief Scan one octant row by row from `row` outwards, between the start
+ * and end slopes (dx/dy of the sight lines bounding the lit wedge). An
+ * opaque cell narrows the wedge: the part beyond it is scanned by a
+ * recursive call, and the scan resumes past the end of the blocked run.
+ * The multipliers map octant coordinates onto the grid.
+ */
+static void CastOctant(CastContext &c, int32_t row, float start, float end,
+                       int32_t xx, int32_t xy, int32_t yx, int32_t yy) {
+  if (start < end)
+    return;
+  const int32_t r = c.radius;
+  float newStart = 0.0f;
+  for (int32_t j = row; j <= r; j++) {
+    const int32_t dy = -j;
+    bool blocked = false;
+    for (int32_t dx = -j; dx <= 0; dx++) {
+      const float fx = static_cast<float>(dx);
+      const float fy = static_cast<float>(dy);
+      const float leftSlope = (fx - 0.5f) / (fy + 0.5f);
+      const float rightSlope = (fx + 0.5f) / (fy - 0.5f);
+      if (start < rightSlope)
+        continue;
+      if (end > leftSlope)
+        break;
+
+      const int32_t x = c.cx + dx * xx + dy * xy;
+      const int32_t y = c.cy + dx * yx + dy * yy;
+      const bool opaque = IsOpaqueCell(x, y);
+      c.cells++;
+      if (dx * dx + dy * dy <= r * r && InGrid(x, y)) {
+        c.rows[y - c.cy + r] |= uint64_t{1}
+                                << static_cast<uint32_t>(x - c.cx + r);
+      }
+
+      if (blocked) {
+        if (opaque) {
+          newStart = rightSlope;
+          continue;
+        }
+        blocked = false;
+        start = newStart;
+      } else if (opaque && j < r) {
+        blocked = true;
+        CastOctant(c, j + 1, start, leftSlope, xx, xy, yx, yy);
+        newStart = rightSlope;
+      }
+    }
+    if (blocked)
+      break;
+  }
+}
+
+static void Cast(uint32_t v) {
+  // Octant multipliers {xx, xy, yx, yy}
+  static const int32_t octants[8][4] = {
+      {1, 0, 0, 1},   {0, 1, 1, 0},   {0, -1, 1, 0}, {-1, 0, 0, 1},
+      {-1, 0, 0, -1}, {0, -1, -1, 0}, {0, 1, -1, 0}, {1, 0, 0, -1}};
+
+  uint64_t *rows = s_sight[v];
+  memset(rows, 0, sizeof(s_sight[v]));
+  CastContext c = {.rows = rows,
+                   .cx = s_viewers.cellX[v],
+                   .cy = s_viewers.cellY[v],
+                   .radius = s_viewers.radius[v],
+                   .cells = 1};
+  if (InGrid(c.cx, c.cy)) {
+    rows[c.radius] |= uint64_t{1} << static_cast<uint32_t>(c.radius);
+    for (uint32_t o = 0; o < 8; o++) {
+      const int32_t *m = octants[o];
+      CastOctant(c, 1, 1.0f, 0.0f, m[0], m[1], m[2], m[3]);
+    }
+  }
+  s_stats.casts++;
+  s_stats.cells += c.cells;
+}
+
+/**
+ * @brief OR a viewer's cached rows into a team bitset. Each row lands in at
+ * most two words.
+ */
+static void MergeSight(uint64_t *bits, uint32_t v) {
+  const int32_t r = s_viewers.radius[v];
+  const int32_t originX = s_viewers.cellX[v] - r;
+  const int32_t originY = s_viewers.cellY[v] - r;
+  const int32_t wordsPerRow = static_cast<int32_t>(s_grid.wordsPerRow);
+  for (int32_t ly = 0; ly <= 2 * r; ly++) {
+    const int32_t y = originY + ly;
+    uint64_t row = s_sight[v][ly];
+    if (!row || y < 0 || y >= s_grid.height)
+      continue;
+    int32_t x = originX;
+    if (x < 0) {
+      row >>= static_cast<uint32_t>(-x); // Casts never cover x < 0
+      x = 0;
+    }
+    const int32_t word = x >> 6;
+    const uint32_t shift = static_cast<uint32_t>(x & 63);
+    if (word >= wordsPerRow)
+      continue;
+    uint64_t *dst = bits + WordIndex(x, y);
+    dst[0] |= row << shift;
+    if (shift && word + 1 < wordsPerRow) {
+      dst[1] |= row >> (64 - shift);
+    }
+  }
+}
+
+static void RebuildTeam(uint32_t team) {
+  uint64_t *bits = TeamBits(team);
+  memset(bits, 0, sizeof(uint64_t) * s_grid.wordsPerGrid);
+  for (uint32_t v = 0; v < s_viewers.bound; v++) {
+    if ((s_viewers.flags[v] & VIEWER_FLAG_CAST) && s_viewers.team[v] == team) {
+      MergeSight(bits, v);
+    }
+  }
+  s_stats.merges++;
+}
+
+// ============================================================================
+// Viewers
+// ============================================================================
+
+static bool VisionSystem_IsHandleValid(ViewerID viewer) {
+  return viewer.index < VISION_MAX_VIEWERS &&
+         (s_viewers.flags[viewer.index] & VIEWER_FLAG_ALIVE) &&
+         s_viewers.gen[viewer.index] == viewer.gen;
+}
+
+static uint8_t ClampRadius(uint32_t radius) {
+  return static_cast<uint8_t>(
+      std::min(std::max(radius, 1u), VISION_MAX_RADIUS));
+}
+
+ViewerID VisionSystem_CreateViewer(Entity entity, uint8_t team,
+                                   uint32_t radius) {
+  if (team >= VISION_MAX_TEAMS) {
+    Log(LogLevel::Warning, "VisionSystem_CreateViewer: Invalid team {}", team);
+    return VIEWER_INVALID;
+  }
+  if (!s_grid.staticBits || s_viewers.freeHead == VIEWER_NIL) {
+    Log(LogLevel::Warning, "VisionSystem_CreateViewer: No free viewer");
+    return VIEWER_INVALID;
+  }
+  const uint16_t v = s_viewers.freeHead;
+  s_viewers.freeHead = s_viewers.nextFree[v];
+  s_viewers.entity[v] = entity;
+  s_viewers.radius[v] = ClampRadius(radius);
+  s_viewers.team[v] = team;
+  s_viewers.flags[v] = VIEWER_FLAG_ALIVE; // Cast by the next update
+  s_viewers.bound = std::max(s_viewers.bound, static_cast<uint32_t>(v) + 1);
+  s_viewers.alive++;
+  return ViewerID{.index = v, .gen = s_viewers.gen[v]};
+}
+
+static void Release(uint32_t v) {
+  // Unconditional: a cast dropped by InvalidateAround or SetRadius is still
+  // merged into the team's bits until the team is rebuilt.
+  s_grid.dirtyTeams |= 1u << s_viewers.team[v];
+  s_viewers.gen[v]++;
+  s_viewers.flags[v] = 0;
+  s_viewers.nextFree[v] = s_viewers.freeHead;
+  s_viewers.freeHead = static_cast<uint16_t>(v);
+  s_viewers.alive--;
+}
+
+void VisionSystem_DestroyViewer(ViewerID viewer) {
+  if (VisionSystem_IsHandleValid(viewer)) {
+    Release(viewer.index);
+  }
+}
+
+void VisionSystem_SetRadius(ViewerID viewer, uint32_t radius) {
+  if (!VisionSystem_IsHandleValid(viewer))
+    return;
+  const uint8_t r = ClampRadius(radius);
+  if (s_viewers.radius[viewer.index] == r)
+    return;
+  s_viewers.radius[viewer.index] = r;
+  s_viewers.flags[viewer.index] &= static_cast<uint8_t>(~VIEWER_FLAG_CAST);
+}
+
+// ============================================================================
+// Update
+// ============================================================================
+
+void VisionSystem_Update(const EntityRegistry &reg) {
+  if (!s_grid.staticBits)
+    return;
+  s_stats.casts = 0;
+  s_stats.cells = 0;
+  s_stats.merges = 0;
+  if (s_grid.staticRevision != StaticGeometry_GetRevision()) {
+    SyncStatic();
+  }
+
+  const float inv = 1.0f / VISION_CELL_SIZE;
+  for (uint32_t v = 0; v < s_viewers.bound; v++) {
+    const uint8_t flags = s_viewers.flags[v];
+    if (!(flags & VIEWER_FLAG_ALIVE))
+      continue;
+    const Entity entity = s_viewers.entity[v];
+    if (!EntityRegistry_IsAlive(reg, entity)) {
+      Release(v);
+      continue;
+    }
+    const creVec2 pos = reg.pos[entity.id];
+    const int32_t x = static_cast<int32_t>(floorf(pos.x * inv));
+    const int32_t y = static_cast<int32_t>(floorf(pos.y * inv));
+    if ((flags & VIEWER_FLAG_CAST) && x == s_viewers.cellX[v] &&
+        y == s_viewers.cellY[v])
+      continue;
+    s_viewers.cellX[v] = x;
+    s_viewers.cellY[v] = y;
+    Cast(v);
+    s_viewers.flags[v] |= VIEWER_FLAG_CAST;
+    s_grid.dirtyTeams |= 1u << s_viewers.team[v];
+  }
+
+  for (uint32_t t = 0; t < VISION_MAX_TEAMS; t++) {
+    if (s_grid.dirtyTeams & (1u << t)) {
+      RebuildTeam(t);
+    }
+  }
+  s_grid.dirtyTeams = 0;
+}
+
+void VisionSystem_Invalidate(void) {
+  for (uint32_t v = 0; v < s_viewers.bound; v++) {
+    s_viewers.flags[v] &= static_cast<uint8_t>(~VIEWER_FLAG_CAST);
+  }
+  s_grid.dirtyTeams = (1u << VISION_MAX_TEAMS) - 1;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+bool VisionSystem_IsCellVisible(uint8_t team, int32_t cellX, int32_t cellY) {
+  if (!s_grid.staticBits || team >= VISION_MAX_TEAMS || !InGrid(cellX, cellY))
+    return false;
+  return (TeamBits(team)[WordIndex(cellX, cellY)] & BitMask(cellX)) != 0;
+}
+
+bool VisionSystem_IsVisible(uint8_t team, creVec2 worldPos) {
+  const float inv = 1.0f / VISION_CELL_SIZE;
+  return VisionSystem_IsCellVisible(
+      team, static_cast<int32_t>(floorf(worldPos.x * inv)),
+      static_cast<int32_t>(floorf(worldPos.y * inv)));
+}
+
+bool VisionSystem_ViewerSees(ViewerID viewer, creVec2 worldPos) {
+  if (!VisionSystem_IsHandleValid(viewer) ||
+      !(s_viewers.flags[viewer.index] & VIEWER_FLAG_CAST))
+    return false;
+  const float inv = 1.0f / VISION_CELL_SIZE;
+  return ViewerIsCastAt(viewer.index,
+                        static_cast<int32_t>(floorf(worldPos.x * inv)),
+                        static_cast<int32_t>(floorf(worldPos.y * inv)));
+}
+
+uint32_t VisionSystem_QueryVisible(const EntityRegistry &reg, uint8_t team,
+                                   creRectangle area, uint32_t *results,
+                                   uint32_t maxResults) {
+  // Same caveat as the render culler's buffers: not reentrant
+  static uint32_t candidates[MAX_VISIBLE_ENTITIES];
+  if (!s_grid.staticBits || team >= VISION_MAX_TEAMS || maxResults == 0)
+    return 0;
+
+  const int found = SpatialHash_QueryDynamic(
+      static_cast<int>(area.x), static_cast<int>(area.y),
+      static_cast<int>(area.width), static_cast<int>(area.height), candidates,
+      MAX_VISIBLE_ENTITIES);
+  uint32_t count = 0;
+  for (int i = 0; i < found && count < maxResults; i++) {
+    const uint32_t id = candidates[i];
+    if (id >= MAX_ENTITIES || !(reg.state_flags[id] & FLAG_ACTIVE))
+      continue;
+    if (VisionSystem_IsVisible(team, reg.pos[id])) {
+      results[count++] = id;
+    }
+  }
+  return count;
+}
+
+const uint64_t *VisionSystem_GetTeamBits(uint8_t team, uint32_t *wordsPerRow) {
+  if (!s_grid.staticBits || team >= VISION_MAX_TEAMS)
+    return nullptr;
+  if (wordsPerRow) {
+    *wordsPerRow = s_grid.wordsPerRow;
+  }
+  return TeamBits(team);
+}
+
+void VisionSystem_SetFogTeam(uint8_t team) {
+  s_grid.fogTeam =
+      (s_grid.staticBits && team < VISION_MAX_TEAMS) ? team : VISION_TEAM_NONE;
+}
+
+uint8_t VisionSystem_GetFogTeam(void) { return s_grid.fogTeam; }
+
+VisionStats VisionSystem_GetStats(void) {
+  VisionStats stats = s_stats;
+  stats.viewers = s_viewers.alive;
+  return stats;
+}
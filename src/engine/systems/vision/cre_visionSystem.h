@@ -0,0 +1,140 @@
+/**
+ * @file cre_visionSystem.h
+ * @brief Fog of War (Shadowcasting Viewers, Packed Team Bitsets)
+ *
+ * A fixed grid of VISION_CELL_SIZE cells (origin at world 0,0) records which
+ * cells block sight: the compiled static geometry plus cells set with
+ * VisionSystem_SetOpaque (doors, destructible tiles). Cells outside the grid
+ * block sight and are never visible.
+ *
+ * A viewer is attached to an entity and belongs to a team. It sees what
+ * recursive shadowcasting over the eight octants reaches from its cell
+ * within `radius` cells (a disc); opaque cells are seen but hide what lies
+ * behind them. The result is cached per viewer as one 64-bit row per line
+ * of its sight box and recast only when:
+ *   - the viewer's entity entered another cell (or its radius changed),
+ *   - a cell inside its sight box changed opacity,
+ *   - the static geometry changed (every viewer).
+ *
+ * A team's visibility is one bit per cell, rebuilt only for teams whose
+ * viewers changed by OR-ing each viewer's rows into it (two word writes per
+ * row). Queries are a bit test.
+ *
+ * The team bitsets feed the render culler (VisionSystem_SetFogTeam) and AI
+ * targeting (VisionSystem_QueryVisible). Visibility is derived state: it is
+ * rebuilt from positions and occupancy at the start of each simulation step,
+ * before AI runs, and is never saved.
+ */
+
+#ifndef CRE_VISIONSYSTEM_H
+#define CRE_VISIONSYSTEM_H
+
+#include "engine/core/cre_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Forward declarations (dependency injection)
+struct Arena;
+struct EntityRegistry;
+
+constexpr uint8_t VISION_TEAM_NONE = 0xFF;
+
+struct VisionStats {
+  uint32_t viewers; ///< Live viewers
+  uint32_t casts;   ///< Viewers recast by the last update
+  uint32_t cells;   ///< Cells those casts examined
+  uint32_t merges;  ///< Team bitsets rebuilt by the last update
+};
+
+/**
+ * @brief Bytes VisionSystem_Init pushes for a grid size.
+ */
+size_t VisionSystem_MemorySize(uint32_t width, uint32_t height);
+
+/**
+ * @brief Carve the grid and team bitsets out of arena and reset them.
+ * @param width Cells, a multiple of 64
+ * @return false if the arena is too small or width is not a multiple of 64
+ */
+bool VisionSystem_Init(Arena *arena, uint32_t width, uint32_t height);
+
+/**
+ * @brief Remove every viewer and opaque cell, disable fog (scene changes).
+ */
+void VisionSystem_Clear(void);
+
+/**
+ * @brief Attach a viewer to an entity. It follows the entity's position and
+ * is removed when the entity dies.
+ * @param team   0..VISION_MAX_TEAMS-1
+ * @param radius Sight in cells, clamped to [1, VISION_MAX_RADIUS]
+ * @return Handle, or VIEWER_INVALID (bad team, every viewer in use)
+ */
+ViewerID VisionSystem_CreateViewer(Entity entity, uint8_t team,
+                                   uint32_t radius);
+
+/**
+ * @brief Remove a viewer. Stale handles are ignored.
+ */
+void VisionSystem_DestroyViewer(ViewerID viewer);
+
+void VisionSystem_SetRadius(ViewerID viewer, uint32_t radius);
+
+/**
+ * @brief Block (or clear) sight through one cell on top of the static
+ * geometry.
+ */
+void VisionSystem_SetOpaque(int32_t cellX, int32_t cellY, bool opaque);
+
+bool VisionSystem_IsOpaque(int32_t cellX, int32_t cellY);
+
+/**
+ * @brief Follow the viewers' entities and occupancy changes, recast the
+ * viewers that need it and rebuild their teams. Cheap when nothing moved
+ * across a cell.
+ */
+void VisionSystem_Update(const EntityRegistry &reg);
+
+/**
+ * @brief Recast every viewer and rebuild every team on the next update.
+ */
+void VisionSystem_Invalidate(void);
+
+bool VisionSystem_IsCellVisible(uint8_t team, int32_t cellX, int32_t cellY);
+
+/**
+ * @brief Whether any viewer of team sees the cell containing worldPos.
+ */
+bool VisionSystem_IsVisible(uint8_t team, creVec2 worldPos);
+
+/**
+ * @brief Whether this viewer alone sees worldPos (from its cached cast).
+ */
+bool VisionSystem_ViewerSees(ViewerID viewer, creVec2 worldPos);
+
+/**
+ * @brief Dynamic entities inside area whose position team sees (AI target
+ * acquisition). Results are registry indices.
+ * @return Number of results written
+ */
+uint32_t VisionSystem_QueryVisible(const EntityRegistry &reg, uint8_t team,
+                                   creRectangle area, uint32_t *results,
+                                   uint32_t maxResults);
+
+/**
+ * @brief A team's bitset: bit (x & 63) of word y * wordsPerRow + (x >> 6)
+ * is set when cell (x, y) is visible. nullptr for invalid teams.
+ */
+const uint64_t *VisionSystem_GetTeamBits(uint8_t team, uint32_t *wordsPerRow);
+
+/**
+ * @brief Team whose fog the render culler applies: non-static entities in
+ * cells it does not see are skipped. VISION_TEAM_NONE (default) disables it.
+ */
+void VisionSystem_SetFogTeam(uint8_t team);
+uint8_t VisionSystem_GetFogTeam(void);
+
+VisionStats VisionSystem_GetStats(void);
+
+#endif
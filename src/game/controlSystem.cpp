@@ -2,6 +2,7 @@
 #include "atlas_data.h"
 #include "engine/core/cre_commandBus.h"
 #include "engine/core/cre_config.h"
+#include "engine/core/cre_random.h"
 #include "engine/ecs/cre_components.h"
 #include "engine/ecs/cre_entityAPI.h"
 #include "engine/ecs/cre_entityManager.h"
@@ -9,22 +10,21 @@
 #include "engine/platform/cre_input.h"
 #include "engine/platform/cre_viewport.h"
 #include "engine/systems/animation/cre_animationAPI.h"
-#include "engine/systems/audio/cre_audioAPI.h"
 #include "engine/systems/camera/cre_cameraAPI.h"
 #include "engine/systems/camera/cre_cameraSystem.h"
 #include "engine/systems/physics/cre_physicsAPI.h"
 #include "engine/systems/physics/cre_physicsSystem.h"
 #include "engine/systems/physics/cre_physics_defs.h"
 #include "entity_types.h"
+#include "game_ai.h"
 #include "game_prototypes.h"
-#include "raylib.h"
 #include <assert.h>
 #include <math.h>
 
 #define SLEEP_RADIUS 2500.0f
 #define SLEEP_RADIUS_SQR (SLEEP_RADIUS * SLEEP_RADIUS)
 #define SPAWN_COUNT 100
-#define PLAYER_SPEED 400.0f
+#define CHAIN_LINK_COUNT 500
 #define SCALE_FACTOR 4.0f
 #define ZOOM_RATE_PER_SEC 0.60f
 
@@ -49,7 +49,7 @@ void ControlSystem_UpdateLogic(EntityRegistry &reg, float dt,
     case TYPE_PLAYER: {
       // Input Control
       float velX = 0, velY = 0;
-      float speed = PLAYER_SPEED;
+      const float speed = reg.move_speed[i];
       if (Input_IsDown(ACTION_UP))
         velY = -speed;
       if (Input_IsDown(ACTION_DOWN))
@@ -141,25 +141,22 @@ void ControlSystem_UpdateSleepState(EntityRegistry &reg,
 
     // Set the Flag
     if (distSqr > SLEEP_RADIUS_SQR) {
-      reg.state_flags[i] |= FLAG_CULLED; // Set bit
+      EntityRegistry_SetFlags(&reg.counters, &reg.state_flags[i], FLAG_CULLED);
     } else {
-      reg.state_flags[i] &= ~FLAG_CULLED; // Clear bit
+      EntityRegistry_ClearFlags(&reg.counters, &reg.state_flags[i],
+                                FLAG_CULLED);
     }
   }
 }
 
 void ControlSystem_HandleDebugSpawning(EntityRegistry &reg, CommandBus &bus) {
-  if (IsKeyPressed(KEY_Z)) {
+  if (Input_IsPressed(ACTION_DEBUG_SPAWN_HORDE)) {
     ViewportSize v = Viewport_Get();
-
-    /// AUDIO SFX TEST
-    audioAPI_PlayOneShot(bus, AUDIO_GROUP_MASTER, AUDIO_SOURCE_TEST_SFX);
-    ///
     for (int i = 0; i < SPAWN_COUNT; i++) {
-      int x = GetRandomValue(static_cast<int>(-8 * v.width),
-                             static_cast<int>(v.width * 8));
-      int y = GetRandomValue(static_cast<int>(-8 * v.height),
-                             static_cast<int>(v.height * 8));
+      int x = Random_Range(static_cast<int>(-8 * v.width),
+                           static_cast<int>(v.width * 8));
+      int y = Random_Range(static_cast<int>(-8 * v.height),
+                           static_cast<int>(v.height * 8));
 
       Entity zombie = entityAPI_Spawn(
           reg, bus, g_zombiePrototype,
@@ -172,18 +169,35 @@ void ControlSystem_HandleDebugSpawning(EntityRegistry &reg, CommandBus &bus) {
     }
   }
 
-  if (IsKeyPressed(KEY_X)) {
-    /// BGM TESTING!!!!
-    const AudioID bgmID = audioAPI_AllocateSound();
-    audioAPI_SoundLoad(bus, bgmID, AUDIO_SOURCE_TEST_BGM, AUDIO_GROUP_MASTER,
-                       AUDIO_USAGE_STREAM);
-    audioAPI_SoundSetVolume(bus, bgmID, 0.5f);
-    audioAPI_SoundSetPitch(bus, bgmID, 1.0f);
-    audioAPI_SoundSetPan(bus, bgmID, 0.0f);
-    audioAPI_SoundPlay(bus, bgmID);
+  if (Input_IsPressed(ACTION_DEBUG_SPAWN_CHAIN)) {
+    /// JOINT BENCHMARK: 500-link chain pinned to the world, free end kicked.
+    const Entity prev = Prototypes_SpawnChain(
+        reg, bus, creVec2{100.0f, 400.0f}, CHAIN_LINK_COUNT);
+    if (ENTITY_IS_VALID(prev)) {
+      physicsAPI_SetVelocity(bus, prev, 0.0f, 600.0f);
+    }
   }
 }
 
+void ControlSystem_StartGameplay(EntityRegistry &reg, CommandBus &bus) {
+  Entity mainCam = ControlSystem_SpawnCamera(reg);
+  Entity player = ControlSystem_SpawnPlayer(reg, bus);
+  GameAI_SetPlayer(player);
+  ControlSystem_SetCameraTarget(reg, bus, player, mainCam);
+}
+
+void ControlSystem_Update(EntityRegistry &reg, CommandBus &bus, float dt) {
+  ViewportSize vp = Viewport_Get();
+  const CameraComponent *activeCam = cameraSystem_GetActiveComponent(reg);
+  creRectangle cullBounds =
+      cameraSystem_GetActiveCullBounds(reg, activeCam, vp);
+
+  ControlSystem_UpdateSleepState(reg, activeCam);
+  ControlSystem_HandleDebugSpawning(reg, bus);
+  ControlSystem_UpdateLogic(reg, dt, cullBounds);
+  ControlSystem_ChangeZoom(reg, bus, dt);
+}
+
 Entity ControlSystem_SpawnPlayer(EntityRegistry &reg, CommandBus &bus) {
   Entity player =
       entityAPI_Spawn(reg, bus, g_playerPrototype, creVec2{100, 200});
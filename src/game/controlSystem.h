@@ -38,7 +38,7 @@ void ControlSystem_UpdateSleepState(EntityRegistry &reg,
                                     const CameraComponent *cam);
 
 /**
- * @brief Handle debug entity spawning input (Z batch, X single).
+ * @brief Handle debug entity spawning input (Z batch, C chain).
  * @param reg Pointer to the EntityRegistry
  * @param bus Command bus for physics setup commands
  */
@@ -52,4 +52,16 @@ Entity ControlSystem_SpawnPlayer(EntityRegistry &reg, CommandBus &bus);
 
 Entity ControlSystem_SpawnCamera(EntityRegistry &reg);
 
+/**
+ * @brief Spawn the camera and the player, and point the AI and camera at it.
+ */
+void ControlSystem_StartGameplay(EntityRegistry &reg, CommandBus &bus);
+
+/**
+ * @brief Per-frame gameplay simulation: sleep state, debug spawning, player
+ * input and zoom. Raylib free, so headless replays run it as well.
+ * @param dt Delta time in seconds
+ */
+void ControlSystem_Update(EntityRegistry &reg, CommandBus &bus, float dt);
+
 #endif
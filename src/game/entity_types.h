@@ -9,7 +9,8 @@ enum EntityType : uint8_t {
   TYPE_FOOD,
   TYPE_WALL,
   TYPE_PARTICLE,
-  TYPE_CAMERA
+  TYPE_CAMERA,
+  TYPE_CHAIN_LINK // Joint benchmark, never culled like particles
 };
 
 constexpr uint8_t L_PLAYER = (1 << TYPE_PLAYER);
@@ -6,39 +6,44 @@
 #include "engine/platform/cre_input.h"
 #include "engine/platform/cre_viewport.h"
 #include "engine/scene/cre_sceneManager.h"
+#include "engine/systems/audio/cre_audioAPI.h"
 #include "engine/systems/camera/cre_cameraAPI.h"
 #include "engine/systems/camera/cre_cameraSystem.h"
+#include "engine/systems/debug/cre_debugDraw.h"
 #include "engine/systems/debug/cre_debugSystem.h"
+#include "engine/systems/light/cre_lightSystem.h"
 #include "engine/systems/physics/cre_physicsSystem.h"
 #include "engine/systems/render/cre_renderAPI.h"
 #include "engine/systems/render/cre_renderSystem.h"
 #include "engine/systems/render/cre_rendererCore.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+#include "engine/systems/vision/cre_visionSystem.h"
+#include "game_ai.h"
 #include "game_prototypes.h"
 #include "game_scenes.h"
 #include <assert.h>
 
 // Helper function
-static void ResetGameplay(EntityRegistry &reg, CommandBus &bus);
+static void HandleDebugAudio(CommandBus &bus);
 
 void Game_Init(EntityRegistry &reg, CommandBus &bus) {
   renderAPI_SetDepthPreset(bus, DEPTH_PRESET_FLAT);
   EntitySystem_ClearAllHooks(reg);
   EntityManager_Reset(reg);
+  TweenSystem_Clear();
+  TimerSystem_Clear();
+  LightSystem_Clear();
+  VisionSystem_Clear();
 
   Prototypes_Init(reg);
-  ResetGameplay(reg, bus);
+  GameAI_Init();
+  ControlSystem_StartGameplay(reg, bus);
 }
 void Game_Update(EntityRegistry &reg, CommandBus &bus, float dt) {
-  ViewportSize vp = Viewport_Get();
-  const CameraComponent *activeCam = cameraSystem_GetActiveComponent(reg);
-  creRectangle cullBounds =
-      cameraSystem_GetActiveCullBounds(reg, activeCam, vp);
-
-  ControlSystem_UpdateSleepState(reg, activeCam);
   DebugSystem_HandleInput(reg);
-  ControlSystem_HandleDebugSpawning(reg, bus);
-  ControlSystem_UpdateLogic(reg, dt, cullBounds);
-  ControlSystem_ChangeZoom(reg, bus, dt);
+  HandleDebugAudio(bus);
+  ControlSystem_Update(reg, bus, dt);
 
   if (Input_IsPressed(ACTION_CONFIRM))
     SceneManager_ChangeScene(GAME_STATE_GAMEOVER);
@@ -59,6 +64,7 @@ void Game_Draw(EntityRegistry &reg, CommandBus &bus) {
   renderSystem_Draw(reg, bus, cullBounds);
   DebugSystem_RenderWorldSpace(reg);
   // World-space debug overlays (inside camera)
+  DEBUG_DRAW_FLUSH(DEBUG_LAYER_WORLD, cullBounds);
 
   rendererCore_EndWorldMode();
   rendererCore_EndWorldRender();
@@ -66,14 +72,30 @@ void Game_Draw(EntityRegistry &reg, CommandBus &bus) {
 
   // Screen-space debug HUD (outside camera)
   DebugSystem_RenderScreenSpace(reg);
+  DEBUG_DRAW_FLUSH(DEBUG_LAYER_SCREEN,
+                   (creRectangle{0.0f, 0.0f,
+                                 static_cast<float>(GetScreenWidth()),
+                                 static_cast<float>(GetScreenHeight())}));
 }
 void Game_Shutdown(EntityRegistry &reg, CommandBus &bus) {
   (void)reg;
   (void)bus;
-  // Cleanup if needed
+  GameAI_Shutdown();
 }
-static void ResetGameplay(EntityRegistry &reg, CommandBus &bus) {
-  Entity mainCam = ControlSystem_SpawnCamera(reg);
-  Entity player = ControlSystem_SpawnPlayer(reg, bus);
-  ControlSystem_SetCameraTarget(reg, bus, player, mainCam);
+static void HandleDebugAudio(CommandBus &bus) {
+  if (Input_IsPressed(ACTION_DEBUG_SPAWN_HORDE)) {
+    /// AUDIO SFX TEST
+    audioAPI_PlayOneShot(bus, AUDIO_GROUP_MASTER, AUDIO_SOURCE_TEST_SFX);
+  }
+
+  if (Input_IsPressed(ACTION_DEBUG_MUSIC)) {
+    /// BGM TESTING!!!!
+    const AudioID bgmID = audioAPI_AllocateSound();
+    audioAPI_SoundLoad(bus, bgmID, AUDIO_SOURCE_TEST_BGM, AUDIO_GROUP_MASTER,
+                       AUDIO_USAGE_STREAM);
+    audioAPI_SoundSetVolume(bus, bgmID, 0.5f);
+    audioAPI_SoundSetPitch(bus, bgmID, 1.0f);
+    audioAPI_SoundSetPan(bus, bgmID, 0.0f);
+    audioAPI_SoundPlay(bus, bgmID);
+  }
 }
@@ -0,0 +1,87 @@
+#include "game_ai.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include "engine/systems/ai/cre_aiSystem.h"
+#include "engine/systems/physics/cre_physicsAPI.h"
+#include <math.h>
+
+#define ZOMBIE_SPEED 180.0f
+#define ZOMBIE_AGGRO_RADIUS 1600.0f
+#define ZOMBIE_AGGRO_RADIUS_SQR (ZOMBIE_AGGRO_RADIUS * ZOMBIE_AGGRO_RADIUS)
+#define ZOMBIE_GIVEUP_RADIUS 2400.0f
+#define ZOMBIE_GIVEUP_RADIUS_SQR (ZOMBIE_GIVEUP_RADIUS * ZOMBIE_GIVEUP_RADIUS)
+#define ZOMBIE_IDLE_THINK_TIME 0.25f
+
+static Entity s_player = ENTITY_INVALID;
+
+// ============================================================================
+// Zombie States
+// ============================================================================
+
+static void ZombieIdle_Update(const AIStateContext *ctx, const uint32_t *ids,
+                              uint32_t count) {
+  if (!EntityRegistry_IsAlive(ctx->state_flags, ctx->generations, s_player))
+    return;
+
+  const creVec2 playerPos = ctx->pos[s_player.id];
+  for (uint32_t n = 0; n < count; ++n) {
+    const uint32_t id = ids[n];
+    if (ctx->timers[id] < ZOMBIE_IDLE_THINK_TIME)
+      continue;
+
+    const float dx = playerPos.x - ctx->pos[id].x;
+    const float dy = playerPos.y - ctx->pos[id].y;
+    if ((dx * dx + dy * dy) > ZOMBIE_AGGRO_RADIUS_SQR)
+      continue;
+
+    ctx->targets[id] = s_player;
+    ctx->next_states[id] = AI_ZOMBIE_CHASE;
+  }
+}
+
+static void ZombieChase_Update(const AIStateContext *ctx, const uint32_t *ids,
+                               uint32_t count) {
+  CommandBus &bus = *ctx->bus;
+  for (uint32_t n = 0; n < count; ++n) {
+    const uint32_t id = ids[n];
+    const Entity self = {.id = id, .generation = ctx->generations[id]};
+    const Entity target = ctx->targets[id];
+
+    if (!EntityRegistry_IsAlive(ctx->state_flags, ctx->generations, target)) {
+      ctx->next_states[id] = AI_ZOMBIE_IDLE;
+      physicsAPI_SetVelocity(bus, self, 0.0f, 0.0f);
+      continue;
+    }
+
+    const float dx = ctx->pos[target.id].x - ctx->pos[id].x;
+    const float dy = ctx->pos[target.id].y - ctx->pos[id].y;
+    const float distSqr = dx * dx + dy * dy;
+    if (distSqr > ZOMBIE_GIVEUP_RADIUS_SQR) {
+      ctx->next_states[id] = AI_ZOMBIE_IDLE;
+      physicsAPI_SetVelocity(bus, self, 0.0f, 0.0f);
+      continue;
+    }
+    if (distSqr < 1.0f)
+      continue;
+
+    const float invLen = ZOMBIE_SPEED / sqrtf(distSqr);
+    physicsAPI_SetVelocity(bus, self, dx * invLen, dy * invLen);
+  }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void GameAI_Init(void) {
+  aiSystem_ClearStates();
+  aiSystem_RegisterState(AI_ZOMBIE_IDLE, ZombieIdle_Update);
+  aiSystem_RegisterState(AI_ZOMBIE_CHASE, ZombieChase_Update);
+  s_player = ENTITY_INVALID;
+}
+
+void GameAI_Shutdown(void) {
+  aiSystem_ClearStates();
+  s_player = ENTITY_INVALID;
+}
+
+void GameAI_SetPlayer(Entity player) { s_player = player; }
@@ -0,0 +1,29 @@
+#ifndef GAME_AI_H
+#define GAME_AI_H
+
+#include "engine/core/cre_types.h"
+#include <stdint.h>
+
+// Game AI states (0 is AI_STATE_NONE, reserved by the engine).
+enum GameAIState : uint8_t {
+  AI_ZOMBIE_IDLE = 1,
+  AI_ZOMBIE_CHASE,
+};
+
+/**
+ * @brief Register every game AI state handler with the AI system.
+ */
+void GameAI_Init(void);
+
+/**
+ * @brief Release game AI state handlers (scene unload).
+ */
+void GameAI_Shutdown(void);
+
+/**
+ * @brief Set the entity idle zombies acquire as their chase target.
+ * @param player Player handle (may be a reserved, not yet alive handle)
+ */
+void GameAI_SetPlayer(Entity player);
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef GAME_COMPONENTS_H
+#define GAME_COMPONENTS_H
+
+// Game components, stored as EntityRegistry columns (cre_gameComponents.h).
+// COMPONENT(NAME, bit 32..63), FIELD(COMPONENT, column, type, init, clone)
+#define CRE_GAME_COMPONENTS(COMPONENT, FIELD)                                 \
+  COMPONENT(MOVER, 32)                                                         \
+  FIELD(MOVER, move_speed, float, 0.0f, CLONE_COPY) // Pixels per second
+
+#endif
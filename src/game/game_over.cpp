@@ -7,13 +7,30 @@
 #include "engine/systems/camera/cre_cameraSystem.h"
 #include "engine/systems/render/cre_renderSystem.h"
 #include "engine/systems/render/cre_rendererCore.h"
+#include "engine/systems/render/cre_textRenderer.h"
 #include "game_config.h"
 #include "game_scenes.h"
 
+// Laid out once per scene, drawn from the atlas every frame
+static TextID s_titleText = TEXT_INVALID;
+static TextID s_restartText = TEXT_INVALID;
+
+static void DrawCentered(TextID text, int y, creColor color) {
+  const int width = static_cast<int>(textRenderer_Measure(text).x);
+  textRenderer_Draw(
+      text,
+      creVec2{static_cast<float>((static_cast<int>(SCREEN_WIDTH) - width) / 2),
+              static_cast<float>(y)},
+      color);
+}
+
 void GameOver_Init(EntityRegistry &reg, CommandBus &bus) {
   (void)reg;
   (void)bus;
   // Optional for game over sound effect or anything
+  s_titleText = textRenderer_Create(GAMEOVER_TITLE_TEXT, FONT_SIZE_TITLE);
+  s_restartText =
+      textRenderer_Create(GAMEOVER_RESTART_TEXT, FONT_SIZE_SUBTITLE);
 }
 
 void GameOver_Update(EntityRegistry &reg, CommandBus &bus, float dt) {
@@ -39,20 +56,16 @@ void GameOver_Draw(EntityRegistry &reg, CommandBus &bus) {
   rendererCore_EndWorldMode();
   rendererCore_EndWorldRender();
 
-  int titleWidth = MeasureText(GAMEOVER_TITLE_TEXT, FONT_SIZE_TITLE);
-  DrawText(GAMEOVER_TITLE_TEXT,
-           (static_cast<int>(SCREEN_WIDTH) - titleWidth) / 2,
-           static_cast<int>(SCREEN_HEIGHT) / 2 - 50, FONT_SIZE_TITLE, RED);
-
-  int restartWidth = MeasureText(GAMEOVER_RESTART_TEXT, FONT_SIZE_SUBTITLE);
-  DrawText(GAMEOVER_RESTART_TEXT,
-           (static_cast<int>(SCREEN_WIDTH) - restartWidth) / 2,
-           static_cast<int>(SCREEN_HEIGHT) / 2 + 50, FONT_SIZE_SUBTITLE,
-           RAYWHITE);
+  const int centerY = static_cast<int>(SCREEN_HEIGHT) / 2;
+  DrawCentered(s_titleText, centerY - 50, (creColor{230, 41, 55, 255}));
+  DrawCentered(s_restartText, centerY + 50, (creColor{245, 245, 245, 255}));
 }
 
 void GameOver_Unload(EntityRegistry &reg, CommandBus &bus) {
   (void)reg;
   (void)bus;
-  // Nothing to clean up yet
+  textRenderer_Destroy(s_titleText);
+  textRenderer_Destroy(s_restartText);
+  s_titleText = TEXT_INVALID;
+  s_restartText = TEXT_INVALID;
 }
@@ -1,20 +1,27 @@
 #include "game_prototypes.h"
 #include "assets/atlas/atlas_data.h"
 #include "engine/core/cre_types.h"
+#include "engine/ecs/cre_entityAPI.h"
 #include "engine/ecs/cre_entityManager.h"
 #include "engine/ecs/cre_entityRegistry.h"
+#include "engine/systems/physics/cre_physicsAPI.h"
 #include "engine/systems/physics/cre_physicsSystem.h"
 #include "engine/systems/physics/cre_physics_defs.h"
 #include "entity_types.h"
+#include "game_ai.h"
 #include "game_config.h"
 
+#define PLAYER_SPEED 400.0f
+#define CHAIN_LINK_SPACING 16.0f
+
 Entity g_playerPrototype = Entity{.id = 0, .generation = 0};
 Entity g_zombiePrototype = Entity{.id = 1, .generation = 0};
+Entity g_chainLinkPrototype = ENTITY_INVALID;
 
 void Prototypes_Init(EntityRegistry &reg) {
   // Zombie prototype
-  uint64_t zombieCompMask =
-      COMP_SPRITE | COMP_ANIMATION | COMP_PHYSICS | COMP_COLLISION_AABB;
+  uint64_t zombieCompMask = COMP_SPRITE | COMP_ANIMATION | COMP_PHYSICS |
+                            COMP_COLLISION_AABB | COMP_AI;
   uint64_t zombieFlags =
       FLAG_VISIBLE | SET_LAYER(L_ENEMY) | SET_MASK(L_PLAYER | L_ENEMY);
 
@@ -29,10 +36,12 @@ void Prototypes_Init(EntityRegistry &reg) {
     reg.material_id[zombieid] = MAT_DEFAULT;
     reg.drag[zombieid] = 2.0f;
     reg.inv_mass[zombieid] = 1.0f; // Fix this later on.
+    reg.ai_states[zombieid] = AI_ZOMBIE_IDLE;
   }
 
   // Player prototype
-  uint64_t playerCompMask = COMP_SPRITE | COMP_PHYSICS | COMP_COLLISION_Circle;
+  uint64_t playerCompMask =
+      COMP_SPRITE | COMP_PHYSICS | COMP_COLLISION_Circle | COMP_MOVER;
 
   uint64_t playerFlags = FLAG_VISIBLE | FLAG_ALWAYS_AWAKE |
                          SET_LAYER(L_PLAYER) | SET_MASK(L_ENEMY | L_BULLET);
@@ -47,5 +56,49 @@ void Prototypes_Init(EntityRegistry &reg) {
     reg.material_id[playerid] = MAT_PLAYER;
     reg.drag[playerid] = 0.2f;
     reg.inv_mass[playerid] = 1.0f;
+    reg.move_speed[playerid] = PLAYER_SPEED;
+  }
+
+  // Chain link prototype (joint benchmark). Links only collide with the
+  // player, not with each other.
+  uint64_t linkCompMask = COMP_SPRITE | COMP_PHYSICS | COMP_COLLISION_Circle;
+  uint64_t linkFlags =
+      FLAG_VISIBLE | SET_LAYER(L_PARTICLE) | SET_MASK(L_PLAYER);
+
+  g_chainLinkPrototype = EntityManager_Create(
+      reg, TYPE_CHAIN_LINK, creVec2{0.0f, 0.0f}, linkCompMask, linkFlags);
+  if (ENTITY_IS_VALID(g_chainLinkPrototype)) {
+    const uint32_t linkid = g_chainLinkPrototype.id;
+    reg.size[linkid] = creVec2{16.0f, 16.0f};
+    reg.render_layer[linkid] = RENDER_LAYER_ENEMY;
+    reg.batch_ids[linkid] = RENDER_BATCH_ENEMY;
+    reg.sprite_ids[linkid] = SPR_FISH_BLUE;
+    reg.material_id[linkid] = MAT_DEFAULT;
+    reg.drag[linkid] = 0.5f;
+    reg.inv_mass[linkid] = 1.0f;
+  }
+}
+
+Entity Prototypes_SpawnChain(EntityRegistry &reg, CommandBus &bus,
+                             creVec2 origin, uint32_t links) {
+  Entity prev = ENTITY_INVALID;
+  for (uint32_t i = 0; i < links; i++) {
+    const creVec2 linkPos = {
+        origin.x + static_cast<float>(i) * CHAIN_LINK_SPACING, origin.y};
+    Entity link = entityAPI_Spawn(reg, bus, g_chainLinkPrototype, linkPos);
+    if (!ENTITY_IS_VALID(link))
+      break;
+    physicsAPI_DefineBody(bus, link, MAT_DEFAULT, 0.5f, false);
+
+    if (ENTITY_IS_VALID(prev)) {
+      physicsAPI_CreateJoint(bus, PHYS_JOINT_DISTANCE, prev, link,
+                             CHAIN_LINK_SPACING);
+    } else {
+      physicsAPI_CreateWorldJoint(
+          bus, PHYS_JOINT_WELD, link,
+          creVec2{linkPos.x + 8.0f, linkPos.y + 8.0f}, 0.0f);
+    }
+    prev = link;
   }
+  return prev;
 }
@@ -2,11 +2,22 @@
 #define GAME_PROTOTYPES_H
 
 #include "engine/core/cre_types.h"
+#include <stdint.h>
+struct CommandBus;
 struct EntityRegistry;
 
 extern Entity g_playerPrototype;
 extern Entity g_zombiePrototype;
+extern Entity g_chainLinkPrototype;
 
 void Prototypes_Init(EntityRegistry &reg);
 
+/**
+ * @brief Joint benchmark: a chain of links along +x from origin, the first
+ * welded to the world, each next one held at a fixed distance.
+ * @return The free end, or ENTITY_INVALID if no link could be spawned
+ */
+Entity Prototypes_SpawnChain(EntityRegistry &reg, CommandBus &bus,
+                             creVec2 origin, uint32_t links);
+
 #endif
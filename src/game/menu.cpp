@@ -1,15 +1,33 @@
 #include "menu.h"
+#include "engine/core/cre_colors.h"
 #include "engine/core/cre_config.h"
 #include "engine/core/cre_logger.h"
 #include "engine/platform/cre_input.h"
 #include "engine/scene/cre_sceneManager.h" // For switch scene,
+#include "engine/systems/render/cre_textRenderer.h"
 #include "game_config.h"
 #include "game_scenes.h"
-#include "raylib.h"
+
+// Laid out once per scene, drawn from the atlas every frame
+static TextID s_titleText = TEXT_INVALID;
+static TextID s_startText = TEXT_INVALID;
+static TextID s_quitText = TEXT_INVALID;
+
+static void DrawCentered(TextID text, int y, creColor color) {
+  const int width = static_cast<int>(textRenderer_Measure(text).x);
+  textRenderer_Draw(
+      text,
+      creVec2{static_cast<float>((static_cast<int>(SCREEN_WIDTH) - width) / 2),
+              static_cast<float>(y)},
+      color);
+}
 
 void Menu_Init(EntityRegistry &reg, CommandBus &bus) {
   (void)reg;
   (void)bus;
+  s_titleText = textRenderer_Create(GAME_TITLE, FONT_SIZE_TITLE);
+  s_startText = textRenderer_Create(MENU_START_TEXT, FONT_SIZE_TITLE);
+  s_quitText = textRenderer_Create(MENU_TO_QUIT, FONT_SIZE_TITLE);
   Log(LogLevel::Info, "Scene: Menu Initialized");
 }
 
@@ -26,21 +44,20 @@ void Menu_Update(EntityRegistry &reg, CommandBus &bus, float dt) {
 void Menu_Draw(EntityRegistry &reg, CommandBus &bus) {
   (void)reg;
   (void)bus;
-  int titleWidth = MeasureText(GAME_TITLE, FONT_SIZE_TITLE);
-  DrawText(GAME_TITLE, (static_cast<int>(SCREEN_WIDTH) - titleWidth) / 2,
-           static_cast<int>(SCREEN_HEIGHT) / 2 - 80, FONT_SIZE_TITLE, RED);
-
-  int startWidth = MeasureText(MENU_START_TEXT, FONT_SIZE_TITLE);
-  DrawText(MENU_START_TEXT, (static_cast<int>(SCREEN_WIDTH) - startWidth) / 2,
-           static_cast<int>(SCREEN_HEIGHT) / 2, FONT_SIZE_TITLE, BLACK);
-
-  int quitWidth = MeasureText(MENU_TO_QUIT, FONT_SIZE_TITLE);
-  DrawText(MENU_TO_QUIT, (static_cast<int>(SCREEN_WIDTH) - quitWidth) / 2,
-           static_cast<int>(SCREEN_HEIGHT) / 2 + 80, FONT_SIZE_TITLE, BLACK);
+  const int centerY = static_cast<int>(SCREEN_HEIGHT) / 2;
+  DrawCentered(s_titleText, centerY - 80, (creColor{230, 41, 55, 255}));
+  DrawCentered(s_startText, centerY, creBLACK);
+  DrawCentered(s_quitText, centerY + 80, creBLACK);
 }
 
 void Menu_Unload(EntityRegistry &reg, CommandBus &bus) {
   (void)reg;
   (void)bus;
+  textRenderer_Destroy(s_titleText);
+  textRenderer_Destroy(s_startText);
+  textRenderer_Destroy(s_quitText);
+  s_titleText = TEXT_INVALID;
+  s_startText = TEXT_INVALID;
+  s_quitText = TEXT_INVALID;
   Log(LogLevel::Info, "Scene: Menu Unloaded.");
 }
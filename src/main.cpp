@@ -1,11 +1,15 @@
 #include "engine/core/cre_engine.h"
+#include "engine/core/cre_replay.h"
+#include "engine/core/cre_stateHash.h"
 #include "engine/core/cre_types.h"
 #include "engine/memory/cre_arena.h"
 #include "engine/scene/cre_sceneManager.h"
 #include "game/game_scenes.h"
 #include "game_config.h"
 
-int main() {
+int main(int argc, char **argv) {
+  Replay_Init(argc, argv);
+  StateHash_Init(argc, argv);
 
   EngineContext ctx = {};
   ctx.masterArena = arena_AllocateMemory(256 * 1024 * 1024); // 256MB
@@ -0,0 +1,1906 @@
+// Headless server entry point (CRayEngine_Server). No raylib, no window.
+//
+//   CRayEngine_Server [--ticks N] [--entities N] [--seed N] [--hash-log f]
+//   CRayEngine_Server --bench [--entities N] [--ticks N]
+//   CRayEngine_Server --net-bench [--entities N] [--ticks N] [--loss N]
+//   CRayEngine_Server --rollback-bench [--entities N] [--ticks N] [--window N]
+//   CRayEngine_Server --grid-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --hierarchy-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --tween-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --timer-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --ui-bench [--ticks N]
+//   CRayEngine_Server --light-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --vision-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --chain-bench [--entities N] [--ticks N]
+//   CRayEngine_Server --replay f [--frames N] [--timings f] [--hash-ref f]
+//
+// Ticks run back to back (uncapped). --bench spawns the horde, warms up and
+// reports ticks/sec on this core. --net-bench replicates every tick to one
+// loopback client and reports snapshot bytes and encode/decode times
+// (--loss N drops every Nth message in both directions). --rollback-bench
+// saves every tick, and every frame rolls back --window ticks and
+// re-simulates them, checking the result against the original run.
+// --grid-bench rebuilds and queries the chained spatial hash and the
+// open-addressed sparse grid from the same boxes over a 200k px world.
+// --hierarchy-bench parents --entities children (two levels deep) to moving
+// roots and times the transform system against a per-child walk to the root.
+// --tween-bench keeps --entities tweens running (restarting finished ones)
+// and times the pooled tween system against a per-tween switch loop.
+// --timer-bench keeps --entities timers pending in the timing wheel (with
+// cancel/reschedule churn) against a per-tick countdown over an array, then
+// checks that DestroyAfter entities die on their tick through the engine.
+// --ui-bench builds a 500-widget inventory screen, changes a few labels per
+// frame and times the incremental layout and draw list submission against
+// a full relayout (what an immediate-mode UI pays every frame).
+// --light-bench moves --entities lights through walled rooms on the light
+// grid, opening and closing doors, and times the incremental light map
+// update against flooding every light again each frame.
+// --vision-bench moves --entities viewers of four teams through the same
+// rooms, opening and closing doors, and times the cached fog of war update
+// against shadowcasting every viewer again each frame.
+// --chain-bench hangs an --entities link chain (distance joints, welded to
+// the world at one end) from the game's prototype under gravity, kicks the
+// free end and times the physics step with its joint solver, reporting how
+// far links drift from their rest distance.
+// --replay plays a client recording (--record, cre_replay.h) through the
+// game scene without drawing, one recorded frame per tick, as fast as the
+// core allows, and reports per-frame times. With --hash-ref set to the
+// --hash-log of the recording session (or of a client replay), every fixed
+// step is checked against the client's state hashes.
+#include "assets/atlas/atlas_data.h"
+#include "engine/core/cre_commandBus.h"
+#include "engine/core/cre_engineHeadless.h"
+#include "engine/core/cre_engineStats.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_random.h"
+#include "engine/core/cre_replay.h"
+#include "engine/core/cre_rollback.h"
+#include "engine/core/cre_simState.h"
+#include "engine/core/cre_stateHash.h"
+#include "engine/core/cre_systemPackets.h"
+#include "engine/core/cre_types.h"
+#include "engine/ecs/cre_entityManager.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include "engine/memory/cre_arena.h"
+#include "engine/net/cre_replication.h"
+#include "engine/net/cre_transport.h"
+#include "engine/platform/cre_sys.h"
+#include "engine/scene/cre_sceneManager.h"
+#include "engine/systems/debug/cre_profilerSystem.h"
+#include "engine/systems/light/cre_lightSystem.h"
+#include "engine/systems/physics/cre_physicsAPI.h"
+#include "engine/systems/physics/cre_physicsConstraints.h"
+#include "engine/systems/physics/cre_physicsSystem.h"
+#include "engine/systems/physics/cre_sparseGrid.h"
+#include "engine/systems/physics/cre_spatialHash.h"
+#include "engine/systems/timer/cre_timerAPI.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include "engine/systems/transform/cre_transformSystem.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+#include "engine/systems/ui/cre_uiSystem.h"
+#include "engine/systems/vision/cre_visionSystem.h"
+#include "game/entity_types.h"
+#include "game/game_prototypes.h"
+#include "server_scenes.h"
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr uint32_t BENCH_WARMUP_TICKS = 120;
+static constexpr uint32_t BENCH_DEFAULT_TICKS = 600;
+static constexpr uint32_t DEFAULT_ENTITIES = 16000;
+static constexpr uint32_t NET_BENCH_DEFAULT_ENTITIES = 5000;
+static constexpr uint32_t ROLLBACK_BENCH_DEFAULT_ENTITIES = 4000;
+static constexpr uint32_t ROLLBACK_BENCH_DEFAULT_WINDOW = 8;
+static constexpr uint32_t ROLLBACK_BENCH_POOL_PAGES = 8192; // 32MB
+static constexpr uint32_t GRID_BENCH_DEFAULT_BOXES = 8000;
+static constexpr uint32_t GRID_BENCH_DEFAULT_ROUNDS = 50;
+static constexpr int32_t GRID_BENCH_WORLD = 200000; // px, both axes
+static constexpr int32_t GRID_BENCH_CLUSTERS = 8;
+static constexpr int32_t GRID_BENCH_CLUSTER_RADIUS = 512;
+static constexpr int32_t GRID_BENCH_QUERY_MARGIN = 32;
+static constexpr int GRID_BENCH_MAX_RESULTS = 512;
+static constexpr uint32_t HIERARCHY_BENCH_DEFAULT_CHILDREN = 10000;
+static constexpr uint32_t HIERARCHY_BENCH_DEFAULT_ROUNDS = 200;
+static constexpr uint32_t HIERARCHY_BENCH_FANOUT = 8; // Children per root
+static constexpr uint32_t TWEEN_BENCH_DEFAULT_TWEENS = 50000;
+static constexpr uint32_t TWEEN_BENCH_DEFAULT_FRAMES = 600;
+static constexpr uint32_t TWEEN_BENCH_TARGETS = 4; // pos, rot, scale, color
+static constexpr uint32_t TIMER_BENCH_DEFAULT_TIMERS = 100000;
+static constexpr uint32_t TIMER_BENCH_DEFAULT_TICKS = 4200; // Past 64^2
+static constexpr uint32_t TIMER_BENCH_CHURN = 1000; // Cancel + reschedule/tick
+static constexpr uint32_t TIMER_CHECK_ENTITIES = 128; // Die after 1..128 ticks
+static constexpr uint32_t UI_BENCH_DEFAULT_FRAMES = 600;
+static constexpr uint32_t UI_BENCH_ROWS = 16;
+static constexpr uint32_t UI_BENCH_COLUMNS = 10; // 160 slots, 3 widgets each
+static constexpr uint32_t UI_BENCH_CHANGES = 4;  // Slot counts set per frame
+static constexpr float UI_BENCH_SCREEN_W = 1280.0f;
+static constexpr float UI_BENCH_SCREEN_H = 1280.0f;
+static constexpr uint32_t LIGHT_BENCH_DEFAULT_LIGHTS = 200;
+static constexpr uint32_t LIGHT_BENCH_DEFAULT_FRAMES = 600;
+static constexpr int32_t LIGHT_BENCH_ROOM = 16;   // Cells between walls
+static constexpr uint32_t LIGHT_BENCH_DOORS = 4;  // Doors toggled per frame
+static constexpr uint32_t LIGHT_BENCH_SAMPLES = 100000;
+static constexpr uint32_t VISION_BENCH_DEFAULT_VIEWERS = 256;
+static constexpr uint32_t VISION_BENCH_DEFAULT_FRAMES = 600;
+static constexpr uint32_t VISION_BENCH_TEAMS = 4;
+static constexpr int32_t VISION_BENCH_ROOM = 16;  // Cells between walls
+static constexpr uint32_t VISION_BENCH_DOORS = 4; // Doors toggled per frame
+static constexpr uint32_t VISION_BENCH_QUERIES = 100000;
+static constexpr uint32_t CHAIN_BENCH_DEFAULT_LINKS = 500;
+static constexpr uint32_t CHAIN_BENCH_DEFAULT_TICKS = 600;
+static constexpr float CHAIN_BENCH_KICK = 600.0f; // px/s on the free end
+static constexpr float CHAIN_BENCH_GRAVITY = 980.0f; // px/s^2, down
+static constexpr float CHAIN_BENCH_SPACING = 16.0f; // Prototypes_SpawnChain
+
+struct ServerOptions {
+  uint32_t ticks;    // 0 = run forever (bench: measured ticks)
+  uint32_t entities; // Horde size
+  uint64_t seed;
+  uint32_t loss;   // --net-bench: drop every Nth message, 0 = lossless
+  uint32_t window; // --rollback-bench: ticks rolled back per frame
+  bool bench;
+  bool netBench;
+  bool rollbackBench;
+  bool gridBench;
+  bool hierarchyBench;
+  bool tweenBench;
+  bool timerBench;
+  bool uiBench;
+  bool lightBench;
+  bool visionBench;
+  bool chainBench;
+  bool replay; // --replay <file> (parsed by Replay_Init)
+};
+
+static ServerOptions ParseOptions(int argc, char **argv) {
+  ServerOptions opt = {.ticks = 0,
+                       .entities = 0,
+                       .seed = 1,
+                       .loss = 0,
+                       .window = ROLLBACK_BENCH_DEFAULT_WINDOW,
+                       .bench = false,
+                       .netBench = false,
+                       .rollbackBench = false,
+                       .gridBench = false,
+                       .hierarchyBench = false,
+                       .tweenBench = false,
+                       .timerBench = false,
+                       .uiBench = false,
+                       .lightBench = false,
+                       .visionBench = false,
+                       .chainBench = false,
+                       .replay = false};
+  for (int i = 1; i < argc; i++) {
+    const bool hasValue = (i + 1) < argc;
+    if (strcmp(argv[i], "--bench") == 0) {
+      opt.bench = true;
+    } else if (strcmp(argv[i], "--net-bench") == 0) {
+      opt.netBench = true;
+    } else if (strcmp(argv[i], "--rollback-bench") == 0) {
+      opt.rollbackBench = true;
+    } else if (strcmp(argv[i], "--grid-bench") == 0) {
+      opt.gridBench = true;
+    } else if (strcmp(argv[i], "--hierarchy-bench") == 0) {
+      opt.hierarchyBench = true;
+    } else if (strcmp(argv[i], "--tween-bench") == 0) {
+      opt.tweenBench = true;
+    } else if (strcmp(argv[i], "--timer-bench") == 0) {
+      opt.timerBench = true;
+    } else if (strcmp(argv[i], "--ui-bench") == 0) {
+      opt.uiBench = true;
+    } else if (strcmp(argv[i], "--light-bench") == 0) {
+      opt.lightBench = true;
+    } else if (strcmp(argv[i], "--vision-bench") == 0) {
+      opt.visionBench = true;
+    } else if (strcmp(argv[i], "--chain-bench") == 0) {
+      opt.chainBench = true;
+    } else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+      opt.replay = true;
+      i++;
+    } else if (strcmp(argv[i], "--window") == 0 && hasValue) {
+      opt.window = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--loss") == 0 && hasValue) {
+      opt.loss = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--ticks") == 0 && hasValue) {
+      opt.ticks = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--entities") == 0 && hasValue) {
+      opt.entities = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+      opt.seed = strtoull(argv[++i], nullptr, 10);
+    }
+  }
+  if (opt.gridBench && opt.ticks == 0)
+    opt.ticks = GRID_BENCH_DEFAULT_ROUNDS;
+  if (opt.hierarchyBench && opt.ticks == 0)
+    opt.ticks = HIERARCHY_BENCH_DEFAULT_ROUNDS;
+  if (opt.tweenBench && opt.ticks == 0)
+    opt.ticks = TWEEN_BENCH_DEFAULT_FRAMES;
+  if (opt.timerBench && opt.ticks == 0)
+    opt.ticks = TIMER_BENCH_DEFAULT_TICKS;
+  if (opt.uiBench && opt.ticks == 0)
+    opt.ticks = UI_BENCH_DEFAULT_FRAMES;
+  if (opt.lightBench && opt.ticks == 0)
+    opt.ticks = LIGHT_BENCH_DEFAULT_FRAMES;
+  if (opt.visionBench && opt.ticks == 0)
+    opt.ticks = VISION_BENCH_DEFAULT_FRAMES;
+  if (opt.chainBench && opt.ticks == 0)
+    opt.ticks = CHAIN_BENCH_DEFAULT_TICKS;
+  if ((opt.bench || opt.netBench || opt.rollbackBench) && opt.ticks == 0)
+    opt.ticks = BENCH_DEFAULT_TICKS;
+  if (opt.entities == 0) {
+    opt.entities = opt.netBench        ? NET_BENCH_DEFAULT_ENTITIES
+                   : opt.rollbackBench ? ROLLBACK_BENCH_DEFAULT_ENTITIES
+                   : opt.gridBench      ? GRID_BENCH_DEFAULT_BOXES
+                   : opt.hierarchyBench ? HIERARCHY_BENCH_DEFAULT_CHILDREN
+                   : opt.tweenBench     ? TWEEN_BENCH_DEFAULT_TWEENS
+                   : opt.timerBench     ? TIMER_BENCH_DEFAULT_TIMERS
+                   : opt.lightBench     ? LIGHT_BENCH_DEFAULT_LIGHTS
+                   : opt.visionBench    ? VISION_BENCH_DEFAULT_VIEWERS
+                   : opt.chainBench     ? CHAIN_BENCH_DEFAULT_LINKS
+                                        : DEFAULT_ENTITIES;
+  }
+  opt.window = std::min(std::max(opt.window, 1u), ROLLBACK_MAX_TICKS - 1);
+  return opt;
+}
+
+static void WarmUp(EngineContext &ctx) {
+  // Populate, then let the horde settle into steady state.
+  uint32_t setupTicks = 0;
+  while (!ServerScene_IsPopulated() && setupTicks < 1000) {
+    EngineHeadless_Tick(ctx);
+    setupTicks++;
+  }
+  for (uint32_t i = 0; i < BENCH_WARMUP_TICKS; i++) {
+    EngineHeadless_Tick(ctx);
+  }
+}
+
+static void RunBench(EngineContext &ctx, const ServerOptions &opt) {
+  WarmUp(ctx);
+
+  float *tickMs = static_cast<float *>(malloc(sizeof(float) * opt.ticks));
+  if (!tickMs) {
+    Log(LogLevel::Error, "[SERVER] Out of memory for {} samples", opt.ticks);
+    return;
+  }
+
+  uint64_t subSteps = 0;
+  uint64_t iterations = 0;
+  uint64_t budgetCuts = 0;
+  const double benchStart = Platform_GetTime();
+  for (uint32_t i = 0; i < opt.ticks; i++) {
+    const double t0 = Platform_GetTime();
+    EngineHeadless_Tick(ctx);
+    tickMs[i] = static_cast<float>((Platform_GetTime() - t0) * 1000.0);
+    const PhysicsStepStats steps = PhysicsSystem_GetStepStats();
+    subSteps += steps.subSteps;
+    iterations += steps.iterations;
+    budgetCuts += steps.budgetCuts;
+  }
+  const double elapsed = Platform_GetTime() - benchStart;
+
+  std::sort(tickMs, tickMs + opt.ticks);
+  const uint32_t p99 = std::min(opt.ticks - 1, (opt.ticks * 99) / 100);
+  const double ticksPerSec = static_cast<double>(opt.ticks) / elapsed;
+
+  Log(LogLevel::Info,
+      "[BENCH] {} active entities | {} ticks | {:.1f} ticks/s per core | "
+      "avg {:.3f} ms | p50 {:.3f} ms | p99 {:.3f} ms | max {:.3f} ms",
+      ctx.reg->active_count, opt.ticks, ticksPerSec,
+      (elapsed * 1000.0) / static_cast<double>(opt.ticks),
+      tickMs[opt.ticks / 2], tickMs[p99], tickMs[opt.ticks - 1]);
+  Log(LogLevel::Info, "[BENCH] {:.2f}x realtime at {:.0f} Hz fixed step",
+      ticksPerSec * static_cast<double>(ctx.time.fixedDt),
+      1.0 / static_cast<double>(ctx.time.fixedDt));
+  Log(LogLevel::Info,
+      "[BENCH] Physics {:.2f} sub-steps x {:.2f} iterations per tick | "
+      "{} sub-steps cut by the time budget",
+      static_cast<double>(subSteps) / opt.ticks,
+      static_cast<double>(iterations) /
+          static_cast<double>(subSteps > 0 ? subSteps : 1),
+      budgetCuts);
+
+  // Broad-phase load of one more (instrumented) tick, for grid tuning
+  SpatialHash_SetInstrumentation(true);
+  EngineHeadless_Tick(ctx);
+  const SpatialHashStats hash = SpatialHash_GetStats();
+  const PhysicsSolverStats solver = PhysicsSystem_GetSolverStats();
+  SpatialHash_SetInstrumentation(false);
+  Log(LogLevel::Info,
+      "[BENCH] Hash {} nodes in {}/{} buckets | chain max {} avg {:.2f} | "
+      "{} collided buckets (+{} cells) | densest bucket {} contacts",
+      hash.nodes, hash.usedBuckets, SPATIAL_HASH_SIZE, hash.maxChain,
+      static_cast<double>(hash.avgChain), hash.collidedBuckets,
+      hash.collidedCells, hash.maxBucketContacts);
+  Log(LogLevel::Info,
+      "[BENCH] {} bodies hit PHYS_MAX_NEIGHBOURS ({}) | {} bodies past the "
+      "node pool",
+      solver.truncatedQueries, PHYS_MAX_NEIGHBOURS, hash.overflowBodies);
+
+  // The incremental counters must match a full scan
+  const EngineStats stats = EngineStats_Get(*ctx.reg);
+  const EngineStats scan = EngineStats_Recount(*ctx.reg);
+  Log(EngineStats_Equal(stats, scan) ? LogLevel::Info : LogLevel::Error,
+      "[BENCH] Entities {} | physics {} | static {} | sleeping {} | culled {} "
+      "| awake {} (full scan: {})",
+      stats.active, stats.physics, stats.statics, stats.sleeping,
+      stats.culled, stats.awake,
+      EngineStats_Equal(stats, scan) ? "match" : "MISMATCH");
+  free(tickMs);
+}
+
+static void RunNetBench(EngineContext &ctx, const ServerOptions &opt) {
+  ReplicationServer *server = arena_Push<ReplicationServer>(&ctx.masterArena);
+  ReplicationClient *client = arena_Push<ReplicationClient>(&ctx.masterArena);
+  LoopbackLink *link = arena_Push<LoopbackLink>(&ctx.masterArena);
+  if (!server || !client || !link) {
+    Log(LogLevel::Error, "[NET] Out of memory for replication state");
+    return;
+  }
+
+  Transport serverSide;
+  Transport clientSide;
+  LoopbackTransport_Init(link, &serverSide, &clientSide);
+  LoopbackTransport_SetLoss(link, opt.loss);
+  ReplicationServer_Init(server);
+  ReplicationClient_Init(client, &clientSide);
+  const int32_t slot = ReplicationServer_AddClient(server, &serverSide);
+
+  WarmUp(ctx);
+
+  // Full state against an empty baseline, for comparison
+  ReplicationServer_Capture(server, *ctx.reg);
+  const uint32_t fullBytes = ReplicationServer_Send(server, slot);
+  ReplicationClient_Receive(client);
+  ReplicationServer_ReceiveAcks(server);
+  const uint32_t fullsBefore = server->stats.fullSnapshots;
+  const uint64_t bytesBefore = server->stats.totalBytes;
+
+  double encodeUs = 0.0;
+  double decodeUs = 0.0;
+  uint32_t maxBytes = 0;
+  for (uint32_t i = 0; i < opt.ticks; i++) {
+    EngineHeadless_Tick(ctx);
+
+    const double t0 = Platform_GetTime();
+    ReplicationServer_Capture(server, *ctx.reg);
+    const uint32_t bytes = ReplicationServer_Send(server, slot);
+    const double t1 = Platform_GetTime();
+    ReplicationClient_Receive(client);
+    const double t2 = Platform_GetTime();
+    ReplicationServer_ReceiveAcks(server);
+
+    encodeUs += (t1 - t0) * 1e6;
+    decodeUs += (t2 - t1) * 1e6;
+    maxBytes = std::max(maxBytes, bytes);
+  }
+
+  // The client's latest snapshot must equal the server's capture of the same
+  // seq (under loss that may not be the very last one)
+  const ReplSnapshot *latest = ReplicationClient_Latest(client);
+  const ReplSnapshot *truth =
+      latest ? &server->history[latest->seq % REPL_HISTORY] : nullptr;
+  bool match = latest && latest->seq == truth->seq &&
+               latest->bound == truth->bound;
+  for (uint32_t i = 0; match && i < truth->bound; i++) {
+    match = latest->posX[i] == truth->posX[i] &&
+            latest->posY[i] == truth->posY[i] &&
+            latest->velX[i] == truth->velX[i] &&
+            latest->velY[i] == truth->velY[i] &&
+            latest->sprite[i] == truth->sprite[i] &&
+            latest->animFrame[i] == truth->animFrame[i] &&
+            latest->flags[i] == truth->flags[i];
+  }
+
+  const double n = static_cast<double>(opt.ticks);
+  const double avgBytes =
+      static_cast<double>(server->stats.totalBytes - bytesBefore) / n;
+  Log(LogLevel::Info,
+      "[NET] {} active entities | {} snapshots | full {} B | delta avg "
+      "{:.0f} B ({:.1f} bits/entity) | max {} B",
+      ctx.reg->active_count, opt.ticks, fullBytes, avgBytes,
+      (avgBytes * 8.0) / static_cast<double>(std::max(1u, ctx.reg->active_count)),
+      maxBytes);
+  Log(LogLevel::Info,
+      "[NET] capture+encode avg {:.1f} us | decode avg {:.1f} us | "
+      "{:.1f} KB/s at {:.0f} Hz",
+      encodeUs / n, decodeUs / n,
+      (avgBytes / 1024.0) / static_cast<double>(ctx.time.fixedDt),
+      1.0 / static_cast<double>(ctx.time.fixedDt));
+  Log(LogLevel::Info,
+      "[NET] loss 1/{} | resent full {} | client rejected {} | state {}",
+      opt.loss, server->stats.fullSnapshots - fullsBefore, client->rejected,
+      match ? "MATCH" : "MISMATCH");
+}
+
+static uint64_t HashSimState(void) {
+  const SimStateBlock *blocks = SimState_GetBlocks();
+  uint64_t hash = 0;
+  for (uint32_t b = 0; b < SimState_GetBlockCount(); b++) {
+    hash = StateHash_Bytes(blocks[b].base,
+                           static_cast<uint32_t>(blocks[b].size), hash);
+  }
+  return hash;
+}
+
+static void RunRollbackBench(EngineContext &ctx, const ServerOptions &opt) {
+  // Re-simulated ticks must match the original run exactly
+  PhysicsSystem_SetTimeBudget(0.0f);
+  if (!Rollback_Init(&ctx.masterArena, opt.window + 1,
+                     ROLLBACK_BENCH_POOL_PAGES)) {
+    return;
+  }
+
+  WarmUp(ctx);
+
+  // Fill the window
+  uint32_t tick = 0;
+  Rollback_Save(tick);
+  for (uint32_t i = 0; i < opt.window; i++) {
+    EngineHeadless_Tick(ctx);
+    Rollback_Save(++tick);
+  }
+
+  double tickUs = 0.0;
+  double saveUs = 0.0;
+  double restoreUs = 0.0;
+  double resimUs = 0.0;
+  uint64_t dirtyPages = 0;
+  uint64_t restoredPages = 0;
+  uint32_t mismatches = 0;
+
+  for (uint32_t frame = 0; frame < opt.ticks; frame++) {
+    // Normal tick + save
+    const double t0 = Platform_GetTime();
+    EngineHeadless_Tick(ctx);
+    const double t1 = Platform_GetTime();
+    Rollback_Save(++tick);
+    const double t2 = Platform_GetTime();
+    dirtyPages += Rollback_GetStats().lastDirtyPages;
+    const uint64_t expected = HashSimState();
+
+    // Late input: roll back the window and re-simulate it
+    const double t3 = Platform_GetTime();
+    if (!Rollback_Restore(tick - opt.window)) {
+      Log(LogLevel::Error, "[ROLLBACK] Tick {} not restorable",
+          tick - opt.window);
+      return;
+    }
+    const double t4 = Platform_GetTime();
+    restoredPages += Rollback_GetStats().lastRestoredPages;
+    for (uint32_t k = 0; k < opt.window; k++) {
+      EngineHeadless_Tick(ctx);
+      Rollback_Save(Rollback_GetHeadTick() + 1);
+    }
+    const double t5 = Platform_GetTime();
+    mismatches += (HashSimState() != expected);
+
+    tickUs += (t1 - t0) * 1e6;
+    saveUs += (t2 - t1) * 1e6;
+    restoreUs += (t4 - t3) * 1e6;
+    resimUs += (t5 - t4) * 1e6;
+  }
+
+  const double n = static_cast<double>(opt.ticks);
+  const double resimTickUs = resimUs / (n * static_cast<double>(opt.window));
+  const double frameUs = static_cast<double>(ctx.time.fixedDt) * 1e6;
+  const RollbackStats stats = Rollback_GetStats();
+  Log(LogLevel::Info,
+      "[ROLLBACK] {} active entities | state {} KB in {} pages | window {} "
+      "ticks | {} frames",
+      ctx.reg->active_count,
+      (SimState_GetTotalBytes() + 1023) / 1024, stats.pages, opt.window,
+      opt.ticks);
+  Log(LogLevel::Info,
+      "[ROLLBACK] tick {:.1f} us | save {:.1f} us ({:.1f} dirty pages) | "
+      "restore {:.1f} us ({:.1f} pages) | resim tick+save {:.1f} us",
+      tickUs / n, saveUs / n, static_cast<double>(dirtyPages) / n,
+      restoreUs / n, static_cast<double>(restoredPages) / n, resimTickUs);
+  Log(LogLevel::Info,
+      "[ROLLBACK] Budget: {:.1f} re-simulated ticks per {:.2f} ms frame | "
+      "mismatches {}/{}",
+      frameUs / resimTickUs, frameUs / 1000.0, mismatches, opt.ticks);
+}
+
+struct GridBenchBox {
+  int32_t x, y, w, h;
+};
+
+struct GridBenchResult {
+  double buildUs; // Per rebuild of all boxes
+  double queryUs; // Per query
+  uint64_t found; // Sum of query results, must match between structures
+};
+
+static GridBenchResult GridBench_RunHash(const GridBenchBox *boxes,
+                                         uint32_t count, uint32_t rounds,
+                                         uint32_t *results) {
+  GridBenchResult res = {.buildUs = 0.0, .queryUs = 0.0, .found = 0};
+  for (uint32_t r = 0; r < rounds; r++) {
+    const double t0 = Platform_GetTime();
+    SpatialHash_ClearDynamic();
+    for (uint32_t i = 0; i < count; i++) {
+      SpatialHash_AddDynamic(i, boxes[i].x, boxes[i].y, boxes[i].w,
+                             boxes[i].h);
+    }
+    const double t1 = Platform_GetTime();
+    uint64_t found = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      found += static_cast<uint64_t>(SpatialHash_QueryDynamic(
+          boxes[i].x - GRID_BENCH_QUERY_MARGIN,
+          boxes[i].y - GRID_BENCH_QUERY_MARGIN,
+          boxes[i].w + 2 * GRID_BENCH_QUERY_MARGIN,
+          boxes[i].h + 2 * GRID_BENCH_QUERY_MARGIN, results,
+          GRID_BENCH_MAX_RESULTS));
+    }
+    res.buildUs += (t1 - t0) * 1e6;
+    res.queryUs += (Platform_GetTime() - t1) * 1e6;
+    res.found = found;
+  }
+  res.buildUs /= rounds;
+  res.queryUs /= static_cast<double>(rounds) * count;
+  return res;
+}
+
+static GridBenchResult GridBench_RunSparse(const GridBenchBox *boxes,
+                                           uint32_t count, uint32_t rounds,
+                                           uint32_t *results) {
+  GridBenchResult res = {.buildUs = 0.0, .queryUs = 0.0, .found = 0};
+  for (uint32_t r = 0; r < rounds; r++) {
+    const double t0 = Platform_GetTime();
+    SparseGrid_Clear();
+    for (uint32_t i = 0; i < count; i++) {
+      SparseGrid_Add(i, boxes[i].x, boxes[i].y, boxes[i].w, boxes[i].h);
+    }
+    const double t1 = Platform_GetTime();
+    uint64_t found = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      found += static_cast<uint64_t>(SparseGrid_Query(
+          boxes[i].x - GRID_BENCH_QUERY_MARGIN,
+          boxes[i].y - GRID_BENCH_QUERY_MARGIN,
+          boxes[i].w + 2 * GRID_BENCH_QUERY_MARGIN,
+          boxes[i].h + 2 * GRID_BENCH_QUERY_MARGIN, results,
+          GRID_BENCH_MAX_RESULTS));
+    }
+    res.buildUs += (t1 - t0) * 1e6;
+    res.queryUs += (Platform_GetTime() - t1) * 1e6;
+    res.found = found;
+  }
+  res.buildUs /= rounds;
+  res.queryUs /= static_cast<double>(rounds) * count;
+  return res;
+}
+
+static void RunGridBench(const ServerOptions &opt) {
+  const uint32_t count = std::min<uint32_t>(opt.entities, MAX_ENTITIES);
+  GridBenchBox *boxes =
+      static_cast<GridBenchBox *>(malloc(sizeof(GridBenchBox) * count));
+  uint32_t *results = static_cast<uint32_t *>(
+      malloc(sizeof(uint32_t) * GRID_BENCH_MAX_RESULTS));
+  if (!boxes || !results) {
+    Log(LogLevel::Error, "[GRID] Out of memory for {} boxes", count);
+    free(boxes);
+    free(results);
+    return;
+  }
+
+  Log(LogLevel::Info,
+      "[GRID] {} boxes (16-64 px) | {}x{} px world | {} rounds", count,
+      GRID_BENCH_WORLD, GRID_BENCH_WORLD, opt.ticks);
+
+  for (int scenario = 0; scenario < 2; scenario++) {
+    const bool clustered = (scenario == 1);
+    int32_t centerX[GRID_BENCH_CLUSTERS];
+    int32_t centerY[GRID_BENCH_CLUSTERS];
+    for (int32_t c = 0; c < GRID_BENCH_CLUSTERS; c++) {
+      centerX[c] = Random_Range(GRID_BENCH_CLUSTER_RADIUS,
+                                GRID_BENCH_WORLD - GRID_BENCH_CLUSTER_RADIUS);
+      centerY[c] = Random_Range(GRID_BENCH_CLUSTER_RADIUS,
+                                GRID_BENCH_WORLD - GRID_BENCH_CLUSTER_RADIUS);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      GridBenchBox &box = boxes[i];
+      box.w = Random_Range(16, 64);
+      box.h = Random_Range(16, 64);
+      if (clustered) {
+        const int32_t c = static_cast<int32_t>(i % GRID_BENCH_CLUSTERS);
+        box.x = centerX[c] + Random_Range(-GRID_BENCH_CLUSTER_RADIUS,
+                                          GRID_BENCH_CLUSTER_RADIUS);
+        box.y = centerY[c] + Random_Range(-GRID_BENCH_CLUSTER_RADIUS,
+                                          GRID_BENCH_CLUSTER_RADIUS);
+      } else {
+        box.x = Random_Range(0, GRID_BENCH_WORLD - box.w);
+        box.y = Random_Range(0, GRID_BENCH_WORLD - box.h);
+      }
+    }
+
+    const GridBenchResult hash =
+        GridBench_RunHash(boxes, count, opt.ticks, results);
+    const SpatialHashStats hashStats = SpatialHash_GetStats();
+    const GridBenchResult sparse =
+        GridBench_RunSparse(boxes, count, opt.ticks, results);
+    const SparseGridStats sparseStats = SparseGrid_GetStats();
+
+    const char *name = clustered ? "clustered" : "uniform";
+    Log(LogLevel::Info,
+        "[GRID] {:9} hash   | build {:7.1f} us | query {:.3f} us | "
+        "{} nodes ({} overflowed) | chain max {} avg {:.2f} | "
+        "{} aliased buckets",
+        name, hash.buildUs, hash.queryUs, hashStats.nodes,
+        hashStats.overflowBodies, hashStats.maxChain,
+        static_cast<double>(hashStats.avgChain), hashStats.collidedBuckets);
+    Log(LogLevel::Info,
+        "[GRID] {:9} sparse | build {:7.1f} us | query {:.3f} us | "
+        "{} cells {} ids ({} dropped) | probe max {} | {} overflow blocks",
+        name, sparse.buildUs, sparse.queryUs, sparseStats.cells,
+        sparseStats.ids, sparseStats.dropped, sparseStats.maxProbe,
+        sparseStats.overflowUsed);
+    if (hash.found != sparse.found) {
+      Log(LogLevel::Warning,
+          "[GRID] {} results differ: hash {} vs sparse {} (dropped inserts?)",
+          name, hash.found, sparse.found);
+    }
+  }
+
+  SpatialHash_ClearDynamic();
+  SparseGrid_Clear();
+  free(results);
+  free(boxes);
+}
+
+/**
+ * @brief Reference: each child recomputes its whole chain from the root
+ * (what callers do without a hierarchy pass). Same math as the system.
+ */
+static void HierarchyBench_WorldOf(const EntityRegistry &reg, uint32_t id,
+                                   creVec2 *pos, float *rot, creVec2 *scale) {
+  if (!(reg.component_masks[id] & COMP_HIERARCHY)) {
+    *pos = reg.pos[id];
+    *rot = reg.rotation[id];
+    *scale = reg.visual_scale[id];
+    return;
+  }
+  creVec2 parentPos;
+  float parentRot;
+  creVec2 parentScale;
+  HierarchyBench_WorldOf(reg, reg.parents[id].id, &parentPos, &parentRot,
+                         &parentScale);
+  const float rad = parentRot * (3.14159265f / 180.0f);
+  const float s = sinf(rad);
+  const float c = cosf(rad);
+  const float ox = reg.local_pos[id].x * parentScale.x;
+  const float oy = reg.local_pos[id].y * parentScale.y;
+  *pos = creVec2{parentPos.x + ox * c - oy * s, parentPos.y + ox * s + oy * c};
+  *rot = parentRot + reg.local_rotation[id];
+  *scale = creVec2{parentScale.x * reg.local_scale[id].x,
+                   parentScale.y * reg.local_scale[id].y};
+}
+
+static void HierarchyBench_Naive(EntityRegistry &reg) {
+  for (uint32_t i = 0; i < reg.max_used_bound; i++) {
+    if (!(reg.component_masks[i] & COMP_HIERARCHY))
+      continue;
+    HierarchyBench_WorldOf(reg, i, &reg.pos[i], &reg.rotation[i],
+                           &reg.visual_scale[i]);
+  }
+}
+
+static void RunHierarchyBench(EngineContext &ctx, const ServerOptions &opt) {
+  EntityRegistry &reg = *ctx.reg;
+  const uint32_t children = opt.entities;
+  const uint32_t roots = (children + HIERARCHY_BENCH_FANOUT - 1) /
+                         HIERARCHY_BENCH_FANOUT;
+  if (roots + children > reg.free_count) {
+    Log(LogLevel::Error, "[XFORM] {} roots + {} children do not fit", roots,
+        children);
+    return;
+  }
+
+  // Roots first, then children: half under a root, half under a child
+  Entity *created =
+      static_cast<Entity *>(malloc(sizeof(Entity) * (roots + children)));
+  creVec2 *expected =
+      static_cast<creVec2 *>(malloc(sizeof(creVec2) * MAX_ENTITIES));
+  if (!created || !expected) {
+    Log(LogLevel::Error, "[XFORM] Out of memory");
+    free(created);
+    free(expected);
+    return;
+  }
+  for (uint32_t i = 0; i < roots; i++) {
+    const creVec2 pos = {static_cast<float>(Random_Range(0, 4000)),
+                         static_cast<float>(Random_Range(0, 4000))};
+    created[i] =
+        EntityManager_Create(reg, 0, pos, COMP_SPRITE, FLAG_ACTIVE);
+  }
+  const uint32_t firstLevel = (children + 1) / 2;
+  for (uint32_t k = 0; k < children; k++) {
+    const uint32_t first = (k < firstLevel) ? 0u : roots;
+    const uint32_t upTo = (k < firstLevel) ? roots : roots + firstLevel;
+    const Entity parent = created[static_cast<uint32_t>(Random_Range(
+        static_cast<int32_t>(first), static_cast<int32_t>(upTo) - 1))];
+    const Entity child = EntityManager_Create(
+        reg, 0, creVec2{0.0f, 0.0f}, COMP_SPRITE | COMP_HIERARCHY,
+        FLAG_ACTIVE);
+    reg.parents[child.id] = parent;
+    reg.local_pos[child.id] =
+        creVec2{static_cast<float>(Random_Range(-64, 64)),
+                static_cast<float>(Random_Range(-64, 64))};
+    reg.local_rotation[child.id] = static_cast<float>(Random_Range(0, 359));
+    reg.local_scale[child.id] = creVec2{0.5f, 0.5f};
+    created[roots + k] = child;
+  }
+
+  transformPacket pkt = CreateTransformPacket(ctx.reg, ctx.bus);
+  const uint32_t rounds = opt.ticks;
+  double rebuildUs = 0.0;
+  double updateUs = 0.0;
+  double naiveUs = 0.0;
+  float maxError = 0.0f;
+
+  for (uint32_t r = 0; r < rounds; r++) {
+    // Roots move and spin every round
+    for (uint32_t i = 0; i < roots; i++) {
+      reg.pos[created[i].id].x += 1.0f;
+      reg.rotation[created[i].id] += 3.0f;
+    }
+
+    const double t0 = Platform_GetTime();
+    TransformSystem_Invalidate();
+    TransformSystem_Update(&pkt);
+    const double t1 = Platform_GetTime();
+    TransformSystem_Update(&pkt);
+    const double t2 = Platform_GetTime();
+    for (uint32_t k = 0; k < children; k++) {
+      expected[k] = reg.pos[created[roots + k].id];
+    }
+    const double t3 = Platform_GetTime();
+    HierarchyBench_Naive(reg);
+    const double t4 = Platform_GetTime();
+
+    for (uint32_t k = 0; k < children; k++) {
+      const creVec2 p = reg.pos[created[roots + k].id];
+      maxError = std::max(maxError, fabsf(p.x - expected[k].x));
+      maxError = std::max(maxError, fabsf(p.y - expected[k].y));
+    }
+    rebuildUs += (t1 - t0) * 1e6;
+    updateUs += (t2 - t1) * 1e6;
+    naiveUs += (t4 - t3) * 1e6;
+  }
+
+  const double n = static_cast<double>(rounds);
+  const double perChild = 1000.0 / static_cast<double>(children);
+  const TransformStats stats = TransformSystem_GetStats();
+  Log(LogLevel::Info,
+      "[XFORM] {} roots | {} children in {} levels | {} rounds", roots,
+      stats.children, stats.levels, rounds);
+  Log(LogLevel::Info,
+      "[XFORM] depth-sorted {:.1f} us ({:.1f} ns/child) | rebuild+update "
+      "{:.1f} us | per-child walk {:.1f} us ({:.1f} ns/child)",
+      updateUs / n, updateUs / n * perChild, rebuildUs / n, naiveUs / n,
+      naiveUs / n * perChild);
+  Log(LogLevel::Info, "[XFORM] max difference {:.5f} px",
+      static_cast<double>(maxError));
+
+  free(expected);
+  free(created);
+}
+
+/**
+ * @brief Reference: one list of records, easing and target picked by a
+ * switch per tween, finished records swap-removed (a plain AoS tween list).
+ */
+struct TweenBenchRecord {
+  Entity entity;
+  uint8_t target;
+  uint8_t ease;
+  float t;
+  float rate;
+  float from[4];
+  float to[4];
+};
+
+static float TweenBench_Ease(uint8_t ease, float t) {
+  const float u = std::min(std::max(t, 0.0f), 1.0f);
+  const float v = 1.0f - u;
+  switch (ease) {
+  case TWEEN_EASE_IN_QUAD:
+    return u * u;
+  case TWEEN_EASE_OUT_QUAD:
+    return u * (2.0f - u);
+  case TWEEN_EASE_IN_OUT_QUAD:
+    return (u < 0.5f) ? 2.0f * u * u : 1.0f - 2.0f * v * v;
+  case TWEEN_EASE_OUT_CUBIC:
+    return 1.0f - v * v * v;
+  case TWEEN_EASE_OUT_BACK:
+    return 1.0f - 2.70158f * v * v * v + 1.70158f * v * v;
+  case TWEEN_EASE_SHAKE:
+    return sinf(u * 2.0f * 3.14159265f * TWEEN_SHAKE_CYCLES) * v;
+  default:
+    return u;
+  }
+}
+
+static uint8_t TweenBench_Channel(float v) {
+  return static_cast<uint8_t>(std::min(std::max(v, 0.0f), 255.0f) + 0.5f);
+}
+
+/**
+ * @brief Advance every record; finished ones are moved to done.
+ * @return Number of finished records
+ */
+static uint32_t TweenBench_UpdateRecords(EntityRegistry &reg,
+                                         TweenBenchRecord *records,
+                                         uint32_t *count, float dt,
+                                         TweenBenchRecord *done) {
+  uint32_t doneCount = 0;
+  for (uint32_t i = 0; i < *count;) {
+    TweenBenchRecord &r = records[i];
+    if (!EntityRegistry_IsAlive(reg, r.entity)) {
+      r = records[--*count];
+      continue;
+    }
+    r.t += dt * r.rate;
+    const float e = TweenBench_Ease(r.ease, r.t);
+    float v[4];
+    for (uint32_t c = 0; c < 4; c++) {
+      v[c] = r.from[c] + (r.to[c] - r.from[c]) * e;
+    }
+    const uint32_t id = r.entity.id;
+    switch (r.target) {
+    case TWEEN_TARGET_POS:
+      reg.pos[id] = creVec2{v[0], v[1]};
+      break;
+    case TWEEN_TARGET_ROTATION:
+      reg.rotation[id] = v[0];
+      break;
+    case TWEEN_TARGET_SCALE:
+      reg.visual_scale[id] = creVec2{v[0], v[1]};
+      break;
+    default:
+      reg.colors[id] =
+          creColor{TweenBench_Channel(v[0]), TweenBench_Channel(v[1]),
+                   TweenBench_Channel(v[2]), TweenBench_Channel(v[3])};
+      break;
+    }
+    if (r.t >= 1.0f) {
+      done[doneCount++] = r;
+      r = records[--*count];
+      continue;
+    }
+    i++;
+  }
+  return doneCount;
+}
+
+static TweenDesc TweenBench_Desc(Entity entity, uint32_t k) {
+  const TweenTarget target =
+      static_cast<TweenTarget>(k % TWEEN_BENCH_TARGETS);
+  const float to = static_cast<float>(Random_Range(0, 255));
+  return TweenDesc{
+      .entity = entity,
+      .target = target,
+      .ease = static_cast<TweenEase>((k / TWEEN_BENCH_TARGETS) %
+                                     TWEEN_EASE_COUNT),
+      .tag = static_cast<uint16_t>(k % TWEEN_BENCH_TARGETS),
+      .duration = static_cast<float>(Random_Range(500, 2000)) * 0.001f,
+      .delay = 0.0f,
+      .from = {0.0f, 0.0f, 0.0f, 255.0f},
+      .to = {to, to, to, to},
+      .fromCurrent = false};
+}
+
+static TweenBenchRecord TweenBench_Record(const TweenDesc &desc) {
+  return TweenBenchRecord{
+      .entity = desc.entity,
+      .target = desc.target,
+      .ease = desc.ease,
+      .t = 0.0f,
+      .rate = 1.0f / desc.duration,
+      .from = {desc.from[0], desc.from[1], desc.from[2], desc.from[3]},
+      .to = {desc.to[0], desc.to[1], desc.to[2], desc.to[3]}};
+}
+
+static void RunTweenBench(EngineContext &ctx, const ServerOptions &opt) {
+  EntityRegistry &reg = *ctx.reg;
+  const uint32_t tweens = std::min<uint32_t>(
+      opt.entities, TWEEN_POOL_CAPACITY * TWEEN_EASE_COUNT);
+  const uint32_t entities =
+      (tweens + TWEEN_BENCH_TARGETS - 1) / TWEEN_BENCH_TARGETS;
+  if (entities > reg.free_count) {
+    Log(LogLevel::Error, "[TWEEN] {} entities do not fit", entities);
+    return;
+  }
+
+  Entity *created = static_cast<Entity *>(malloc(sizeof(Entity) * entities));
+  TweenBenchRecord *records = static_cast<TweenBenchRecord *>(
+      malloc(sizeof(TweenBenchRecord) * tweens * 2));
+  if (!created || !records) {
+    Log(LogLevel::Error, "[TWEEN] Out of memory");
+    free(created);
+    free(records);
+    return;
+  }
+  TweenBenchRecord *done = records + tweens;
+  for (uint32_t i = 0; i < entities; i++) {
+    created[i] = EntityManager_Create(reg, 0, creVec2{0.0f, 0.0f},
+                                      COMP_SPRITE, FLAG_ACTIVE);
+  }
+  // Entity k / 4 gets one tween per target (entity ids start at 0 here)
+  uint32_t started = 0;
+  uint32_t recordCount = 0;
+  for (uint32_t k = 0; k < tweens; k++) {
+    const TweenDesc desc = TweenBench_Desc(created[k / TWEEN_BENCH_TARGETS], k);
+    started += ENTITY_IS_VALID(desc.entity) &&
+               TweenSystem_Start(reg, desc).index != TWEEN_INVALID.index;
+    records[recordCount++] = TweenBench_Record(desc);
+  }
+
+  tweenPacket pkt = CreateTweenPacket(ctx.reg, ctx.time.fixedDt);
+  double updateUs = 0.0;
+  double restartUs = 0.0;
+  double recordUs = 0.0;
+  uint64_t completed = 0;
+  for (uint32_t frame = 0; frame < opt.ticks; frame++) {
+    const double t0 = Platform_GetTime();
+    TweenSystem_Update(&pkt);
+    const double t1 = Platform_GetTime();
+
+    // Keep the population constant: restart whatever finished
+    uint32_t eventCount = 0;
+    const TweenEvent *events = TweenSystem_GetEvents(&eventCount);
+    for (uint32_t i = 0; i < eventCount; i++) {
+      const uint32_t k =
+          events[i].entity.id * TWEEN_BENCH_TARGETS + events[i].tag;
+      TweenSystem_Start(reg, TweenBench_Desc(events[i].entity, k));
+    }
+    completed += eventCount;
+    const double t2 = Platform_GetTime();
+    const uint32_t doneCount = TweenBench_UpdateRecords(
+        reg, records, &recordCount, ctx.time.fixedDt, done);
+    const double t3 = Platform_GetTime();
+    for (uint32_t i = 0; i < doneCount; i++) {
+      const uint32_t k = done[i].entity.id * TWEEN_BENCH_TARGETS +
+                         done[i].target;
+      records[recordCount++] =
+          TweenBench_Record(TweenBench_Desc(done[i].entity, k));
+    }
+
+    updateUs += (t1 - t0) * 1e6;
+    restartUs += (t2 - t1) * 1e6;
+    recordUs += (t3 - t2) * 1e6;
+  }
+
+  const double n = static_cast<double>(opt.ticks);
+  const double perTween = 1000.0 / static_cast<double>(started);
+  Log(LogLevel::Info,
+      "[TWEEN] {} tweens on {} entities | {} frames | {:.0f} completions "
+      "per frame",
+      started, entities, opt.ticks, static_cast<double>(completed) / n);
+  Log(LogLevel::Info,
+      "[TWEEN] pooled {:.1f} us ({:.2f} ns/tween) + restarts {:.1f} us | "
+      "per-tween switch {:.1f} us ({:.2f} ns/tween)",
+      updateUs / n, updateUs / n * perTween, restartUs / n, recordUs / n,
+      recordUs / n * perTween);
+
+  free(records);
+  free(created);
+}
+
+/**
+ * @brief 70% within 10 s, 25% within 10 min, 5% within 4 h (ticks).
+ */
+static uint32_t TimerBench_Delay(void) {
+  const int32_t roll = Random_Range(0, 99);
+  const int32_t delay = (roll < 70)   ? Random_Range(1, 600)
+                        : (roll < 95) ? Random_Range(600, 36000)
+                                      : Random_Range(36000, 864000);
+  return static_cast<uint32_t>(delay);
+}
+
+/**
+ * @brief Schedule timer `slot`. The command carries the slot, and the due
+ * tick of one-shots so the drain can check it fired on time.
+ */
+static TimerID TimerBench_Schedule(uint32_t slot, uint32_t now) {
+  const uint32_t delay = TimerBench_Delay();
+  const bool periodic = Random_Range(0, 9) == 0;
+  const Command cmd = {
+      .type = CMD_NONE,
+      .entity = Entity{.id = slot, .generation = 0},
+      .u64 = {.value = periodic ? UINT64_MAX
+                                : static_cast<uint64_t>(now) + delay},
+  };
+  return TimerSystem_Schedule(
+      cmd, delay,
+      periodic ? static_cast<uint32_t>(Random_Range(30, 600)) : 0);
+}
+
+/**
+ * @brief Reference: one countdown per timer, every timer visited per tick
+ * (what a scan over custom timer arrays does).
+ */
+struct TimerBenchCountdown {
+  uint32_t remaining;
+  uint32_t period;
+  Command cmd;
+};
+
+static void RunTimerBench(const ServerOptions &opt) {
+  const uint32_t count = opt.entities;
+  Arena arena = arena_AllocateMemory(TimerSystem_MemorySize(count) +
+                                     sizeof(CommandBus) + 256);
+  TimerID *handles =
+      static_cast<TimerID *>(malloc(sizeof(TimerID) * count));
+  uint32_t *churn =
+      static_cast<uint32_t *>(malloc(sizeof(uint32_t) * TIMER_BENCH_CHURN));
+  TimerBenchCountdown *countdowns = static_cast<TimerBenchCountdown *>(
+      malloc(sizeof(TimerBenchCountdown) * count));
+  if (!arena.base_ptr || !handles || !churn || !countdowns) {
+    Log(LogLevel::Error, "[TIMER] Out of memory for {} timers", count);
+    arena_FreeMemory(&arena);
+    free(handles);
+    free(churn);
+    free(countdowns);
+    return;
+  }
+  CommandBus *bus = arena_Push<CommandBus>(&arena);
+  CommandBus_Init(*bus);
+  if (!TimerSystem_Init(&arena, count)) {
+    arena_FreeMemory(&arena);
+    free(handles);
+    free(churn);
+    free(countdowns);
+    return;
+  }
+
+  const double s0 = Platform_GetTime();
+  for (uint32_t i = 0; i < count; i++) {
+    handles[i] = TimerBench_Schedule(i, 0);
+  }
+  const double fillNs = (Platform_GetTime() - s0) * 1e9;
+
+  double advanceUs = 0.0;
+  double maxAdvanceUs = 0.0;
+  double cancelNs = 0.0;
+  double scheduleNs = 0.0;
+  uint64_t fired = 0;
+  uint64_t cascaded = 0;
+  uint64_t mistimed = 0;
+  for (uint32_t tick = 1; tick <= opt.ticks; tick++) {
+    // Churn: cancel random timers, then schedule them again
+    for (uint32_t k = 0; k < TIMER_BENCH_CHURN; k++) {
+      churn[k] = static_cast<uint32_t>(
+          Random_Range(0, static_cast<int32_t>(count) - 1));
+    }
+    const double t0 = Platform_GetTime();
+    for (uint32_t k = 0; k < TIMER_BENCH_CHURN; k++) {
+      TimerSystem_Cancel(handles[churn[k]]);
+    }
+    const double t1 = Platform_GetTime();
+    for (uint32_t k = 0; k < TIMER_BENCH_CHURN; k++) {
+      if (!TimerSystem_IsPending(handles[churn[k]]))
+        handles[churn[k]] = TimerBench_Schedule(churn[k], tick - 1);
+    }
+    const double t2 = Platform_GetTime();
+    TimerSystem_Advance(*bus);
+    const double t3 = Platform_GetTime();
+
+    cancelNs += (t1 - t0) * 1e9;
+    scheduleNs += (t2 - t1) * 1e9;
+    advanceUs += (t3 - t2) * 1e6;
+    maxAdvanceUs = std::max(maxAdvanceUs, (t3 - t2) * 1e6);
+    const TimerStats stats = TimerSystem_GetStats();
+    fired += stats.fired;
+    cascaded += stats.cascaded;
+
+    // Drain: check due ticks, refill fired one-shots
+    CommandIterator iter = CommandBus_GetIterator(*bus);
+    const Command *cmd;
+    while (CommandBus_Next(*bus, &iter, &cmd)) {
+      if (cmd->u64.value == UINT64_MAX)
+        continue;
+      mistimed += (cmd->u64.value != tick);
+      handles[cmd->entity.id] = TimerBench_Schedule(cmd->entity.id, tick);
+    }
+    CommandBus_Clear(*bus);
+  }
+  const TimerStats stats = TimerSystem_GetStats();
+
+  // Reference: same population, countdowns scanned every tick
+  for (uint32_t i = 0; i < count; i++) {
+    const bool periodic = Random_Range(0, 9) == 0;
+    countdowns[i] = TimerBenchCountdown{
+        .remaining = TimerBench_Delay(),
+        .period =
+            periodic ? static_cast<uint32_t>(Random_Range(30, 600)) : 0,
+        .cmd = Command{.type = CMD_NONE,
+                       .entity = Entity{.id = i, .generation = 0},
+                       .u64 = {}}};
+  }
+  double scanUs = 0.0;
+  for (uint32_t tick = 1; tick <= opt.ticks; tick++) {
+    const double t0 = Platform_GetTime();
+    for (uint32_t i = 0; i < count; i++) {
+      TimerBenchCountdown &c = countdowns[i];
+      if (--c.remaining != 0)
+        continue;
+      CommandBus_Push(*bus, c.cmd);
+      c.remaining = (c.period > 0) ? c.period : TimerBench_Delay();
+    }
+    scanUs += (Platform_GetTime() - t0) * 1e6;
+    CommandBus_Clear(*bus);
+  }
+
+  const double n = static_cast<double>(opt.ticks);
+  const double ops = n * TIMER_BENCH_CHURN;
+  Log(LogLevel::Info,
+      "[TIMER] {} pending ({} KB) | {} ticks | {:.0f} fired/tick | "
+      "{:.0f} cascaded/tick | mistimed {} | dropped {}",
+      stats.pending, TimerSystem_MemorySize(count) / 1024, opt.ticks,
+      static_cast<double>(fired) / n, static_cast<double>(cascaded) / n,
+      mistimed, stats.dropped);
+  Log(LogLevel::Info,
+      "[TIMER] wheel: advance {:.2f} us/tick (max {:.1f}) | schedule "
+      "{:.1f} ns | cancel {:.1f} ns | fill {:.1f} ns/timer",
+      advanceUs / n, maxAdvanceUs, scheduleNs / ops, cancelNs / ops,
+      fillNs / static_cast<double>(count));
+  Log(LogLevel::Info, "[TIMER] per-tick countdown scan: {:.1f} us/tick",
+      scanUs / n);
+
+  arena_FreeMemory(&arena);
+  free(handles);
+  free(churn);
+  free(countdowns);
+}
+
+/**
+ * @brief Entity k gets DestroyAfter(k + 1 ticks) and runs through full
+ * engine ticks (one fixed step each): it must be alive on tick k and dead on
+ * tick k + 1.
+ */
+static void RunTimerCheck(EngineContext &ctx) {
+  EntityRegistry &reg = *ctx.reg;
+  Entity created[TIMER_CHECK_ENTITIES];
+  const float step = static_cast<float>(FIXED_STEP_US) * 1e-6f;
+  for (uint32_t k = 0; k < TIMER_CHECK_ENTITIES; k++) {
+    created[k] = EntityManager_Create(reg, 0, creVec2{0.0f, 0.0f}, COMP_NONE,
+                                      FLAG_ACTIVE);
+    timerAPI_DestroyAfter(created[k], static_cast<float>(k + 1) * step);
+  }
+
+  uint32_t early = 0;
+  uint32_t late = 0;
+  for (uint32_t tick = 1; tick <= TIMER_CHECK_ENTITIES + 1; tick++) {
+    EngineHeadless_Tick(ctx);
+    for (uint32_t k = 0; k < TIMER_CHECK_ENTITIES; k++) {
+      const bool alive = EntityRegistry_IsAlive(reg, created[k]);
+      early += (!alive && tick <= k);
+      late += (alive && tick > k);
+    }
+  }
+  Log((early == 0 && late == 0) ? LogLevel::Info : LogLevel::Error,
+      "[TIMER] DestroyAfter through the engine tick: {} entities | {} "
+      "entity-ticks dead early | {} alive late",
+      TIMER_CHECK_ENTITIES, early, late);
+}
+
+/**
+ * @brief What a renderer backend does with the draw list: 4 vertices per
+ * quad, offset by the widget origin.
+ */
+struct UIBenchVertex {
+  float x;
+  float y;
+  float u;
+  float v;
+  creColor color;
+};
+
+static uint32_t UIBench_Submit(UIBenchVertex *sink) {
+  uint32_t count = 0;
+  const UIDrawCmd *list = UISystem_GetDrawList(&count);
+  uint32_t n = 0;
+  for (uint32_t d = 0; d < count; d++) {
+    const UIDrawCmd &cmd = list[d];
+    for (uint32_t q = 0; q < cmd.count; q++) {
+      const UIQuad &quad = cmd.quads[q];
+      const float x0 = cmd.origin.x + quad.dest.x;
+      const float y0 = cmd.origin.y + quad.dest.y;
+      const float x1 = x0 + quad.dest.width;
+      const float y1 = y0 + quad.dest.height;
+      const float u0 = static_cast<float>(quad.srcX);
+      const float v0 = static_cast<float>(quad.srcY);
+      const float u1 = u0 + static_cast<float>(quad.srcW);
+      const float v1 = v0 + static_cast<float>(quad.srcH);
+      sink[n++] = UIBenchVertex{x0, y0, u0, v0, quad.color};
+      sink[n++] = UIBenchVertex{x0, y1, u0, v1, quad.color};
+      sink[n++] = UIBenchVertex{x1, y1, u1, v1, quad.color};
+      sink[n++] = UIBenchVertex{x1, y0, u1, v0, quad.color};
+    }
+  }
+  return n;
+}
+
+static UIStyle UIBench_Style(UISize width, UISize height, UIDirection dir,
+                             float padding, float gap, creColor background) {
+  return UIStyle{.width = width,
+                 .height = height,
+                 .direction = dir,
+                 .justify = UI_JUSTIFY_START,
+                 .align = UI_ALIGN_CENTER,
+                 .padding = padding,
+                 .gap = gap,
+                 .background = background};
+}
+
+static void RunUIBench(const ServerOptions &opt) {
+  static constexpr uint32_t SLOTS = UI_BENCH_ROWS * UI_BENCH_COLUMNS;
+  static constexpr UISize FIT = {.mode = UI_SIZE_FIT, .value = 0.0f};
+  static constexpr UISize GROW = {.mode = UI_SIZE_GROW, .value = 1.0f};
+  static constexpr UISize SLOT = {.mode = UI_SIZE_FIXED, .value = 64.0f};
+  static constexpr UISize ICON = {.mode = UI_SIZE_FIXED, .value = 36.0f};
+  static constexpr creColor WHITE = {255, 255, 255, 255};
+  static constexpr creColor GOLD = {255, 203, 0, 255};
+
+  UIWidgetID *counts =
+      static_cast<UIWidgetID *>(malloc(sizeof(UIWidgetID) * SLOTS));
+  uint32_t *amounts =
+      static_cast<uint32_t *>(malloc(sizeof(uint32_t) * SLOTS));
+  creRectangle *rects = static_cast<creRectangle *>(
+      malloc(sizeof(creRectangle) * UI_MAX_WIDGETS));
+  UIWidgetID *widgets =
+      static_cast<UIWidgetID *>(malloc(sizeof(UIWidgetID) * UI_MAX_WIDGETS));
+  UIBenchVertex *sink = static_cast<UIBenchVertex *>(
+      malloc(sizeof(UIBenchVertex) * 4 * UI_MAX_WIDGETS * UI_TEXT_LENGTH));
+  if (!counts || !amounts || !rects || !widgets || !sink) {
+    Log(LogLevel::Error, "[UI] Out of memory for the inventory screen");
+    free(counts);
+    free(amounts);
+    free(rects);
+    free(widgets);
+    free(sink);
+    return;
+  }
+
+  // Inventory: header (title, gold) over a grid of slots (icon + count)
+  UISystem_Init();
+  uint32_t widgetCount = 0;
+  const UIWidgetID root = UISystem_GetRoot();
+  UISystem_SetStyle(root, UIBench_Style(FIT, FIT, UI_DIR_COLUMN, 16.0f, 8.0f,
+                                        creColor{20, 20, 28, 255}));
+  UIStyle headerStyle = UIBench_Style(GROW, FIT, UI_DIR_ROW, 4.0f, 0.0f,
+                                      creColor{40, 40, 56, 255});
+  headerStyle.justify = UI_JUSTIFY_SPACE_BETWEEN;
+  const UIWidgetID header = UISystem_Create(root, headerStyle);
+  const UIStyle labelStyle =
+      UIBench_Style(FIT, FIT, UI_DIR_ROW, 0.0f, 0.0f, creColor{0, 0, 0, 0});
+  const UIWidgetID title = UISystem_Create(header, labelStyle);
+  const UIWidgetID gold = UISystem_Create(header, labelStyle);
+  UISystem_SetText(title, "INVENTORY", 30, WHITE);
+  widgets[widgetCount++] = header;
+  widgets[widgetCount++] = title;
+  widgets[widgetCount++] = gold;
+
+  const UIWidgetID grid = UISystem_Create(
+      root, UIBench_Style(FIT, FIT, UI_DIR_COLUMN, 0.0f, 4.0f,
+                          creColor{0, 0, 0, 0}));
+  widgets[widgetCount++] = grid;
+  UIStyle slotStyle = UIBench_Style(SLOT, SLOT, UI_DIR_COLUMN, 4.0f, 2.0f,
+                                    creColor{60, 60, 80, 255});
+  slotStyle.justify = UI_JUSTIFY_CENTER;
+  const UIStyle iconStyle =
+      UIBench_Style(ICON, ICON, UI_DIR_ROW, 0.0f, 0.0f, creColor{0, 0, 0, 0});
+  for (uint32_t r = 0; r < UI_BENCH_ROWS; r++) {
+    const UIWidgetID row = UISystem_Create(
+        grid, UIBench_Style(FIT, FIT, UI_DIR_ROW, 0.0f, 4.0f,
+                            creColor{0, 0, 0, 0}));
+    widgets[widgetCount++] = row;
+    for (uint32_t c = 0; c < UI_BENCH_COLUMNS; c++) {
+      const uint32_t s = r * UI_BENCH_COLUMNS + c;
+      const UIWidgetID slot = UISystem_Create(row, slotStyle);
+      const UIWidgetID icon = UISystem_Create(slot, iconStyle);
+      counts[s] = UISystem_Create(slot, labelStyle);
+      amounts[s] = static_cast<uint32_t>(Random_Range(1, 99));
+      UISystem_SetSprite(icon, s % SPRITE_COUNT, WHITE);
+      UISystem_SetTextF(counts[s], 10, WHITE, "x%u", amounts[s]);
+      widgets[widgetCount++] = slot;
+      widgets[widgetCount++] = icon;
+      widgets[widgetCount++] = counts[s];
+    }
+  }
+  uint32_t goldAmount = 1000;
+  UISystem_SetTextF(gold, 20, GOLD, "%u G", goldAmount);
+  UISystem_Update(UI_BENCH_SCREEN_W, UI_BENCH_SCREEN_H);
+
+  double layoutUs = 0.0;
+  double maxLayoutUs = 0.0;
+  double drawUs = 0.0;
+  double fullUs = 0.0;
+  uint64_t measured = 0;
+  uint64_t arranged = 0;
+  uint64_t rebuilt = 0;
+  uint64_t vertices = 0;
+  uint32_t mismatches = 0;
+  for (uint32_t frame = 0; frame < opt.ticks; frame++) {
+    // Game side: a few stacks change, gold ticks up every frame
+    for (uint32_t k = 0; k < UI_BENCH_CHANGES; k++) {
+      const uint32_t s = static_cast<uint32_t>(
+          Random_Range(0, static_cast<int32_t>(SLOTS) - 1));
+      amounts[s] = (amounts[s] % 999) + 1;
+      UISystem_SetTextF(counts[s], 10, WHITE, "x%u", amounts[s]);
+    }
+    goldAmount += static_cast<uint32_t>(Random_Range(0, 3));
+    UISystem_SetTextF(gold, 20, GOLD, "%u G", goldAmount);
+
+    const double t0 = Platform_GetTime();
+    UISystem_Update(UI_BENCH_SCREEN_W, UI_BENCH_SCREEN_H);
+    const double t1 = Platform_GetTime();
+    vertices += UIBench_Submit(sink);
+    const double t2 = Platform_GetTime();
+    layoutUs += (t1 - t0) * 1e6;
+    maxLayoutUs = std::max(maxLayoutUs, (t1 - t0) * 1e6);
+    drawUs += (t2 - t1) * 1e6;
+    const UIStats stats = UISystem_GetStats();
+    measured += stats.measured;
+    arranged += stats.arranged;
+    rebuilt += stats.rebuilt;
+
+    // Reference: everything measured, arranged and rebuilt again
+    for (uint32_t w = 0; w < widgetCount; w++) {
+      rects[w] = UISystem_GetRect(widgets[w]);
+    }
+    const double t3 = Platform_GetTime();
+    UISystem_Invalidate();
+    UISystem_Update(UI_BENCH_SCREEN_W, UI_BENCH_SCREEN_H);
+    fullUs += (Platform_GetTime() - t3) * 1e6;
+    for (uint32_t w = 0; w < widgetCount; w++) {
+      const creRectangle a = rects[w];
+      const creRectangle b = UISystem_GetRect(widgets[w]);
+      mismatches += (a.x != b.x || a.y != b.y || a.width != b.width ||
+                     a.height != b.height);
+    }
+  }
+  const UIStats stats = UISystem_GetStats();
+
+  const double n = static_cast<double>(opt.ticks);
+  Log(LogLevel::Info,
+      "[UI] {} widgets | {} draw cmds | {} quads | {} frames | {} label "
+      "changes/frame | layout mismatches {}",
+      stats.widgets, stats.drawCmds, stats.quads, opt.ticks,
+      UI_BENCH_CHANGES + 1, mismatches);
+  Log(LogLevel::Info,
+      "[UI] incremental: layout {:.2f} us/frame (max {:.1f}) | draw "
+      "{:.2f} us/frame ({:.0f} vertices) | {:.1f} measured, {:.1f} "
+      "arranged, {:.1f} rebuilt/frame",
+      layoutUs / n, maxLayoutUs, drawUs / n,
+      static_cast<double>(vertices) / n, static_cast<double>(measured) / n,
+      static_cast<double>(arranged) / n, static_cast<double>(rebuilt) / n);
+  Log(LogLevel::Info, "[UI] full relayout every frame: {:.2f} us/frame",
+      fullUs / n);
+
+  UISystem_Clear();
+  free(counts);
+  free(amounts);
+  free(rects);
+  free(widgets);
+  free(sink);
+}
+
+/**
+ * @brief Order-dependent hash of every cell of the light map.
+ */
+static uint64_t LightBench_Hash(void) {
+  uint64_t hash = 1469598103934665603ULL;
+  for (int32_t y = 0; y < static_cast<int32_t>(LIGHT_GRID_HEIGHT); y++) {
+    for (int32_t x = 0; x < static_cast<int32_t>(LIGHT_GRID_WIDTH); x++) {
+      const creColor c = LightSystem_GetCell(x, y);
+      hash = (hash ^ ((static_cast<uint64_t>(c.r) << 16) |
+                      (static_cast<uint64_t>(c.g) << 8) | c.b)) *
+             1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+/**
+ * @brief Rooms of `room` cells (light and vision benches): walls every
+ * `room` cells with a doorway in the middle of each wall segment.
+ */
+static bool RoomBench_IsWall(int32_t x, int32_t y, int32_t room) {
+  const bool wall = (x % room == 0) || (y % room == 0);
+  const bool door = (x % room == 0 && y % room == room / 2) ||
+                    (y % room == 0 && x % room == room / 2);
+  return wall && !door;
+}
+
+/**
+ * @brief Door cell k of a square grid of `gridSize` cells: the middle of a
+ * wall segment between two rooms.
+ */
+static void RoomBench_Door(uint32_t k, int32_t gridSize, int32_t room,
+                           int32_t *x, int32_t *y) {
+  const int32_t rooms = gridSize / room;
+  const int32_t index = static_cast<int32_t>(k) % (rooms * rooms);
+  const int32_t rx = (index % rooms) * room;
+  const int32_t ry = (index / rooms) * room;
+  const bool vertical = (k / static_cast<uint32_t>(rooms * rooms)) % 2 == 0;
+  *x = vertical ? rx : rx + room / 2;
+  *y = vertical ? ry + room / 2 : ry;
+}
+
+static void RunLightBench(EngineContext &ctx, const ServerOptions &opt) {
+  EntityRegistry &reg = *ctx.reg;
+  const uint32_t lights = std::min(opt.entities, LIGHT_MAX_LIGHTS);
+  const float worldW = static_cast<float>(LIGHT_GRID_WIDTH) * LIGHT_CELL_SIZE;
+  const float worldH = static_cast<float>(LIGHT_GRID_HEIGHT) * LIGHT_CELL_SIZE;
+  Entity *created = static_cast<Entity *>(malloc(sizeof(Entity) * lights));
+  creVec2 *vel = static_cast<creVec2 *>(malloc(sizeof(creVec2) * lights));
+  creVec2 *samples =
+      static_cast<creVec2 *>(malloc(sizeof(creVec2) * LIGHT_BENCH_SAMPLES));
+  if (!created || !vel || !samples) {
+    Log(LogLevel::Error, "[LIGHT] Out of memory");
+    free(created);
+    free(vel);
+    free(samples);
+    return;
+  }
+
+  // Rooms: walls every LIGHT_BENCH_ROOM cells, one door per wall segment
+  const int32_t w = static_cast<int32_t>(LIGHT_GRID_WIDTH);
+  const int32_t h = static_cast<int32_t>(LIGHT_GRID_HEIGHT);
+  for (int32_t y = 0; y < h; y++) {
+    for (int32_t x = 0; x < w; x++) {
+      if (RoomBench_IsWall(x, y, LIGHT_BENCH_ROOM)) {
+        LightSystem_SetWall(x, y, true);
+      }
+    }
+  }
+
+  for (uint32_t i = 0; i < lights; i++) {
+    const creVec2 pos = {
+        static_cast<float>(Random_Range(0, static_cast<int32_t>(worldW) - 1)),
+        static_cast<float>(Random_Range(0, static_cast<int32_t>(worldH) - 1))};
+    created[i] = EntityManager_Create(reg, 0, pos, COMP_NONE, FLAG_ACTIVE);
+    vel[i] = creVec2{static_cast<float>(Random_Range(-240, 240)) / 60.0f,
+                     static_cast<float>(Random_Range(-240, 240)) / 60.0f};
+    const creColor color = {static_cast<uint8_t>(Random_Range(64, 255)),
+                            static_cast<uint8_t>(Random_Range(64, 255)),
+                            static_cast<uint8_t>(Random_Range(64, 255)), 255};
+    LightSystem_Create(created[i], color,
+                       static_cast<uint32_t>(Random_Range(8, 20)));
+  }
+  LightSystem_SetEnabled(true);
+  LightSystem_Update(reg);
+  const LightStats initial = LightSystem_GetStats();
+
+  double updateUs = 0.0;
+  double maxUpdateUs = 0.0;
+  double fullUs = 0.0;
+  uint64_t floods = 0;
+  uint64_t cells = 0;
+  uint64_t fullCells = 0;
+  uint32_t mismatches = 0;
+  uint32_t doorCursor = 0;
+  for (uint32_t frame = 0; frame < opt.ticks; frame++) {
+    // Lights wander and bounce off the grid edges
+    for (uint32_t i = 0; i < lights; i++) {
+      creVec2 &p = reg.pos[created[i].id];
+      p = p + vel[i];
+      if (p.x < 0.0f || p.x >= worldW) {
+        vel[i].x = -vel[i].x;
+        p.x = std::min(std::max(p.x, 0.0f), worldW - 1.0f);
+      }
+      if (p.y < 0.0f || p.y >= worldH) {
+        vel[i].y = -vel[i].y;
+        p.y = std::min(std::max(p.y, 0.0f), worldH - 1.0f);
+      }
+    }
+
+    const double t0 = Platform_GetTime();
+    for (uint32_t k = 0; k < LIGHT_BENCH_DOORS; k++) {
+      int32_t x;
+      int32_t y;
+      RoomBench_Door(doorCursor++, w, LIGHT_BENCH_ROOM, &x, &y);
+      LightSystem_SetWall(x, y, !LightSystem_IsWall(x, y));
+    }
+    LightSystem_Update(reg);
+    const double t1 = Platform_GetTime();
+    updateUs += (t1 - t0) * 1e6;
+    maxUpdateUs = std::max(maxUpdateUs, (t1 - t0) * 1e6);
+    const LightStats stats = LightSystem_GetStats();
+    floods += stats.floods;
+    cells += stats.cells;
+
+    // Reference: the whole map flooded again from scratch
+    const uint64_t incremental = LightBench_Hash();
+    const double t2 = Platform_GetTime();
+    LightSystem_Invalidate();
+    LightSystem_Update(reg);
+    fullUs += (Platform_GetTime() - t2) * 1e6;
+    fullCells += LightSystem_GetStats().cells;
+    mismatches += (LightBench_Hash() != incremental);
+  }
+
+  // Per-vertex shading cost: what the sprite batch pays per corner, for
+  // sprites spread over one 1920x1080 view in the middle of the grid
+  for (uint32_t i = 0; i < LIGHT_BENCH_SAMPLES; i++) {
+    samples[i] = creVec2{
+        worldW * 0.5f + static_cast<float>(Random_Range(-960, 959)),
+        worldH * 0.5f + static_cast<float>(Random_Range(-540, 539))};
+  }
+  uint32_t sink = 0;
+  const double s0 = Platform_GetTime();
+  for (uint32_t i = 0; i < LIGHT_BENCH_SAMPLES; i++) {
+    const creColor c = LightSystem_Sample(samples[i]);
+    sink += static_cast<uint32_t>(c.r + c.g + c.b);
+  }
+  const double sampleNs =
+      (Platform_GetTime() - s0) * 1e9 / LIGHT_BENCH_SAMPLES;
+
+  const double n = static_cast<double>(opt.ticks);
+  Log(LogLevel::Info,
+      "[LIGHT] {} lights | {}x{} cells | {} frames | {} doors/frame | "
+      "initial flood {} cells | mismatches {}",
+      LightSystem_GetStats().lights, LIGHT_GRID_WIDTH, LIGHT_GRID_HEIGHT,
+      opt.ticks, LIGHT_BENCH_DOORS, initial.cells, mismatches);
+  Log(LogLevel::Info,
+      "[LIGHT] incremental: {:.1f} us/frame (max {:.1f}) | {:.1f} floods, "
+      "{:.0f} cells/frame",
+      updateUs / n, maxUpdateUs, static_cast<double>(floods) / n,
+      static_cast<double>(cells) / n);
+  Log(LogLevel::Info,
+      "[LIGHT] full reflood every frame: {:.1f} us/frame ({:.0f} cells) | "
+      "sample {:.1f} ns (checksum {})",
+      fullUs / n, static_cast<double>(fullCells) / n, sampleNs, sink);
+
+  LightSystem_Clear();
+  free(created);
+  free(vel);
+  free(samples);
+}
+
+/**
+ * @brief Order-dependent hash of every team bitset.
+ */
+static uint64_t VisionBench_Hash(void) {
+  uint64_t hash = 1469598103934665603ULL;
+  const size_t words =
+      static_cast<size_t>(VISION_GRID_WIDTH / 64) * VISION_GRID_HEIGHT;
+  for (uint8_t t = 0; t < VISION_BENCH_TEAMS; t++) {
+    const uint64_t *bits = VisionSystem_GetTeamBits(t, nullptr);
+    for (size_t i = 0; i < words; i++) {
+      hash = (hash ^ bits[i]) * 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+static void RunVisionBench(EngineContext &ctx, const ServerOptions &opt) {
+  EntityRegistry &reg = *ctx.reg;
+  const uint32_t viewers = std::min(opt.entities, VISION_MAX_VIEWERS);
+  const float worldW =
+      static_cast<float>(VISION_GRID_WIDTH) * VISION_CELL_SIZE;
+  const float worldH =
+      static_cast<float>(VISION_GRID_HEIGHT) * VISION_CELL_SIZE;
+  Entity *created = static_cast<Entity *>(malloc(sizeof(Entity) * viewers));
+  creVec2 *vel = static_cast<creVec2 *>(malloc(sizeof(creVec2) * viewers));
+  creVec2 *queries =
+      static_cast<creVec2 *>(malloc(sizeof(creVec2) * VISION_BENCH_QUERIES));
+  if (!created || !vel || !queries) {
+    Log(LogLevel::Error, "[VISION] Out of memory");
+    free(created);
+    free(vel);
+    free(queries);
+    return;
+  }
+
+  const int32_t w = static_cast<int32_t>(VISION_GRID_WIDTH);
+  const int32_t h = static_cast<int32_t>(VISION_GRID_HEIGHT);
+  for (int32_t y = 0; y < h; y++) {
+    for (int32_t x = 0; x < w; x++) {
+      if (RoomBench_IsWall(x, y, VISION_BENCH_ROOM)) {
+        VisionSystem_SetOpaque(x, y, true);
+      }
+    }
+  }
+
+  for (uint32_t i = 0; i < viewers; i++) {
+    const creVec2 pos = {
+        static_cast<float>(Random_Range(0, static_cast<int32_t>(worldW) - 1)),
+        static_cast<float>(Random_Range(0, static_cast<int32_t>(worldH) - 1))};
+    created[i] = EntityManager_Create(reg, 0, pos, COMP_NONE, FLAG_ACTIVE);
+    vel[i] = creVec2{static_cast<float>(Random_Range(-240, 240)) / 60.0f,
+                     static_cast<float>(Random_Range(-240, 240)) / 60.0f};
+    VisionSystem_CreateViewer(created[i],
+                              static_cast<uint8_t>(i % VISION_BENCH_TEAMS),
+                              static_cast<uint32_t>(Random_Range(8, 24)));
+  }
+  VisionSystem_Update(reg);
+  const VisionStats initial = VisionSystem_GetStats();
+
+  double updateUs = 0.0;
+  double maxUpdateUs = 0.0;
+  double fullUs = 0.0;
+  uint64_t casts = 0;
+  uint64_t merges = 0;
+  uint32_t mismatches = 0;
+  uint32_t doorCursor = 0;
+  for (uint32_t frame = 0; frame < opt.ticks; frame++) {
+    // Viewers wander and bounce off the grid edges
+    for (uint32_t i = 0; i < viewers; i++) {
+      creVec2 &p = reg.pos[created[i].id];
+      p = p + vel[i];
+      if (p.x < 0.0f || p.x >= worldW) {
+        vel[i].x = -vel[i].x;
+        p.x = std::min(std::max(p.x, 0.0f), worldW - 1.0f);
+      }
+      if (p.y < 0.0f || p.y >= worldH) {
+        vel[i].y = -vel[i].y;
+        p.y = std::min(std::max(p.y, 0.0f), worldH - 1.0f);
+      }
+    }
+
+    const double t0 = Platform_GetTime();
+    for (uint32_t k = 0; k < VISION_BENCH_DOORS; k++) {
+      int32_t x;
+      int32_t y;
+      RoomBench_Door(doorCursor++, w, VISION_BENCH_ROOM, &x, &y);
+      VisionSystem_SetOpaque(x, y, !VisionSystem_IsOpaque(x, y));
+    }
+    VisionSystem_Update(reg);
+    const double t1 = Platform_GetTime();
+    updateUs += (t1 - t0) * 1e6;
+    maxUpdateUs = std::max(maxUpdateUs, (t1 - t0) * 1e6);
+    const VisionStats stats = VisionSystem_GetStats();
+    casts += stats.casts;
+    merges += stats.merges;
+
+    // Reference: every viewer cast again and every team rebuilt
+    const uint64_t incremental = VisionBench_Hash();
+    const double t2 = Platform_GetTime();
+    VisionSystem_Invalidate();
+    VisionSystem_Update(reg);
+    fullUs += (Platform_GetTime() - t2) * 1e6;
+    mismatches += (VisionBench_Hash() != incremental);
+  }
+
+  // Query cost: one bit test per AI target check or culled sprite
+  for (uint32_t i = 0; i < VISION_BENCH_QUERIES; i++) {
+    queries[i] = creVec2{
+        static_cast<float>(Random_Range(0, static_cast<int32_t>(worldW) - 1)),
+        static_cast<float>(Random_Range(0, static_cast<int32_t>(worldH) - 1))};
+  }
+  uint32_t seen = 0;
+  const double q0 = Platform_GetTime();
+  for (uint32_t i = 0; i < VISION_BENCH_QUERIES; i++) {
+    seen += VisionSystem_IsVisible(
+        static_cast<uint8_t>(i % VISION_BENCH_TEAMS), queries[i]);
+  }
+  const double queryNs =
+      (Platform_GetTime() - q0) * 1e9 / VISION_BENCH_QUERIES;
+
+  const double n = static_cast<double>(opt.ticks);
+  Log(LogLevel::Info,
+      "[VISION] {} viewers | {} teams | {}x{} cells | {} frames | "
+      "{} doors/frame | initial cast {} cells | mismatches {}",
+      VisionSystem_GetStats().viewers, VISION_BENCH_TEAMS, VISION_GRID_WIDTH,
+      VISION_GRID_HEIGHT, opt.ticks, VISION_BENCH_DOORS, initial.cells,
+      mismatches);
+  Log(LogLevel::Info,
+      "[VISION] cached: {:.1f} us/frame (max {:.1f}) | {:.1f} casts, "
+      "{:.2f} team merges/frame",
+      updateUs / n, maxUpdateUs, static_cast<double>(casts) / n,
+      static_cast<double>(merges) / n);
+  Log(LogLevel::Info,
+      "[VISION] recast every viewer every frame: {:.1f} us/frame | "
+      "visibility query {:.1f} ns ({}/{} visible)",
+      fullUs / n, queryNs, seen, VISION_BENCH_QUERIES);
+
+  VisionSystem_Clear();
+  free(created);
+  free(vel);
+  free(queries);
+}
+
+/**
+ * @brief Largest |distance - rest| between consecutive live links (spawned
+ * in slot order into an empty registry); alive gets the live link count.
+ */
+static float ChainBench_MaxStretch(const EntityRegistry &reg,
+                                   uint32_t *alive) {
+  float maxStretch = 0.0f;
+  bool hasPrev = false;
+  creVec2 prev = {0.0f, 0.0f};
+  *alive = 0;
+  for (uint32_t i = 0; i < reg.max_used_bound; i++) {
+    if (!(reg.state_flags[i] & FLAG_ACTIVE) ||
+        reg.types[i] != TYPE_CHAIN_LINK)
+      continue;
+    if (hasPrev) {
+      const float dx = reg.pos[i].x - prev.x;
+      const float dy = reg.pos[i].y - prev.y;
+      maxStretch = std::max(
+          maxStretch, fabsf(sqrtf(dx * dx + dy * dy) - CHAIN_BENCH_SPACING));
+    }
+    prev = reg.pos[i];
+    hasPrev = true;
+    (*alive)++;
+  }
+  return maxStretch;
+}
+
+static void RunChainBench(EngineContext &ctx, const ServerOptions &opt) {
+  EntityRegistry &reg = *ctx.reg;
+  Prototypes_Init(reg);
+  const Entity end =
+      Prototypes_SpawnChain(reg, *ctx.bus, creVec2{0.0f, 0.0f}, opt.entities);
+  if (!ENTITY_IS_VALID(end)) {
+    Log(LogLevel::Error, "[CHAIN] No link could be spawned");
+    return;
+  }
+  physicsAPI_SetGlobalGravity(*ctx.bus, 0.0f, CHAIN_BENCH_GRAVITY);
+  physicsAPI_SetVelocity(*ctx.bus, end, 0.0f, CHAIN_BENCH_KICK);
+  EngineHeadless_Tick(ctx); // Spawns, bodies and joints are applied
+
+  float *tickMs = static_cast<float *>(malloc(sizeof(float) * opt.ticks));
+  if (!tickMs) {
+    Log(LogLevel::Error, "[CHAIN] Out of memory for {} samples", opt.ticks);
+    return;
+  }
+  uint64_t subSteps = 0;
+  uint64_t iterations = 0;
+  uint32_t maxRows = 0;
+  uint32_t awakeTicks = 0; // Ticks that solved any joint row
+  float maxStretch = 0.0f;
+  uint32_t alive = 0;
+  const double benchStart = Platform_GetTime();
+  for (uint32_t i = 0; i < opt.ticks; i++) {
+    const double t0 = Platform_GetTime();
+    EngineHeadless_Tick(ctx);
+    tickMs[i] = static_cast<float>((Platform_GetTime() - t0) * 1000.0);
+    const PhysicsStepStats steps = PhysicsSystem_GetStepStats();
+    subSteps += steps.subSteps;
+    iterations += steps.iterations;
+    maxRows = std::max(maxRows, PhysicsConstraints_RowCount());
+    awakeTicks += PhysicsConstraints_RowCount() > 0 ? 1U : 0U;
+    maxStretch = std::max(maxStretch, ChainBench_MaxStretch(reg, &alive));
+  }
+  const double elapsed = Platform_GetTime() - benchStart;
+
+  std::sort(tickMs, tickMs + opt.ticks);
+  const uint32_t p99 = std::min(opt.ticks - 1, (opt.ticks * 99) / 100);
+  const double n = static_cast<double>(opt.ticks);
+  Log(LogLevel::Info,
+      "[CHAIN] {} links alive of {} | {} joints (up to {} rows, solved in "
+      "{} ticks) | {} ticks | avg {:.3f} ms | p99 {:.3f} ms | "
+      "{:.2f} sub-steps x {:.1f} it",
+      alive, opt.entities, PhysicsConstraints_Count(), maxRows, awakeTicks,
+      opt.ticks, (elapsed * 1000.0) / n,
+      static_cast<double>(tickMs[p99]), static_cast<double>(subSteps) / n,
+      static_cast<double>(iterations) /
+          static_cast<double>(subSteps > 0 ? subSteps : 1U));
+  Log(alive == opt.entities ? LogLevel::Info : LogLevel::Error,
+      "[CHAIN] Worst link stretch {:.3f} px (rest {:.0f} px)",
+      static_cast<double>(maxStretch),
+      static_cast<double>(CHAIN_BENCH_SPACING));
+  free(tickMs);
+}
+
+/** @brief Play a client recording through the game scene, uncapped. */
+static void RunReplay(EngineContext &ctx) {
+  Replay_Start(&ctx.time); // Recorded seed and fixed step
+  if (!Replay_IsPlaying())
+    return;
+  // Recordings ran without the physics time budget
+  PhysicsSystem_SetTimeBudget(0.0f);
+
+  SceneManager_Init(Server_GetScene);
+  SceneManager_ChangeScene(SERVER_STATE_GAME);
+
+  uint32_t frames = 0;
+  const double start = Platform_GetTime();
+  while (!Replay_IsFinished()) {
+    EngineHeadless_Tick(ctx);
+    frames++;
+  }
+  const double elapsed = Platform_GetTime() - start;
+  Log(LogLevel::Info, "[REPLAY] {} frames in {:.3f} s ({:.0f} frames/s)",
+      frames, elapsed, elapsed > 0.0 ? frames / elapsed : 0.0);
+  Replay_Shutdown(); // Per-frame timing report
+}
+
+int main(int argc, char **argv) {
+  const ServerOptions opt = ParseOptions(argc, argv);
+  StateHash_Init(argc, argv);
+  Replay_Init(argc, argv);
+
+  if (opt.gridBench) {
+    // Standalone: both structures are static module state
+    Random_Seed(opt.seed);
+    RunGridBench(opt);
+    return 0;
+  }
+  if (opt.timerBench) {
+    // Standalone: the bench owns the wheel's arena and the bus. The engine
+    // below re-initializes the wheel for RunTimerCheck.
+    Random_Seed(opt.seed);
+    RunTimerBench(opt);
+  }
+  if (opt.uiBench) {
+    // Standalone: the UI tree is static module state
+    Random_Seed(opt.seed);
+    RunUIBench(opt);
+    return 0;
+  }
+
+  EngineContext ctx = {};
+  ctx.masterArena = arena_AllocateMemory(256 * 1024 * 1024); // 256MB
+  if (!ctx.masterArena.base_ptr) {
+    arena_FreeMemory(&ctx.masterArena);
+    return -1;
+  }
+
+  EngineHeadless_Init(ctx);
+  Random_Seed(opt.seed);
+  if (opt.replay) {
+    RunReplay(ctx);
+    EngineHeadless_Shutdown(ctx);
+    arena_FreeMemory(&ctx.masterArena);
+    return 0;
+  }
+  if (opt.hierarchyBench || opt.tweenBench || opt.timerBench ||
+      opt.lightBench || opt.visionBench || opt.chainBench) {
+    // Empty world: the bench builds its own entities
+    if (opt.hierarchyBench) {
+      RunHierarchyBench(ctx, opt);
+    } else if (opt.tweenBench) {
+      RunTweenBench(ctx, opt);
+    } else if (opt.timerBench) {
+      RunTimerCheck(ctx);
+    } else if (opt.lightBench) {
+      RunLightBench(ctx, opt);
+    } else if (opt.chainBench) {
+      RunChainBench(ctx, opt);
+    } else {
+      RunVisionBench(ctx, opt);
+    }
+    EngineHeadless_Shutdown(ctx);
+    arena_FreeMemory(&ctx.masterArena);
+    return 0;
+  }
+  ServerScene_SetHordeSize(opt.entities);
+  SceneManager_Init(Server_GetScene);
+  SceneManager_ChangeScene(SERVER_STATE_HORDE);
+
+  if (opt.rollbackBench) {
+    RunRollbackBench(ctx, opt);
+  } else if (opt.netBench) {
+    RunNetBench(ctx, opt);
+  } else if (opt.bench) {
+    RunBench(ctx, opt);
+  } else {
+    if (opt.ticks) {
+      Log(LogLevel::Info, "[SERVER] Running {} ticks (uncapped)", opt.ticks);
+    } else {
+      Log(LogLevel::Info, "[SERVER] Running until stopped (uncapped)");
+    }
+    for (uint32_t tick = 0; opt.ticks == 0 || tick < opt.ticks; tick++) {
+      const double t0 = Platform_GetTime();
+      PROFILE_START(PROF_TOTAL_ACTIVE);
+      EngineHeadless_Tick(ctx);
+      PROFILE_END(PROF_TOTAL_ACTIVE);
+      Profiler_SetEngineStats(EngineStats_Get(*ctx.reg));
+      const PhysicsStepStats steps = PhysicsSystem_GetStepStats();
+      Profiler_SetPhysicsSteps(steps.subSteps, steps.iterations);
+      Profiler_UpdateAndPrint(static_cast<float>(Platform_GetTime() - t0));
+    }
+  }
+
+  EngineHeadless_Shutdown(ctx);
+  arena_FreeMemory(&ctx.masterArena);
+  return 0;
+}
@@ -0,0 +1,142 @@
+#include "server_scenes.h"
+#include "assets/atlas/atlas_data.h"
+#include "engine/core/cre_logger.h"
+#include "engine/core/cre_random.h"
+#include "engine/ecs/cre_entityAPI.h"
+#include "engine/ecs/cre_entityManager.h"
+#include "engine/ecs/cre_entityRegistry.h"
+#include "engine/ecs/cre_entitySystem.h"
+#include "engine/platform/cre_input.h"
+#include "engine/systems/animation/cre_animationAPI.h"
+#include "engine/systems/light/cre_lightSystem.h"
+#include "engine/systems/physics/cre_physicsAPI.h"
+#include "engine/systems/physics/cre_physics_defs.h"
+#include "engine/systems/timer/cre_timerSystem.h"
+#include "engine/systems/tween/cre_tweenSystem.h"
+#include "engine/systems/vision/cre_visionSystem.h"
+#include "game/controlSystem.h"
+#include "game/game_ai.h"
+#include "game/game_prototypes.h"
+#include <math.h>
+
+// Spawning is spread over several ticks: every zombie costs three commands
+// (spawn, body, animation) and the AI adds its own per tick.
+#define SERVER_SPAWN_PER_TICK 2048
+#define SERVER_HORDE_SPACING 48.0f // Average distance between zombies
+
+static uint32_t s_hordeSize = 16000;
+static uint32_t s_spawned = 0;
+static float s_halfExtent = 0.0f;
+static Entity s_player = ENTITY_INVALID;
+
+static void Horde_Init(EntityRegistry &reg, CommandBus &bus) {
+  EntitySystem_ClearAllHooks(reg);
+  EntityManager_Reset(reg);
+
+  Prototypes_Init(reg);
+  GameAI_Init();
+
+  s_player = entityAPI_Spawn(reg, bus, g_playerPrototype, creVec2{0.0f, 0.0f});
+  physicsAPI_DefineBody(bus, s_player, MAT_PLAYER, 0.2f, false);
+  GameAI_SetPlayer(s_player);
+
+  s_spawned = 0;
+  s_halfExtent =
+      sqrtf(static_cast<float>(s_hordeSize)) * SERVER_HORDE_SPACING * 0.5f;
+  Log(LogLevel::Info, "[SERVER] Horde scene: {} zombies in {:.0f}px square",
+      s_hordeSize, s_halfExtent * 2.0f);
+}
+
+static void Horde_Update(EntityRegistry &reg, CommandBus &bus, float dt) {
+  (void)dt;
+  if (s_spawned >= s_hordeSize)
+    return;
+
+  const int32_t extent = static_cast<int32_t>(s_halfExtent);
+  uint32_t batch = s_hordeSize - s_spawned;
+  if (batch > SERVER_SPAWN_PER_TICK)
+    batch = SERVER_SPAWN_PER_TICK;
+
+  for (uint32_t i = 0; i < batch; i++) {
+    const creVec2 pos = {static_cast<float>(Random_Range(-extent, extent)),
+                         static_cast<float>(Random_Range(-extent, extent))};
+    Entity zombie = entityAPI_Spawn(reg, bus, g_zombiePrototype, pos);
+    if (!ENTITY_IS_VALID(zombie)) {
+      // Registry full: settle for what fits.
+      Log(LogLevel::Warning, "[SERVER] Registry full at {} zombies",
+          s_spawned);
+      s_hordeSize = s_spawned;
+      return;
+    }
+    physicsAPI_DefineBody(bus, zombie, MAT_DEFAULT, 2.0f, false);
+    animAPI_Play(bus, zombie, ANIM_CHARACTER_ZOMBIE_RUN, true);
+    s_spawned++;
+  }
+}
+
+static void Horde_Unload(EntityRegistry &reg, CommandBus &bus) {
+  (void)reg;
+  (void)bus;
+  GameAI_Shutdown();
+}
+
+// Game_Init / Game_Update (game/game.cpp) minus rendering, debug overlays
+// and audio, so a client recording replays to the same state hashes.
+static void GameReplay_Init(EntityRegistry &reg, CommandBus &bus) {
+  EntitySystem_ClearAllHooks(reg);
+  EntityManager_Reset(reg);
+  TweenSystem_Clear();
+  TimerSystem_Clear();
+  LightSystem_Clear();
+  VisionSystem_Clear();
+
+  Prototypes_Init(reg);
+  GameAI_Init();
+  ControlSystem_StartGameplay(reg, bus);
+}
+
+static void GameReplay_Update(EntityRegistry &reg, CommandBus &bus, float dt) {
+  ControlSystem_Update(reg, bus, dt);
+
+  // The client switches to its game over scene here, which has no server
+  // counterpart: the rest of the recording no longer matches.
+  if (Input_IsPressed(ACTION_CONFIRM))
+    Log(LogLevel::Warning, "[SERVER] Recorded scene change is not replayed");
+}
+
+static void GameReplay_Unload(EntityRegistry &reg, CommandBus &bus) {
+  (void)reg;
+  (void)bus;
+  GameAI_Shutdown();
+}
+
+Scene Server_GetScene(int stateID) {
+  Scene scene = {};
+
+  switch (stateID) {
+  case SERVER_STATE_HORDE:
+    scene.Init = Horde_Init;
+    scene.Update = Horde_Update;
+    scene.Draw = nullptr;
+    scene.Unload = Horde_Unload;
+    break;
+
+  case SERVER_STATE_GAME:
+    scene.Init = GameReplay_Init;
+    scene.Update = GameReplay_Update;
+    scene.Draw = nullptr;
+    scene.Unload = GameReplay_Unload;
+    break;
+
+  default:
+    Log(LogLevel::Warning, "Server Scene failed to load.");
+    break;
+  }
+  return scene;
+}
+
+void ServerScene_SetHordeSize(uint32_t count) { s_hordeSize = count; }
+
+bool ServerScene_IsPopulated(void) { return s_spawned >= s_hordeSize; }
+
+uint32_t ServerScene_GetSpawnedCount(void) { return s_spawned; }
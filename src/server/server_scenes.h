@@ -0,0 +1,31 @@
+#ifndef SERVER_SCENES_H
+#define SERVER_SCENES_H
+
+#include "engine/scene/cre_scenes.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+  SERVER_STATE_HORDE, // Player + zombie horde (AI, physics, animation)
+  SERVER_STATE_GAME,  // The client's game scene without drawing (--replay)
+} ServerState;
+
+// Connect the headless server with the engine
+Scene Server_GetScene(int stateID);
+
+/**
+ * @brief Number of zombies the horde scene spawns (set before Init).
+ */
+void ServerScene_SetHordeSize(uint32_t count);
+
+/**
+ * @brief True once the whole horde has been spawned.
+ */
+bool ServerScene_IsPopulated(void);
+
+/**
+ * @brief Zombies spawned so far.
+ */
+uint32_t ServerScene_GetSpawnedCount(void);
+
+#endif
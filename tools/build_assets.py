@@ -17,9 +17,12 @@ Features:
     - Fail-fast architecture (no silent failures)
     - Memory-safe context managers for image handling
     - Trimmed dimensions (w, h) in SpriteMeta for rendering
+    - Font baking: raylib's default font glyphs packed into the same atlas
+    - Solid white texel block for untextured quads (UI panels)
 
 Usage:
     python build_assets.py [--input DIR] [--output DIR] [--size SIZE] [--padding N]
+                           [--font-source RTEXT_C] [--no-font]
 
 Author: Asset Pipeline Tool v2.3
 """
@@ -651,11 +654,131 @@ def calculate_atlas_density(unique_sprites: list[SpriteData], atlas_size: int) -
     return density, wasted, total_extruded_px
 
 
+# =============================================================================
+# Font Baking
+# =============================================================================
+
+FONT_FIRST_CHAR = 32    # ' '
+FONT_LAST_CHAR = 126    # '~' (engine text is ASCII)
+FONT_BITMAP_SIZE = 128  # raylib's default font bitmap is 128x128
+FONT_CHAR_HEIGHT = 10   # Also the base size DrawText scales from
+FONT_CHAR_DIVISOR = 1   # Pixels between glyph cells in the bitmap
+WHITE_TEXEL_SIZE = 2    # Solid block for untextured quads
+
+
+def parse_c_array(source: str, name: str) -> list[int]:
+    """Read the initializer of `<type> name[N] = { ... };` out of C source."""
+    match = re.search(rf"\b{name}\s*\[\s*\d+\s*\]\s*=\s*\{{([^}}]*)\}}", source)
+    if match is None:
+        raise ValueError(f"array '{name}' not found")
+    return [int(token, 0) for token in re.findall(r"0x[0-9a-fA-F]+|\d+", match.group(1))]
+
+
+def bake_default_font(font_source: Path) -> list[SpriteData]:
+    """
+    Rebuild raylib's default font from its bit-packed data (rtext.c) and
+    return one extruded SpriteData per ASCII glyph (' ' to '~').
+
+    The bitmap is decoded and sliced exactly like LoadFontDefault, so text
+    drawn from the atlas matches DrawText pixel for pixel. Set pixels are
+    opaque white (tinted at draw time); the rest are transparent white, so
+    filtering never darkens the edges.
+
+    Fail-fast: A missing or unparsable source aborts the build.
+    """
+    log.debug(f"Baking default font from: {font_source}")
+
+    try:
+        source = font_source.read_text(encoding="utf-8", errors="replace")
+        font_data = parse_c_array(source, "defaultFontData")
+        chars_width = parse_c_array(source, "charsWidth")
+
+        if len(font_data) != FONT_BITMAP_SIZE * FONT_BITMAP_SIZE // 32:
+            raise ValueError(f"defaultFontData has {len(font_data)} words")
+        if len(chars_width) < FONT_LAST_CHAR - FONT_FIRST_CHAR + 1:
+            raise ValueError(f"charsWidth has {len(chars_width)} entries")
+
+        # Bits -> pixels, 32 pixels per word, bit 0 first
+        bitmap = Image.new("RGBA", (FONT_BITMAP_SIZE, FONT_BITMAP_SIZE), (255, 255, 255, 0))
+        pixels = bitmap.load()
+        for word_index, word in enumerate(font_data):
+            for bit in range(32):
+                if word & (1 << bit):
+                    i = word_index * 32 + bit
+                    pixels[i % FONT_BITMAP_SIZE, i // FONT_BITMAP_SIZE] = (255, 255, 255, 255)
+
+        glyphs: list[SpriteData] = []
+        line = 0
+        current_x = FONT_CHAR_DIVISOR
+        test_x = FONT_CHAR_DIVISOR
+
+        for code in range(FONT_FIRST_CHAR, FONT_LAST_CHAR + 1):
+            width = chars_width[code - FONT_FIRST_CHAR]
+            x = current_x
+
+            # Same cell walk as LoadFontDefault (wraps at the bitmap edge)
+            test_x += width + FONT_CHAR_DIVISOR
+            if test_x >= FONT_BITMAP_SIZE:
+                line += 1
+                current_x = 2 * FONT_CHAR_DIVISOR + width
+                test_x = current_x
+                x = FONT_CHAR_DIVISOR
+            else:
+                current_x = test_x
+            y = FONT_CHAR_DIVISOR + line * (FONT_CHAR_HEIGHT + FONT_CHAR_DIVISOR)
+
+            glyph = SpriteData(
+                name=f"glyph_{code}",
+                original_path=font_source,
+                original_width=width,
+                original_height=FONT_CHAR_HEIGHT,
+                trimmed_image=bitmap.crop((x, y, x + width, y + FONT_CHAR_HEIGHT)),
+                trimmed_width=width,
+                trimmed_height=FONT_CHAR_HEIGHT,
+                offset_x=0,
+                offset_y=0,
+                sprite_id=code,
+            )
+            apply_edge_extrusion(glyph)
+            glyphs.append(glyph)
+
+        bitmap.close()
+        return glyphs
+
+    except Exception as e:
+        log.error(f"[ERROR] Failed to bake font from: {font_source}")
+        log.error(f"  Exception: {type(e).__name__}: {e}")
+        traceback.print_exc()
+        sys.exit(1)
+
+
+def make_white_texel() -> SpriteData:
+    """
+    A small opaque white block: untextured quads (UI panels) sample it and
+    stay in the atlas batch. The extrusion keeps its border white too, so
+    filtering at the edges still returns white.
+    """
+    block = SpriteData(
+        name="white",
+        original_path=Path("<generated>"),
+        original_width=WHITE_TEXEL_SIZE,
+        original_height=WHITE_TEXEL_SIZE,
+        trimmed_image=Image.new("RGBA", (WHITE_TEXEL_SIZE, WHITE_TEXEL_SIZE), (255, 255, 255, 255)),
+        trimmed_width=WHITE_TEXEL_SIZE,
+        trimmed_height=WHITE_TEXEL_SIZE,
+        offset_x=0,
+        offset_y=0,
+    )
+    apply_edge_extrusion(block)
+    return block
+
+
 # =============================================================================
 # Code Generation
 # =============================================================================
 
-def generate_header(sprites: list[SpriteData], animations: list[AnimationDef]) -> str:
+def generate_header(sprites: list[SpriteData], animations: list[AnimationDef],
+                    glyphs: list[SpriteData], white: SpriteData) -> str:
     """Generate the atlas_data.h header file content."""
     lines = [
         "// ============================================================================",
@@ -691,6 +814,15 @@ def generate_header(sprites: list[SpriteData], animations: list[AnimationDef]) -
         "} AnimDef;",
         "",
         "// ---------------------------------------------------------------------------",
+        "// Font Glyph Structure (raylib default font, advance = w * scale + spacing)",
+        "// ---------------------------------------------------------------------------",
+        "",
+        "typedef struct {",
+        "    uint16_t x, y;         // Position in the atlas (clean pixels, inside extrusion)",
+        "    uint16_t w, h;         // Glyph cell (h = FONT_BASE_SIZE)",
+        "} GlyphMeta;",
+        "",
+        "// ---------------------------------------------------------------------------",
         "// Sprite ID Enumeration",
         "// ---------------------------------------------------------------------------",
         "",
@@ -724,6 +856,29 @@ def generate_header(sprites: list[SpriteData], animations: list[AnimationDef]) -
         lines.append("} AnimID;")
         lines.append("")
     
+    if glyphs:
+        lines.extend([
+            "// ---------------------------------------------------------------------------",
+            "// Font Glyphs (codepoints FONT_FIRST_CHAR .. FONT_FIRST_CHAR + FONT_GLYPH_COUNT - 1)",
+            "// ---------------------------------------------------------------------------",
+            "",
+            f"#define FONT_FIRST_CHAR {FONT_FIRST_CHAR}",
+            f"#define FONT_GLYPH_COUNT {len(glyphs)}",
+            f"#define FONT_BASE_SIZE {FONT_CHAR_HEIGHT}",
+            "",
+        ])
+
+    lines.extend([
+        "// ---------------------------------------------------------------------------",
+        "// Solid White Texels (untextured quads sample inside this block)",
+        "// ---------------------------------------------------------------------------",
+        "",
+        f"#define ATLAS_WHITE_X {white.atlas_x + 1}",
+        f"#define ATLAS_WHITE_Y {white.atlas_y + 1}",
+        f"#define ATLAS_WHITE_SIZE {WHITE_TEXEL_SIZE}",
+        "",
+    ])
+
     # External declarations
     lines.extend([
         "// ---------------------------------------------------------------------------",
@@ -735,6 +890,9 @@ def generate_header(sprites: list[SpriteData], animations: list[AnimationDef]) -
     
     if animations:
         lines.append("extern const AnimDef ASSET_ANIMS[ANIM_COUNT];")
+
+    if glyphs:
+        lines.append("extern const GlyphMeta ASSET_GLYPHS[FONT_GLYPH_COUNT];")
     
     lines.extend([
         "",
@@ -745,7 +903,8 @@ def generate_header(sprites: list[SpriteData], animations: list[AnimationDef]) -
     return "\n".join(lines)
 
 
-def generate_source(sprites: list[SpriteData], animations: list[AnimationDef]) -> str:
+def generate_source(sprites: list[SpriteData], animations: list[AnimationDef],
+                    glyphs: list[SpriteData]) -> str:
     """
     Generate the atlas_data.c source file content.
     
@@ -834,6 +993,30 @@ def generate_source(sprites: list[SpriteData], animations: list[AnimationDef]) -
             )
         
         lines.append("};")
+
+    # Glyph data
+    if glyphs:
+        lines.extend([
+            "",
+            "// ---------------------------------------------------------------------------",
+            "// Font Glyph Array",
+            "// Format: { x, y, w, h }",
+            "// ---------------------------------------------------------------------------",
+            "",
+            "const GlyphMeta ASSET_GLYPHS[FONT_GLYPH_COUNT] = {",
+        ])
+
+        for i, glyph in enumerate(glyphs):
+            comma = "," if i < len(glyphs) - 1 else ""
+            char = chr(glyph.sprite_id)
+            label = f"'{char}'" if char not in "\\*/" else f"0x{glyph.sprite_id:02X}"
+            lines.append(
+                f"    /* [{i:3d}] {label:4s} */ "
+                f"{{ {glyph.atlas_x + 1:4d}, {glyph.atlas_y + 1:4d}, "
+                f"{glyph.trimmed_width:2d}, {glyph.trimmed_height:2d} }}{comma}"
+            )
+
+        lines.append("};")
     
     lines.append("")
     
@@ -1138,6 +1321,19 @@ Examples:
         help="Disable strict mode (allow animation gaps without failing)"
     )
     
+    parser.add_argument(
+        "--font-source",
+        type=Path,
+        default=None,
+        help="raylib rtext.c to bake the default font from (default: ../src/external/raylib/src/rtext.c)"
+    )
+    
+    parser.add_argument(
+        "--no-font",
+        action="store_true",
+        help="Skip baking font glyphs into the atlas"
+    )
+    
     parser.add_argument(
         "--verbose", "-v",
         action="store_true",
@@ -1156,6 +1352,7 @@ Examples:
     input_dir = args.input or (project_root / "assets" / "raw_textures")
     output_dir = args.output or (project_root / "assets" / "build")
     header_dir = args.header_dir or output_dir
+    font_source = args.font_source or (project_root / "src" / "external" / "raylib" / "src" / "rtext.c")
     
     strict_mode = not args.no_strict
     
@@ -1173,6 +1370,7 @@ Examples:
     print(f"  Extrusion:   1px (edge smearing enabled)")
     print(f"  Dedup:       {'Disabled' if args.no_dedup else 'Enabled (normalized)'}")
     print(f"  Strict:      {'Enabled' if strict_mode else 'Disabled'}")
+    print(f"  Font:        {'Disabled' if args.no_font else font_source}")
     print(f"  Debug HTML:  {'Disabled' if args.no_debug else 'Enabled'}")
     print(f"  Verbose:     {'Enabled' if args.verbose else 'Disabled'}")
     print("=" * 70)
@@ -1182,7 +1380,7 @@ Examples:
     
     try:
         # Step 1: Find PNG files
-        print("[1/8] Scanning for PNG files...")
+        print("[1/9] Scanning for PNG files...")
         png_files = find_png_files(input_dir)
         print(f"      Found {len(png_files)} PNG files")
         
@@ -1191,7 +1389,7 @@ Examples:
             return 0
         
         # Step 2: Load and trim sprites
-        print("\n[2/8] Loading and trimming sprites...")
+        print("\n[2/9] Loading and trimming sprites...")
         sprites: list[SpriteData] = []
         
         for i, file_path in enumerate(png_files):
@@ -1210,7 +1408,7 @@ Examples:
         print(f"      ({original_px:,} px -> {trimmed_px:,} px)")
         
         # Step 3: Check for name collisions (The Guardian)
-        print("\n[3/8] Checking for C identifier collisions...")
+        print("\n[3/9] Checking for C identifier collisions...")
         collision_errors = check_name_collisions(sprites)
         if collision_errors:
             print("      [ERROR] NAME COLLISION DETECTED!")
@@ -1221,7 +1419,7 @@ Examples:
         print("      [OK] No collisions detected")
         
         # Step 4: Deduplicate sprites
-        print("\n[4/8] Deduplicating identical sprites (with pixel normalization)...")
+        print("\n[4/9] Deduplicating identical sprites (with pixel normalization)...")
         if args.no_dedup:
             unique_sprites = sprites
             duplicate_count = 0
@@ -1240,19 +1438,32 @@ Examples:
                 print("      No duplicates found")
         
         # Step 5: Apply edge extrusion to unique sprites
-        print("\n[5/8] Applying edge extrusion (1px border)...")
+        print("\n[5/9] Applying edge extrusion (1px border)...")
         for sprite in unique_sprites:
             # apply_edge_extrusion uses fail-fast - will sys.exit(1) on any error
             apply_edge_extrusion(sprite)
         print(f"      Applied extrusion to {len(unique_sprites)} sprites")
         
-        # Step 6: Pack sprites into atlas
-        print("\n[6/8] Packing sprites into atlas...")
-        atlas = pack_sprites(unique_sprites, args.size, args.padding)
-        print(f"      Successfully packed {len(unique_sprites)} unique sprites")
-        
-        # Step 7: Detect animations with strict validation
-        print("\n[7/8] Detecting animation sequences...")
+        # Step 6: Bake font glyphs and the white texel block
+        print("\n[6/9] Baking font glyphs...")
+        white = make_white_texel()
+        if args.no_font:
+            glyphs: list[SpriteData] = []
+            print("      Font baking disabled")
+        else:
+            # bake_default_font uses fail-fast - will sys.exit(1) on any error
+            glyphs = bake_default_font(font_source)
+            print(f"      Baked {len(glyphs)} glyphs")
+        
+        # Step 7: Pack sprites into atlas
+        # Glyphs are shorter than any sprite, so the height sort packs them
+        # last and sprite placement does not depend on the font.
+        print("\n[7/9] Packing sprites into atlas...")
+        atlas = pack_sprites(unique_sprites + glyphs + [white], args.size, args.padding)
+        print(f"      Successfully packed {len(unique_sprites)} unique sprites and {len(glyphs)} glyphs")
+        
+        # Step 8: Detect animations with strict validation
+        print("\n[8/9] Detecting animation sequences...")
         animations, anim_errors = detect_animations(sprites, strict=strict_mode)
         
         if anim_errors:
@@ -1273,8 +1484,8 @@ Examples:
         else:
             print("      No multi-frame animations detected")
         
-        # Step 8: Save outputs
-        print("\n[8/8] Saving output files...")
+        # Step 9: Save outputs
+        print("\n[9/9] Saving output files...")
         
         # Save atlas image
         atlas_path = output_dir / "atlas.png"
@@ -1283,13 +1494,13 @@ Examples:
         print(f"      Saved: {atlas_path} ({atlas_size_kb:.1f} KB)")
         
         # Save C header (uses ALL sprites for enum, even duplicates)
-        header_content = generate_header(sprites, animations)
+        header_content = generate_header(sprites, animations, glyphs, white)
         header_path = header_dir / "atlas_data.h"
         header_path.write_text(header_content)
         print(f"      Saved: {header_path}")
         
         # Save C source (uses ALL sprites, duplicates reference originals)
-        source_content = generate_source(sprites, animations)
+        source_content = generate_source(sprites, animations, glyphs)
         source_path = header_dir / "atlas_data.c"
         source_path.write_text(source_content)
         print(f"      Saved: {source_path}")
@@ -1302,7 +1513,7 @@ Examples:
             print(f"      Saved: {html_path}")
         
         # Calculate atlas density
-        density, wasted, total_extruded = calculate_atlas_density(unique_sprites, args.size)
+        density, wasted, total_extruded = calculate_atlas_density(unique_sprites + glyphs + [white], args.size)
         
         # Summary
         print()
@@ -1313,6 +1524,7 @@ Examples:
         print(f"  Unique Packed:   {len(unique_sprites)}")
         print(f"  Duplicates:      {duplicate_count}")
         print(f"  Animations:      {len(animations)}")
+        print(f"  Font Glyphs:     {len(glyphs)}")
         print(f"  Atlas:           {args.size}x{args.size} px")
         print(f"  Trimmed:         {saved_pct:.1f}% space saved")
         print()
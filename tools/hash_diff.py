@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+State Hash Diff for CRayEngine
+==============================
+Compares two --hash-log files (written by cre_stateHash) and reports the
+first fixed step whose registry hashes differ, including which columns
+diverged.
+
+Typical use:
+    CRayEngine --replay run.crrp --hash-log a.csv
+    CRayEngine --replay run.crrp --hash-log b.csv
+    python hash_diff.py a.csv b.csv
+
+Exit codes: 0 = identical, 1 = diverged, 2 = bad input.
+"""
+
+import argparse
+import csv
+import sys
+
+
+def load_log(path):
+    """Return (column names, rows) from a hash log."""
+    try:
+        with open(path, newline="") as handle:
+            reader = csv.reader(handle)
+            header = next(reader, None)
+            if not header or header[:2] != ["frame", "step"]:
+                raise ValueError("missing 'frame,step' header")
+            rows = [row for row in reader if row]
+    except (OSError, ValueError) as err:
+        print(f"error: {path}: {err}", file=sys.stderr)
+        sys.exit(2)
+    return header, rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Find the first diverging step between two state hash logs.")
+    parser.add_argument("a", help="Reference hash log")
+    parser.add_argument("b", help="Hash log to compare")
+    args = parser.parse_args()
+
+    header_a, rows_a = load_log(args.a)
+    header_b, rows_b = load_log(args.b)
+
+    if header_a != header_b:
+        print("error: logs hash different columns:", file=sys.stderr)
+        print(f"  {args.a}: {','.join(header_a)}", file=sys.stderr)
+        print(f"  {args.b}: {','.join(header_b)}", file=sys.stderr)
+        sys.exit(2)
+
+    columns = header_a[2:]
+    for index, (row_a, row_b) in enumerate(zip(rows_a, rows_b)):
+        if row_a[:2] != row_b[:2]:
+            print(f"DIVERGED at step #{index}: step schedule differs "
+                  f"(frame {row_a[0]} step {row_a[1]} vs frame {row_b[0]} step {row_b[1]})")
+            sys.exit(1)
+
+        diverged = [name for name, ha, hb in zip(columns, row_a[2:], row_b[2:])
+                    if ha != hb and name != "total"]
+        if diverged or row_a[-1] != row_b[-1]:
+            print(f"DIVERGED at frame {row_a[0]} step {row_a[1]} (step #{index})")
+            for name in diverged:
+                col = columns.index(name) + 2
+                print(f"  {name:<16} {row_a[col]}  !=  {row_b[col]}")
+            sys.exit(1)
+
+    if len(rows_a) != len(rows_b):
+        shorter = args.a if len(rows_a) < len(rows_b) else args.b
+        print(f"MATCH for {min(len(rows_a), len(rows_b))} steps, but {shorter} ends early "
+              f"({len(rows_a)} vs {len(rows_b)} steps)")
+        sys.exit(1)
+
+    print(f"IDENTICAL: {len(rows_a)} steps, {len(columns) - 1} columns")
+    sys.exit(0)
+
+
+if __name__ == "__main__":
+    main()